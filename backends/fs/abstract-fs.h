@@ -168,6 +168,14 @@ public:
 	 */
 	virtual Common::SeekableReadStream *createReadStream() = 0;
 
+	/**
+	 * Maps the file referred by this node into memory. This is optional,
+	 * backends which can't do it just keep the default implementation.
+	 *
+	 * @return pointer to the mapping, 0 in case of a failure
+	 */
+	virtual Common::MappedFile *createMappedFile() { return 0; }
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
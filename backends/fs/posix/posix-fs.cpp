@@ -32,12 +32,18 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/stdiostream.h"
 #include "common/algorithm.h"
+#include "common/mappedfile.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
 #include <dirent.h>
 #include <stdio.h>
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
 #ifdef __OS2__
 #define INCL_DOS
 #include <os2.h>
@@ -246,6 +252,53 @@ Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
 	return StdioStream::makeFromPath(getPath(), false);
 }
 
+#ifdef HAVE_MMAP
+/**
+ * A file mapped into memory with mmap(). The mapping is private and writable,
+ * so that pages get copied when they are modified.
+ */
+class POSIXMappedFile : public Common::MappedFile {
+private:
+	byte *_data;
+	uint32 _size;
+
+public:
+	POSIXMappedFile(byte *data, uint32 size) : _data(data), _size(size) {}
+	~POSIXMappedFile() { munmap(_data, _size); }
+
+	virtual byte *getData() const { return _data; }
+	virtual uint32 size() const { return _size; }
+};
+#endif
+
+Common::MappedFile *POSIXFilesystemNode::createMappedFile() {
+#ifdef HAVE_MMAP
+	int fd = open(_path.c_str(), O_RDONLY);
+	if (fd == -1)
+		return 0;
+
+	// Empty files can't be mapped, and we don't bother with anything which
+	// doesn't fit into the address space comfortably. That's a lot less on
+	// 32 bit hosts, where every mapping takes from the 2-3 GB available.
+	const off_t maxSize = (sizeof(void *) < 8) ? 0x10000000 : 0x40000000;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0 || st.st_size > maxSize) {
+		close(fd);
+		return 0;
+	}
+
+	void *data = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	// The mapping stays valid after closing the file
+	close(fd);
+	if (data == MAP_FAILED)
+		return 0;
+
+	return new POSIXMappedFile((byte *)data, st.st_size);
+#else
+	return 0;
+#endif
+}
+
 Common::WriteStream *POSIXFilesystemNode::createWriteStream() {
 	return StdioStream::makeFromPath(getPath(), true);
 }
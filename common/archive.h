@@ -31,6 +31,7 @@
 namespace Common {
 
 class FSNode;
+class MappedFile;
 class SeekableReadStream;
 
 
@@ -46,6 +47,14 @@ class ArchiveMember {
 public:
 	virtual ~ArchiveMember() { }
 	virtual SeekableReadStream *createReadStream() const = 0;
+
+	/**
+	 * Maps the member into memory, if the archive allows that.
+	 *
+	 * @return the mapping, 0 if the member can't be mapped
+	 */
+	virtual MappedFile *createMappedFile() const { return 0; }
+
 	virtual String getName() const = 0;
 	virtual String getDisplayName() const { return getName(); }
 };
@@ -25,9 +25,20 @@
 #include "common/memstream.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 
 namespace Common {
 
+// The first DCL_HUFFMAN_TABLE_BITS bits of a code are decoded with a single
+// table lookup, instead of walking the tree bit by bit. Codes which are longer
+// than that continue walking the tree at the node the table points to.
+#define DCL_HUFFMAN_TABLE_BITS 8
+
+struct DCLHuffmanTable {
+	uint16 value[1 << DCL_HUFFMAN_TABLE_BITS];	///< leaf value, or tree position for longer codes
+	byte length[1 << DCL_HUFFMAN_TABLE_BITS];	///< code length, 0 for longer codes
+};
+
 class DecompressorDCL {
 public:
 	bool unpack(ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked);
@@ -59,13 +70,26 @@ protected:
 
 	void fetchBitsLSB();
 
+	/**
+	 * Get the next byte of packed data. The data is read from _src in blocks,
+	 * instead of calling _src->readByte() for every byte.
+	 * @return byte
+	 */
+	byte readPackedByte() {
+		if (_readAheadPos == _readAheadSize)
+			fillReadAhead();
+		return _readAhead[_readAheadPos++];
+	}
+
+	void fillReadAhead();
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
 	 */
 	void putByte(byte b);
 
-	int huffman_lookup(const int *tree);
+	int huffman_lookup(const int *tree, const DCLHuffmanTable *table);
 
 	uint32 _dwBits;		///< bits buffer
 	byte _nBits;		///< number of unread bits in _dwBits
@@ -75,6 +99,15 @@ protected:
 	uint32 _dwWrote;	///< number of bytes written to _dest
 	ReadStream *_src;
 	byte *_dest;
+
+	enum {
+		kReadAheadSize = 1024
+	};
+
+	byte _readAhead[kReadAheadSize];	///< packed data read from _src, but not yet used
+	uint32 _readAheadPos;	///< position of the next unused byte in _readAhead
+	uint32 _readAheadSize;	///< number of valid bytes in _readAhead
+	uint32 _srcLeft;		///< number of packed bytes not yet read from _src
 };
 
 void DecompressorDCL::init(ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked) {
@@ -85,11 +118,26 @@ void DecompressorDCL::init(ReadStream *src, byte *dest, uint32 nPacked, uint32 n
 	_nBits = 0;
 	_dwRead = _dwWrote = 0;
 	_dwBits = 0;
+	_readAheadPos = _readAheadSize = 0;
+	_srcLeft = nPacked;
+}
+
+void DecompressorDCL::fillReadAhead() {
+	// Past the end of the packed data the bit buffer still gets filled up
+	// from whatever follows in _src, so only read as much as it needs there
+	uint32 wanted = _srcLeft ? MIN<uint32>(_srcLeft, kReadAheadSize) : 4;
+	uint32 got = _src->read(_readAhead, wanted);
+	if (got < wanted)
+		memset(_readAhead + got, 0, wanted - got);
+
+	_srcLeft -= MIN<uint32>(_srcLeft, wanted);
+	_readAheadPos = 0;
+	_readAheadSize = wanted;
 }
 
 void DecompressorDCL::fetchBitsLSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)readPackedByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -316,16 +364,59 @@ static const int ascii_tree[] = {
 	LN(509, 128)      LN(510, 26)
 };
 
-int DecompressorDCL::huffman_lookup(const int *tree) {
-	int pos = 0;
+static DCLHuffmanTable s_lengthTable, s_distanceTable, s_asciiTable;
+static bool s_huffmanTablesBuilt = false;
+
+static void buildHuffmanTable(const int *tree, DCLHuffmanTable *table) {
+	for (int code = 0; code < (1 << DCL_HUFFMAN_TABLE_BITS); code++) {
+		int pos = 0;
+		byte length = 0;
+
+		// Bits are read starting with the least significant one
+		while (!(tree[pos] & HUFFMAN_LEAF) && length < DCL_HUFFMAN_TABLE_BITS) {
+			pos = ((code >> length) & 1) ? tree[pos] & 0xFFF : tree[pos] >> 12;
+			length++;
+		}
+
+		if (tree[pos] & HUFFMAN_LEAF) {
+			table->value[code] = tree[pos] & 0xFFFF;
+			table->length[code] = length;
+		} else {
+			table->value[code] = pos;
+			table->length[code] = 0;
+		}
+	}
+}
+
+static void buildHuffmanTables() {
+	if (s_huffmanTablesBuilt)
+		return;
+
+	buildHuffmanTable(length_tree, &s_lengthTable);
+	buildHuffmanTable(distance_tree, &s_distanceTable);
+	buildHuffmanTable(ascii_tree, &s_asciiTable);
+	s_huffmanTablesBuilt = true;
+}
+
+int DecompressorDCL::huffman_lookup(const int *tree, const DCLHuffmanTable *table) {
+	if (_nBits < DCL_HUFFMAN_TABLE_BITS)
+		fetchBitsLSB();
 
-	while (!(tree[pos] & HUFFMAN_LEAF)) {
-		int bit = getBitsLSB(1);
-		debug(8, "[%d]:%d->", pos, bit);
-		pos = bit ? tree[pos] & 0xFFF : tree[pos] >> 12;
+	uint32 code = _dwBits & ((1 << DCL_HUFFMAN_TABLE_BITS) - 1);
+	byte length = table->length[code];
+	if (length) {
+		_dwBits >>= length;
+		_nBits -= length;
+		return table->value[code];
 	}
 
-	debug(8, "=%02x\n", tree[pos] & 0xffff);
+	_dwBits >>= DCL_HUFFMAN_TABLE_BITS;
+	_nBits -= DCL_HUFFMAN_TABLE_BITS;
+
+	int pos = table->value[code];
+	while (!(tree[pos] & HUFFMAN_LEAF))
+		pos = getBitsLSB(1) ? tree[pos] & 0xFFF : tree[pos] >> 12;
+
 	return tree[pos] & 0xFFFF;
 }
 
@@ -334,6 +425,7 @@ int DecompressorDCL::huffman_lookup(const int *tree) {
 
 bool DecompressorDCL::unpack(ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked) {
 	init(src, dest, nPacked, nUnpacked);
+	buildHuffmanTables();
 
 	int value;
 	uint32 val_distance, val_length;
@@ -351,16 +443,14 @@ bool DecompressorDCL::unpack(ReadStream *src, byte *dest, uint32 nPacked, uint32
 
 	while (_dwWrote < _szUnpacked) {
 		if (getBitsLSB(1)) { // (length,distance) pair
-			value = huffman_lookup(length_tree);
+			value = huffman_lookup(length_tree, &s_lengthTable);
 
 			if (value < 8)
 				val_length = value + 2;
 			else
 				val_length = 8 + (1 << (value - 7)) + getBitsLSB(value - 7);
 
-			debug(8, " | ");
-
-			value = huffman_lookup(distance_tree);
+			value = huffman_lookup(distance_tree, &s_distanceTable);
 
 			if (val_length == 2)
 				val_distance = (value << 2) | getBitsLSB(2);
@@ -368,7 +458,7 @@ bool DecompressorDCL::unpack(ReadStream *src, byte *dest, uint32 nPacked, uint32
 				val_distance = (value << length_param) | getBitsLSB(length_param);
 			val_distance ++;
 
-			debug(8, "\nCOPY(%d from %d)\n", val_length, val_distance);
+			debug(9, "COPY(%d from %d)", val_length, val_distance);
 
 			if (val_length + _dwWrote > _szUnpacked) {
 				warning("DCL-INFLATE Error: Write out of bounds while copying %d bytes", val_length);
@@ -380,25 +470,16 @@ bool DecompressorDCL::unpack(ReadStream *src, byte *dest, uint32 nPacked, uint32
 				return false;
 			}
 
-			while (val_length) {
-				uint32 copy_length = (val_length > val_distance) ? val_distance : val_length;
-				assert(val_distance >= copy_length);
-				uint32 pos = _dwWrote - val_distance;
-				for (uint32 i = 0; i < copy_length; i++)
-					putByte(dest[pos + i]);
-
-				for (uint32 i = 0; i < copy_length; i++)
-					debug(9, "\33[32;31m%02x\33[37;37m ", dest[pos + i]);
-				debug(9, "\n");
-
-				val_length -= copy_length;
-				val_distance += copy_length;
-			}
-
+			// Copy byte by byte, when the distance is shorter than the length
+			// the bytes written at the start get repeated
+			const byte *in = dest + _dwWrote - val_distance;
+			byte *out = dest + _dwWrote;
+			for (uint32 i = 0; i < val_length; i++)
+				*out++ = *in++;
+			_dwWrote += val_length;
 		} else { // Copy byte verbatim
-			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree) : getByteLSB();
+			value = (mode == DCL_ASCII_MODE) ? huffman_lookup(ascii_tree, &s_asciiTable) : getByteLSB();
 			putByte(value);
-			debug(9, "\33[32;31m%02x \33[37;37m", value);
 		}
 	}
 
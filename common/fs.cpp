@@ -139,6 +139,13 @@ SeekableReadStream *FSNode::createReadStream() const {
 	return _realNode->createReadStream();
 }
 
+MappedFile *FSNode::createMappedFile() const {
+	if (_realNode == 0 || !_realNode->exists() || _realNode->isDirectory())
+		return 0;
+
+	return _realNode->createMappedFile();
+}
+
 WriteStream *FSNode::createWriteStream() const {
 	if (_realNode == 0)
 		return 0;
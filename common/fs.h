@@ -214,6 +214,15 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStream() const;
 
+	/**
+	 * Maps the file referred by this node into memory. Not all backends
+	 * support this, callers need to fall back to createReadStream() if 0 is
+	 * returned.
+	 *
+	 * @return pointer to the mapping, 0 in case of a failure
+	 */
+	virtual MappedFile *createMappedFile() const;
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
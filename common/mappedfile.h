@@ -0,0 +1,79 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_MAPPEDFILE_H
+#define COMMON_MAPPEDFILE_H
+
+#include "common/scummsys.h"
+#include "common/noncopyable.h"
+#include "common/memstream.h"
+
+namespace Common {
+
+/**
+ * The contents of a whole file, mapped into memory by the backend, so that
+ * reading it doesn't need any system calls or copies.
+ *
+ * The mapping is private: the data may be modified in place, but the changes
+ * are never written back to the file. Pointers and streams obtained from a
+ * MappedFile are only valid as long as the MappedFile itself exists.
+ *
+ * @see FSNode::createMappedFile
+ */
+class MappedFile : NonCopyable {
+public:
+	virtual ~MappedFile() {}
+
+	/**
+	 * Returns a pointer to the contents of the file.
+	 */
+	virtual byte *getData() const = 0;
+
+	/**
+	 * Returns the size of the file.
+	 */
+	virtual uint32 size() const = 0;
+
+	/**
+	 * Creates a stream reading a part of the file straight from the mapping.
+	 *
+	 * @param offset	where the part starts
+	 * @param len		the size of the part
+	 * @return pointer to the stream object, 0 if the part is out of range
+	 */
+	SeekableReadStream *createReadStream(uint32 offset, uint32 len) const {
+		if (offset > size() || len > size() - offset)
+			return 0;
+		return new MemoryReadStream(getData() + offset, len, DisposeAfterUse::NO);
+	}
+
+	/**
+	 * Creates a stream reading the whole file straight from the mapping.
+	 */
+	SeekableReadStream *createReadStream() const {
+		return createReadStream(0, size());
+	}
+};
+
+} // End of namespace Common
+
+#endif
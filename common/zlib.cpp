@@ -24,6 +24,7 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "common/zlib.h"
+#include "common/array.h"
 #include "common/ptr.h"
 #include "common/util.h"
 #include "common/stream.h"
@@ -38,6 +39,12 @@
   #if ZLIB_VERNUM < 0x1204
   #error Version 1.2.0.4 or newer of zlib is required for this code
   #endif
+
+  // Seek checkpoints need inflatePrime() and inflate() stopping at the end
+  // of deflate blocks
+  #if ZLIB_VERNUM >= 0x1230
+  #define ZLIB_SEEK_CHECKPOINTS
+  #endif
 #endif
 
 
@@ -143,25 +150,194 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
  * A simple wrapper class which can be used to wrap around an arbitrary
  * other SeekableReadStream and will then provide on-the-fly decompression support.
  * Assumes the compressed data to be in gzip format.
+ *
+ * As long as the stream is only read from front to back, the data is inflated
+ * straight into the caller's buffer. Once it seeks, the most recently inflated
+ * data is kept in a cache, so that seeking back a little doesn't need to
+ * inflate anything. Seeking further back restarts inflating from the closest
+ * checkpoint before the new position. From then on, a checkpoint is recorded
+ * at the end of a deflate block every CHECKPOINTSPAN bytes of inflated data,
+ * along with the window of data that deflate may refer back to (the approach
+ * of zran.c in the zlib examples). Seeking forward past a known checkpoint
+ * skips to it as well.
  */
 class GZipReadStream : public SeekableReadStream {
 protected:
 	enum {
-		BUFSIZE = 16384		// 1 << MAX_WBITS
+		BUFSIZE = 16384,		// 1 << MAX_WBITS
+		WINDOWSIZE = 32768,		// how far back deflate may refer
+		CACHESIZE = 65536,		// must be at least WINDOWSIZE
+		CHECKPOINTSPAN = 262144	// inflated bytes between checkpoints
+	};
+
+	struct Checkpoint {
+		uint32 outPos;	// position in the inflated data
+		uint32 inPos;	// position of the next compressed byte
+		int bits;		// bits of the byte before inPos that are still unused
+		byte *window;	// the WINDOWSIZE inflated bytes before outPos
 	};
 
 	byte	_buf[BUFSIZE];
+	byte	*_cache;	// only allocated once the stream seeks
 
 	ScopedPtr<SeekableReadStream> _wrapped;
 	z_stream _stream;
 	int _zlibErr;
 	uint32 _pos;
+	uint32 _outPos;		// amount of data inflated so far
+	uint32 _cacheStart;	// the cache holds the data from here up to _outPos, if any
 	uint32 _origSize;
 	bool _eos;
+	Array<Checkpoint> _checkpoints;
+
+	void restart() {
+		// The stream may be set up for raw deflate data by restoreCheckpoint()
+		inflateEnd(&_stream);
+		_zlibErr = inflateInit2(&_stream, MAX_WBITS + 32);
+
+		_wrapped->seek(0, SEEK_SET);
+		_stream.next_in = _buf;
+		_stream.avail_in = 0;
+		_outPos = 0;
+		_cacheStart = 0;
+	}
+
+#ifdef ZLIB_SEEK_CHECKPOINTS
+	void restoreCheckpoint(const Checkpoint &checkpoint) {
+		// Checkpoints are in the middle of the deflate data, past any header
+		inflateEnd(&_stream);
+		_zlibErr = inflateInit2(&_stream, -MAX_WBITS);
+		if (_zlibErr != Z_OK)
+			return;
+
+		_wrapped->seek(checkpoint.inPos - (checkpoint.bits ? 1 : 0), SEEK_SET);
+		_stream.next_in = _buf;
+		_stream.avail_in = 0;
+		if (checkpoint.bits)
+			inflatePrime(&_stream, checkpoint.bits, _wrapped->readByte() >> (8 - checkpoint.bits));
+		inflateSetDictionary(&_stream, checkpoint.window, WINDOWSIZE);
+
+		// The window is what the cache would hold at this point
+		_outPos = checkpoint.outPos;
+		_cacheStart = checkpoint.outPos - WINDOWSIZE;
+		for (uint32 i = 0; i < WINDOWSIZE; i++)
+			_cache[(_cacheStart + i) % CACHESIZE] = checkpoint.window[i];
+	}
+
+	void addCheckpoint(uint index) {
+		Checkpoint checkpoint;
+		checkpoint.outPos = _outPos;
+		checkpoint.inPos = _wrapped->pos() - _stream.avail_in;
+		checkpoint.bits = _stream.data_type & 7;
+		checkpoint.window = new byte[WINDOWSIZE];
+		for (uint32 i = 0; i < WINDOWSIZE; i++)
+			checkpoint.window[i] = _cache[(_outPos - WINDOWSIZE + i) % CACHESIZE];
+		_checkpoints.insert_at(index, checkpoint);
+	}
+#endif
+
+	/**
+	 * Inflate more data into the cache, up to the end of the cache buffer or
+	 * the end of a deflate block.
+	 *
+	 * @return false if no more data can be inflated.
+	 */
+	bool inflateMore() {
+		if (_zlibErr != Z_OK)
+			return false;
+
+		const uint32 index = _outPos % CACHESIZE;
+		_stream.next_out = _cache + index;
+		_stream.avail_out = CACHESIZE - index;
+
+		if (_stream.avail_in == 0 && !_wrapped->eos()) {
+			// If we are out of input data: Read more data, if available.
+			_stream.next_in = _buf;
+			_stream.avail_in = _wrapped->read(_buf, BUFSIZE);
+		}
+#ifdef ZLIB_SEEK_CHECKPOINTS
+		_zlibErr = inflate(&_stream, Z_BLOCK);
+#else
+		_zlibErr = inflate(&_stream, Z_NO_FLUSH);
+#endif
+
+		const uint32 inflated = CACHESIZE - index - _stream.avail_out;
+		_outPos += inflated;
+		if (_outPos - _cacheStart > CACHESIZE)
+			_cacheStart = _outPos - CACHESIZE;
+
+#ifdef ZLIB_SEEK_CHECKPOINTS
+		// At the end of a deflate block, which isn't the last one, with a
+		// whole window in the cache
+		if (_zlibErr == Z_OK && (_stream.data_type & 128) && !(_stream.data_type & 64) &&
+		        _outPos - _cacheStart >= WINDOWSIZE) {
+			// Checkpoints are sorted. There may be some beyond this position
+			// already, when the stream was restarted after a seek.
+			uint next = _checkpoints.size();
+			while (next > 0 && _checkpoints[next - 1].outPos >= _outPos)
+				next--;
+			const uint32 prevCheckpoint = next > 0 ? _checkpoints[next - 1].outPos : 0;
+			const bool known = next < _checkpoints.size() && _checkpoints[next].outPos == _outPos;
+			if (!known && _outPos >= prevCheckpoint + CHECKPOINTSPAN)
+				addCheckpoint(next);
+		}
+#endif
+
+		return inflated > 0 || _zlibErr == Z_OK;
+	}
+
+	/**
+	 * Inflate the data at the current position straight into the given buffer,
+	 * while the stream hasn't seeked yet.
+	 */
+	uint32 readDirect(byte *dst, uint32 dataSize) {
+		_stream.next_out = dst;
+		_stream.avail_out = dataSize;
+
+		while (_zlibErr == Z_OK && _stream.avail_out) {
+			if (_stream.avail_in == 0 && !_wrapped->eos()) {
+				// If we are out of input data: Read more data, if available.
+				_stream.next_in = _buf;
+				_stream.avail_in = _wrapped->read(_buf, BUFSIZE);
+			}
+			_zlibErr = inflate(&_stream, Z_NO_FLUSH);
+		}
+
+		const uint32 done = dataSize - _stream.avail_out;
+		_outPos += done;
+		_pos += done;
+		return done;
+	}
+
+	/**
+	 * Get the inflated data at the current position into the cache,
+	 * restarting from a checkpoint if that's closer.
+	 */
+	bool fill() {
+		if (_pos < _cacheStart)
+			restart();
+
+#ifdef ZLIB_SEEK_CHECKPOINTS
+		if (_pos >= _outPos) {
+			// Skip ahead to the last checkpoint before the position
+			int checkpoint = (int)_checkpoints.size() - 1;
+			while (checkpoint >= 0 && _checkpoints[checkpoint].outPos > _pos)
+				checkpoint--;
+			if (checkpoint >= 0 && _checkpoints[checkpoint].outPos > _outPos)
+				restoreCheckpoint(_checkpoints[checkpoint]);
+		}
+#endif
+
+		while (_pos >= _outPos) {
+			if (!inflateMore())
+				return false;
+		}
+		return true;
+	}
 
 public:
 
-	GZipReadStream(SeekableReadStream *w, uint32 knownSize = 0) : _wrapped(w), _stream() {
+	GZipReadStream(SeekableReadStream *w, uint32 knownSize = 0) : _cache(0), _wrapped(w), _stream() {
 		assert(w != 0);
 
 		// Verify file header is correct
@@ -180,6 +356,8 @@ public:
 			_origSize = knownSize;
 		}
 		_pos = 0;
+		_outPos = 0;
+		_cacheStart = 0;
 		w->seek(0, SEEK_SET);
 		_eos = false;
 
@@ -199,6 +377,9 @@ public:
 
 	~GZipReadStream() {
 		inflateEnd(&_stream);
+		delete[] _cache;
+		for (uint i = 0; i < _checkpoints.size(); i++)
+			delete[] _checkpoints[i].window;
 	}
 
 	bool err() const { return (_zlibErr != Z_OK) && (_zlibErr != Z_STREAM_END); }
@@ -208,26 +389,24 @@ public:
 	}
 
 	uint32 read(void *dataPtr, uint32 dataSize) {
-		_stream.next_out = (byte *)dataPtr;
-		_stream.avail_out = dataSize;
-
-		// Keep going while we get no error
-		while (_zlibErr == Z_OK && _stream.avail_out) {
-			if (_stream.avail_in == 0 && !_wrapped->eos()) {
-				// If we are out of input data: Read more data, if available.
-				_stream.next_in = _buf;
-				_stream.avail_in = _wrapped->read(_buf, BUFSIZE);
-			}
-			_zlibErr = inflate(&_stream, Z_NO_FLUSH);
+		byte *dst = (byte *)dataPtr;
+		uint32 done = 0;
+
+		if (!_cache)
+			done = readDirect(dst, dataSize);
+
+		while (_cache && done < dataSize && fill()) {
+			const uint32 index = _pos % CACHESIZE;
+			const uint32 count = MIN(MIN(dataSize - done, _outPos - _pos), CACHESIZE - index);
+			memcpy(dst + done, _cache + index, count);
+			done += count;
+			_pos += count;
 		}
 
-		// Update the position counter
-		_pos += dataSize - _stream.avail_out;
-
-		if (_zlibErr == Z_STREAM_END && _stream.avail_out > 0)
+		if (done < dataSize && _zlibErr == Z_STREAM_END)
 			_eos = true;
 
-		return dataSize - _stream.avail_out;
+		return done;
 	}
 
 	bool eos() const {
@@ -241,43 +420,31 @@ public:
 	}
 	bool seek(int32 offset, int whence = SEEK_SET) {
 		int32 newPos = 0;
-		assert(whence != SEEK_END);	// SEEK_END not supported
 		switch (whence) {
 		case SEEK_SET:
 			newPos = offset;
 			break;
 		case SEEK_CUR:
 			newPos = _pos + offset;
+			break;
+		case SEEK_END:
+			// Only possible when the size is known
+			assert(_origSize);
+			newPos = _origSize + offset;
+			break;
 		}
 
 		assert(newPos >= 0);
 
-		if ((uint32)newPos < _pos) {
-			// To search backward, we have to restart the whole decompression
-			// from the start of the file. A rather wasteful operation, best
-			// to avoid it. :/
-#if DEBUG
-			warning("Backward seeking in GZipReadStream detected");
-#endif
-			_pos = 0;
-			_wrapped->seek(0, SEEK_SET);
-			_zlibErr = inflateReset(&_stream);
-			if (_zlibErr != Z_OK)
-				return false;	// FIXME: STREAM REWRITE
-			_stream.next_in = _buf;
-			_stream.avail_in = 0;
-		}
-
-		offset = newPos - _pos;
-
-		// Skip the given amount of data (very inefficient if one tries to skip
-		// huge amounts of data, but usually client code will only skip a few
-		// bytes, so this should be fine.
-		byte tmpBuf[1024];
-		while (!err() && offset > 0) {
-			offset -= read(tmpBuf, MIN((int32)sizeof(tmpBuf), offset));
+		// Set up the cache for seeking. Up to now everything was inflated
+		// straight into the read buffers, so it starts out empty.
+		if (!_cache && (uint32)newPos != _pos) {
+			_cache = new byte[CACHESIZE];
+			_cacheStart = _outPos;
 		}
 
+		// The data gets inflated once it's read
+		_pos = newPos;
 		_eos = false;
 		return true;	// FIXME: STREAM REWRITE
 	}
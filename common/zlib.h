@@ -110,6 +110,10 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
  * the decompressed length at wrap-time, then it can be supplied as knownSize
  * here. knownSize will be ignored if the GZip-stream DOES include a length.
  *
+ * The returned stream can seek in both directions. It remembers points to
+ * restart decompression at while reading, so seeking back doesn't need to
+ * decompress everything from the start again.
+ *
  * It is safe to call this with a NULL parameter (in this case, NULL is
  * returned).
  *
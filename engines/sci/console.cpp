@@ -112,6 +112,9 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	DCmd_Register("list",				WRAP_METHOD(Console, cmdList));
 	DCmd_Register("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	DCmd_Register("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
+	DCmd_Register("prefetch_stats",		WRAP_METHOD(Console, cmdPrefetchStats));
+	DCmd_Register("decompression_bench",	WRAP_METHOD(Console, cmdDecompressionBench));
+	DCmd_Register("mapping_bench",		WRAP_METHOD(Console, cmdMappingBench));
 	// Game
 	DCmd_Register("save_game",			WRAP_METHOD(Console, cmdSaveGame));
 	DCmd_Register("restore_game",		WRAP_METHOD(Console, cmdRestoreGame));
@@ -125,6 +128,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	DCmd_Register("set_palette",		WRAP_METHOD(Console, cmdSetPalette));
 	DCmd_Register("draw_pic",			WRAP_METHOD(Console, cmdDrawPic));
 	DCmd_Register("draw_cel",			WRAP_METHOD(Console, cmdDrawCel));
+	DCmd_Register("pic_bench",			WRAP_METHOD(Console, cmdPicBench));
 	DCmd_Register("undither",           WRAP_METHOD(Console, cmdUndither));
 	DCmd_Register("pic_visualize",		WRAP_METHOD(Console, cmdPicVisualize));
 	DCmd_Register("play_video",         WRAP_METHOD(Console, cmdPlayVideo));
@@ -136,6 +140,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	DCmd_Register("pl",                 WRAP_METHOD(Console, cmdPlaneList));	// alias
 	DCmd_Register("plane_items",        WRAP_METHOD(Console, cmdPlaneItemList));
 	DCmd_Register("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
+	DCmd_Register("frame_stats",        WRAP_METHOD(Console, cmdFrameStats));
 	DCmd_Register("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	DCmd_Register("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -350,6 +355,9 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	DebugPrintf(" list - Lists all the resources of a given type\n");
 	DebugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	DebugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
+	DebugPrintf(" prefetch_stats - Shows how many resource loads the prefetcher took care of\n");
+	DebugPrintf(" decompression_bench - Decompresses all resources and shows the throughput of each compression method\n");
+	DebugPrintf(" mapping_bench - Loads all resources of each volume through a file and from the volume mapped into memory\n");
 	DebugPrintf("\n");
 	DebugPrintf("Game:\n");
 	DebugPrintf(" save_game - Saves the current game state to the hard disk\n");
@@ -365,6 +373,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	DebugPrintf(" set_palette - Sets a palette resource\n");
 	DebugPrintf(" draw_pic - Draws a pic resource\n");
 	DebugPrintf(" draw_cel - Draws a cel from a view resource\n");
+	DebugPrintf(" pic_bench - Times redrawing a pic resource, with and without the picture cache\n");
 	DebugPrintf(" pic_visualize - Enables visualization of the drawing process of EGA pictures\n");
 	DebugPrintf(" undither - Enable/disable undithering\n");
 	DebugPrintf(" play_video - Plays a SEQ, AVI, VMD, RBT or DUK video\n");
@@ -372,6 +381,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	DebugPrintf(" window_list / wl - Shows a list of all the windows (ports) in the draw list (SCI0 - SCI1.1)\n");
 	DebugPrintf(" plane_list / pl - Shows a list of all the planes in the draw list (SCI2+)\n");
 	DebugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
+	DebugPrintf(" frame_stats - Shows how much of the screen kFrameOut had to repaint (SCI2+)\n");
 	DebugPrintf(" saved_bits - List saved bits on the hunk\n");
 	DebugPrintf(" show_saved_bits - Display saved bits\n");
 	DebugPrintf("\n");
@@ -756,6 +766,98 @@ bool Console::cmdRoomNumber(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdPrefetchStats(int argc, const char **argv) {
+	const ResourcePrefetchStats &stats = _engine->getResMan()->getPrefetchStats();
+
+	DebugPrintf("Resources predicted for the next room: %d, still queued: %d\n", stats.queued, _engine->getResMan()->getPrefetchQueueSize());
+	DebugPrintf("Prefetched while the game was waiting: %d\n", stats.prefetched);
+	DebugPrintf("Loads avoided: %d, loads the game still had to wait for: %d\n", stats.hits, stats.stalls);
+	DebugPrintf("Prefetched resources dropped unused: %d\n", stats.wasted);
+	return true;
+}
+
+static const char *getCompressionName(ResourceCompression compression) {
+	switch (compression) {
+	case kCompNone:
+		return "none";
+	case kCompLZW:
+		return "LZW";
+	case kCompHuffman:
+		return "Huffman";
+	case kCompLZW1:
+		return "LZW1";
+	case kCompLZW1View:
+		return "LZW1 (view)";
+	case kCompLZW1Pic:
+		return "LZW1 (pic)";
+#ifdef ENABLE_SCI32
+	case kCompSTACpack:
+		return "STACpack";
+#endif
+	case kCompDCL:
+		return "DCL";
+	default:
+		return "unknown";
+	}
+}
+
+bool Console::cmdDecompressionBench(int argc, const char **argv) {
+	if (argc > 2) {
+		DebugPrintf("Decompresses all resources of the game from memory and shows the throughput of each compression method\n");
+		DebugPrintf("Usage: %s [<count>]\n", argv[0]);
+		DebugPrintf("where <count> is how often each resource gets decompressed (default 10)\n");
+		return true;
+	}
+
+	int count = (argc > 1) ? atoi(argv[1]) : 10;
+	if (count <= 0) {
+		DebugPrintf("Invalid count\n");
+		return true;
+	}
+
+	Common::Array<DecompressionBenchmark> results = _engine->getResMan()->benchmarkDecompression(count);
+
+	DebugPrintf("Each resource decompressed %d times\n", count);
+	for (uint i = 0; i < results.size(); i++) {
+		const DecompressionBenchmark &result = results[i];
+		double megabytes = (double)result.unpackedSize * count / (1024 * 1024);
+
+		DebugPrintf("%-12s %5d resources, %7d KB packed, %7d KB unpacked, %6d ms", getCompressionName(result.compression),
+					result.resources, result.packedSize / 1024, result.unpackedSize / 1024, result.time);
+		if (result.time)
+			DebugPrintf(", %.1f MB/s", megabytes * 1000 / result.time);
+		if (result.failures)
+			DebugPrintf(", %d failed", result.failures);
+		DebugPrintf("\n");
+	}
+	return true;
+}
+
+bool Console::cmdMappingBench(int argc, const char **argv) {
+	if (argc != 1) {
+		DebugPrintf("Loads all resources of each resource volume through a file, then from the volume mapped\n");
+		DebugPrintf("into memory, and shows the time it took and the memory allocated for the resources\n");
+		DebugPrintf("Usage: %s\n", argv[0]);
+		return true;
+	}
+
+	Common::Array<MappingBenchmark> results = _engine->getResMan()->benchmarkMapping();
+
+	for (uint i = 0; i < results.size(); i++) {
+		const MappingBenchmark &result = results[i];
+
+		DebugPrintf("%-16s %5d resources, %7d KB: file %5d ms, %7d KB allocated", result.volume.c_str(),
+					result.resources, result.size / 1024, result.fileTime, result.fileMemory / 1024);
+		if (result.mapped)
+			DebugPrintf("; mapped %5d ms, %7d KB allocated", result.mappedTime, result.mappedMemory / 1024);
+		else
+			DebugPrintf("; can't be mapped");
+		DebugPrintf("\n");
+	}
+	DebugPrintf("Mapped data stays in the system's file cache, and isn't counted as allocated\n");
+	return true;
+}
+
 bool Console::cmdResourceInfo(int argc, const char **argv) {
 	if (argc != 3) {
 		DebugPrintf("Shows information about a resource\n");
@@ -1529,6 +1631,51 @@ bool Console::cmdDrawPic(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdPicBench(int argc, const char **argv) {
+	if (argc < 2) {
+		DebugPrintf("Times redrawing a pic resource, with and without the picture cache\n");
+		DebugPrintf("Usage: %s <resourceId> [<count>]\n", argv[0]);
+		DebugPrintf("where <resourceId> is the number of the pic resource to draw\n");
+		DebugPrintf("and <count> is how often it gets drawn (default 100)\n");
+		return true;
+	}
+
+	if (!_engine->_gfxPaint16) {
+		DebugPrintf("This SCI version does not use the picture cache\n");
+		return true;
+	}
+
+	uint16 resourceId = atoi(argv[1]);
+	int count = (argc > 2) ? atoi(argv[2]) : 100;
+	if (count <= 0) {
+		DebugPrintf("Invalid count\n");
+		return true;
+	}
+
+	GfxCache *cache = _engine->_gfxCache;
+	bool wasEnabled = cache->arePictureRastersEnabled();
+	uint32 hits = cache->_pictureRasterHits;
+	uint32 times[2];
+
+	for (int pass = 0; pass < 2; pass++) {
+		// first pass interprets the picture every time, second one uses the cache
+		cache->enablePictureRasters(pass == 1);
+		uint32 startTime = g_system->getMillis();
+		for (int i = 0; i < count; i++)
+			_engine->_gfxPaint16->kernelDrawPicture(resourceId, 100, false, false, false, 0);
+		times[pass] = g_system->getMillis() - startTime;
+	}
+	hits = cache->_pictureRasterHits - hits;
+	cache->enablePictureRasters(wasEnabled);
+
+	_engine->_gfxScreen->copyToScreen();
+
+	DebugPrintf("pic %d, drawn %d times\n", resourceId, count);
+	DebugPrintf(" interpreted: %d ms (%d us per draw)\n", times[0], times[0] * 1000 / count);
+	DebugPrintf(" cached: %d ms (%d us per draw), %d cache hits\n", times[1], times[1] * 1000 / count, hits);
+	return true;
+}
+
 bool Console::cmdDrawCel(int argc, const char **argv) {
 	if (argc < 4) {
 		DebugPrintf("Draws a cel from a view resource\n");
@@ -1674,6 +1821,19 @@ bool Console::cmdPlaneItemList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameStats(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		_engine->_gfxFrameout->printFrameStats(this);
+	} else {
+		DebugPrintf("This SCI version does not use kFrameOut\n");
+	}
+#else
+	DebugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdSavedBits(int argc, const char **argv) {
 	SegManager *segman = _engine->_gamestate->_segMan;
 	SegmentId id = segman->findSegmentByType(SEG_TYPE_HUNK);
@@ -53,11 +53,26 @@ void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked,
 	_nBits = 0;
 	_dwRead = _dwWrote = 0;
 	_dwBits = 0;
+	_readAheadPos = _readAheadSize = 0;
+	_srcLeft = nPacked;
+}
+
+void Decompressor::fillReadAhead() {
+	// Past the end of the packed data the bit buffer still gets filled up
+	// from whatever follows in _src, so only read as much as it needs there
+	uint32 wanted = _srcLeft ? MIN<uint32>(_srcLeft, kReadAheadSize) : 4;
+	uint32 got = _src->read(_readAhead, wanted);
+	if (got < wanted)
+		memset(_readAhead + got, 0, wanted - got);
+
+	_srcLeft -= MIN<uint32>(_srcLeft, wanted);
+	_readAheadPos = 0;
+	_readAheadSize = wanted;
 }
 
 void Decompressor::fetchBitsMSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << (24 - _nBits);
+		_dwBits |= ((uint32)readPackedByte()) << (24 - _nBits);
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -79,7 +94,7 @@ byte Decompressor::getByteMSB() {
 
 void Decompressor::fetchBitsLSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)readPackedByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -99,9 +114,6 @@ byte Decompressor::getByteLSB() {
 	return getBitsLSB(8);
 }
 
-void Decompressor::putByte(byte b) {
-	_dest[_dwWrote++] = b;
-}
 //-------------------------------
 //  Huffman decompressor
 //-------------------------------
@@ -112,10 +124,11 @@ int DecompressorHuffman::unpack(Common::ReadStream *src, byte *dest, uint32 nPac
 	int16 c;
 	uint16 terminator;
 
-	numnodes = _src->readByte();
-	terminator = _src->readByte() | 0x100;
+	numnodes = readPackedByte();
+	terminator = readPackedByte() | 0x100;
 	_nodes = new byte [numnodes << 1];
-	_src->read(_nodes, numnodes << 1);
+	for (int i = 0; i < (numnodes << 1); i++)
+		_nodes[i] = readPackedByte();
 
 	while ((c = getc2()) != terminator && (c >= 0) && !isFinished())
 		putByte(c);
@@ -128,7 +141,15 @@ int16 DecompressorHuffman::getc2() {
 	byte *node = _nodes;
 	int16 next;
 	while (node[1]) {
-		if (getBitsMSB(1)) {
+		// Take the bits straight from the bit buffer, this is called for
+		// every bit of the packed data
+		if (!_nBits)
+			fetchBitsMSB();
+		uint32 bit = _dwBits & 0x80000000;
+		_dwBits <<= 1;
+		_nBits--;
+
+		if (bit) {
 			next = node[1] & 0x0F; // use lower 4 bits
 			if (next == 0)
 				return getByteMSB() | 0x100;
@@ -217,15 +238,20 @@ int DecompressorLZW::unpackLZW(Common::ReadStream *src, byte *dest, uint32 nPack
 					return SCI_ERROR_DECOMPRESSION_ERROR;
 				}
 				tokenlastlength = tokenlengthlist[token] + 1;
+				uint32 copyLength = tokenlastlength;
 				if (_dwWrote + tokenlastlength > _szUnpacked) {
 					// For me this seems a normal situation, It's necessary to handle it
 					warning("unpackLZW: Trying to write beyond the end of array(len=%d, destctr=%d, tok_len=%d)",
 					        _szUnpacked, _dwWrote, tokenlastlength);
-					for (int i = 0; _dwWrote < _szUnpacked; i++)
-						putByte(dest[tokenlist[token] + i]);
-				} else
-					for (int i = 0; i < tokenlastlength; i++)
-						putByte(dest[tokenlist[token] + i]);
+					copyLength = _szUnpacked - _dwWrote;
+				}
+				// The token may end in the first byte we write, so this
+				// can't be a memcpy()
+				const byte *in = dest + tokenlist[token];
+				byte *out = dest + _dwWrote;
+				for (uint32 i = 0; i < copyLength; i++)
+					*out++ = *in++;
+				_dwWrote += copyLength;
 			} else {
 				tokenlastlength = 1;
 				if (_dwWrote >= _szUnpacked)
@@ -274,6 +300,8 @@ int DecompressorLZW::unpackLZW1(Common::ReadStream *src, byte *dest, uint32 nPac
 	byte decryptstart = 0;
 	uint16 bitstring;
 	uint16 token;
+	uint32 copyLength;
+	byte *out;
 	bool bExit = false;
 
 	while (!isFinished() && !bExit) {
@@ -315,12 +343,14 @@ int DecompressorLZW::unpackLZW1(Common::ReadStream *src, byte *dest, uint32 nPac
 			}
 			lastchar = stak[stakptr++] = token & 0xff;
 			// put stack in buffer
-			while (stakptr > 0) {
-				putByte(stak[--stakptr]);
-				if (_dwWrote == _szUnpacked) {
-					bExit = true;
-					continue;
-				}
+			copyLength = MIN<uint32>(stakptr, _szUnpacked - _dwWrote);
+			out = dest + _dwWrote;
+			for (uint32 i = 0; i < copyLength; i++)
+				*out++ = stak[--stakptr];
+			_dwWrote += copyLength;
+			if (_dwWrote == _szUnpacked) {
+				bExit = true;
+				continue;
 			}
 			// put token into record
 			if (_curtoken <= _endtoken) {
@@ -700,10 +730,14 @@ uint32 DecompressorLZS::getCompLen() {
 }
 
 void DecompressorLZS::copyComp(int offs, uint32 clen) {
-	int hpos = _dwWrote - offs;
-
-	while (clen--)
-		putByte(_dest[hpos++]);
+	// Copy byte by byte, the source may overlap with what gets written
+	const byte *in = _dest + _dwWrote - offs;
+	byte *out = _dest + _dwWrote;
+
+	clen = MIN<uint32>(clen, _szUnpacked - _dwWrote);
+	for (uint32 i = 0; i < clen; i++)
+		*out++ = *in++;
+	_dwWrote += clen;
 }
 
 #endif	// #ifdef ENABLE_SCI32
@@ -94,12 +94,26 @@ protected:
 	void fetchBitsMSB();
 	void fetchBitsLSB();
 
+	/**
+	 * Get the next byte of packed data. The data is read from _src in blocks,
+	 * instead of calling _src->readByte() for every byte.
+	 * @return byte
+	 */
+	byte readPackedByte() {
+		if (_readAheadPos == _readAheadSize)
+			fillReadAhead();
+		return _readAhead[_readAheadPos++];
+	}
+
+	void fillReadAhead();
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
 	 */
-
-	virtual void putByte(byte b);
+	void putByte(byte b) {
+		_dest[_dwWrote++] = b;
+	}
 
 	/**
 	 * Returns true if all expected data has been unpacked to _dest
@@ -117,6 +131,15 @@ protected:
 	uint32 _dwWrote;	///< number of bytes written to _dest
 	Common::ReadStream *_src;
 	byte *_dest;
+
+	enum {
+		kReadAheadSize = 1024
+	};
+
+	byte _readAhead[kReadAheadSize];	///< packed data read from _src, but not yet used
+	uint32 _readAheadPos;	///< position of the next unused byte in _readAhead
+	uint32 _readAheadSize;	///< number of valid bytes in _readAhead
+	uint32 _srcLeft;		///< number of packed bytes not yet read from _src
 };
 
 /**
@@ -131,6 +131,8 @@ void EngineState::reset(bool isRestoring) {
 
 void EngineState::speedThrottler(uint32 neededSleep) {
 	if (_throttleTrigger) {
+		g_sci->getResMan()->setPrefetchRoom(currentRoomNumber());
+
 		uint32 curTime = g_system->getMillis();
 		uint32 duration = curTime - _throttleLastTime;
 
@@ -150,6 +152,7 @@ void EngineState::wait(int16 ticks) {
 	lastWaitTime = time;
 
 	ticks *= g_debug_sleeptime_factor;
+	g_sci->getResMan()->setPrefetchRoom(currentRoomNumber());
 	g_sci->sleep(ticks * 1000 / 60);
 }
 
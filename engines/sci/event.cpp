@@ -327,7 +327,10 @@ void SciEngine::sleep(uint32 msecs) {
 		_eventMan->getSciEvent(SCI_EVENT_PEEK);
 		time = g_system->getMillis();
 		if (time + 10 < wakeup_time) {
-			g_system->delayMillis(10);
+			// Spend the spare time on loading resources we will likely need
+			// soon, and only actually sleep if there is nothing to load
+			if (!_resMan->prefetchStep())
+				g_system->delayMillis(10);
 		} else {
 			if (time < wakeup_time)
 				g_system->delayMillis(wakeup_time - time);
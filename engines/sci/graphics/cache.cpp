@@ -30,17 +30,24 @@
 #include "sci/graphics/cache.h"
 #include "sci/graphics/font.h"
 #include "sci/graphics/fontsjis.h"
+#include "sci/graphics/picture.h"
 #include "sci/graphics/view.h"
 
 namespace Sci {
 
 GfxCache::GfxCache(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette)
 	: _resMan(resMan), _screen(screen), _palette(palette) {
+	_cachedPictureRastersSize = 0;
+	_pictureRasterUseCounter = 0;
+	_pictureRasterHits = 0;
+	_pictureRasterMisses = 0;
+	_pictureRastersEnabled = true;
 }
 
 GfxCache::~GfxCache() {
 	purgeFontCache();
 	purgeViewCache();
+	purgePictureRasterCache();
 }
 
 void GfxCache::purgeFontCache() {
@@ -61,6 +68,65 @@ void GfxCache::purgeViewCache() {
 	_cachedViews.clear();
 }
 
+void GfxCache::purgePictureRasterCache() {
+	for (PictureRasterCache::iterator iter = _cachedPictureRasters.begin(); iter != _cachedPictureRasters.end(); ++iter) {
+		delete iter->_value;
+		iter->_value = 0;
+	}
+
+	_cachedPictureRasters.clear();
+	_cachedPictureRastersSize = 0;
+}
+
+void GfxCache::removePictureRaster(const PictureRasterKey &key) {
+	PictureRaster *raster = _cachedPictureRasters[key];
+	_cachedPictureRastersSize -= raster->bitsSize;
+	delete raster;
+	_cachedPictureRasters.erase(key);
+}
+
+PictureRaster *GfxCache::getPictureRaster(const PictureRasterKey &key) {
+	if (!_pictureRastersEnabled || !_cachedPictureRasters.contains(key)) {
+		_pictureRasterMisses++;
+		return NULL;
+	}
+
+	PictureRaster *raster = _cachedPictureRasters[key];
+	raster->lastUsed = ++_pictureRasterUseCounter;
+	_pictureRasterHits++;
+	return raster;
+}
+
+void GfxCache::addPictureRaster(const PictureRasterKey &key, PictureRaster *raster) {
+	if (!_pictureRastersEnabled || raster->bitsSize > MAX_CACHED_PICTURES_SIZE) {
+		delete raster;
+		return;
+	}
+
+	if (_cachedPictureRasters.contains(key))
+		removePictureRaster(key);
+
+	// Throw out the least recently used rasters, until the new one fits
+	while (_cachedPictureRastersSize + raster->bitsSize > MAX_CACHED_PICTURES_SIZE) {
+		PictureRasterCache::iterator oldest = _cachedPictureRasters.begin();
+		for (PictureRasterCache::iterator iter = _cachedPictureRasters.begin(); iter != _cachedPictureRasters.end(); ++iter) {
+			if (iter->_value->lastUsed < oldest->_value->lastUsed)
+				oldest = iter;
+		}
+		removePictureRaster(oldest->_key);
+	}
+
+	raster->lastUsed = ++_pictureRasterUseCounter;
+	_cachedPictureRasters[key] = raster;
+	_cachedPictureRastersSize += raster->bitsSize;
+}
+
+void GfxCache::enablePictureRasters(bool enable) {
+	_pictureRastersEnabled = enable;
+	if (!enable)
+		purgePictureRasterCache();
+}
+
 GfxFont *GfxCache::getFont(GuiResourceId fontId) {
 	if (_cachedFonts.size() >= MAX_CACHED_FONTS)
 		purgeFontCache();
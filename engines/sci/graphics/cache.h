@@ -29,12 +29,33 @@ namespace Sci {
 
 class GfxFont;
 class GfxView;
+struct PictureRaster;
+
+/**
+ * Identifies the way a picture got drawn, for the picture raster cache
+ */
+struct PictureRasterKey {
+	GuiResourceId pictureId;
+	bool mirrored;
+	int16 EGApaletteNo;
+
+	bool operator==(const PictureRasterKey &other) const {
+		return pictureId == other.pictureId && mirrored == other.mirrored && EGApaletteNo == other.EGApaletteNo;
+	}
+};
+
+struct PictureRasterKey_Hash {
+	uint operator()(const PictureRasterKey &key) const {
+		return (key.pictureId << 8) ^ (key.EGApaletteNo << 1) ^ (key.mirrored ? 1 : 0);
+	}
+};
 
 typedef Common::HashMap<int, GfxFont *> FontCache;
 typedef Common::HashMap<int, GfxView *> ViewCache;
+typedef Common::HashMap<PictureRasterKey, PictureRaster *, PictureRasterKey_Hash> PictureRasterCache;
 
 /**
- * Cache class, handles caching of views/fonts
+ * Cache class, handles caching of views/fonts and of rasterized pictures
  */
 class GfxCache {
 public:
@@ -51,9 +72,24 @@ public:
 
 	byte kernelViewGetColorAtCoordinate(GuiResourceId viewId, int16 loopNo, int16 celNo, int16 x, int16 y);
 
+	/**
+	 * Returns the raster of a picture drawn before with the same parameters,
+	 * or NULL if there is none.
+	 */
+	PictureRaster *getPictureRaster(const PictureRasterKey &key);
+	/** Adds a picture raster, the cache takes ownership of it. */
+	void addPictureRaster(const PictureRasterKey &key, PictureRaster *raster);
+	void enablePictureRasters(bool enable);
+	bool arePictureRastersEnabled() const { return _pictureRastersEnabled; }
+	void purgePictureRasterCache();
+
+	uint32 _pictureRasterHits;
+	uint32 _pictureRasterMisses;
+
 private:
 	void purgeFontCache();
 	void purgeViewCache();
+	void removePictureRaster(const PictureRasterKey &key);
 
 	ResourceManager *_resMan;
 	GfxScreen *_screen;
@@ -61,6 +97,11 @@ private:
 
 	FontCache _cachedFonts;
 	ViewCache _cachedViews;
+
+	PictureRasterCache _cachedPictureRasters;
+	uint32 _cachedPictureRastersSize;
+	uint32 _pictureRasterUseCounter;
+	bool _pictureRastersEnabled;
 };
 
 } // End of namespace Sci
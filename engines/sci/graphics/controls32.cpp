@@ -180,7 +180,7 @@ void GfxControls32::kernelTexteditChange(reg_t controlObject) {
 			// Modify the buffer and show it
 			_text->createTextBitmap(controlObject, 0, 0, hunkId);
 
-			_text->drawTextBitmap(0, 0, nsRect, controlObject);
+			_text->drawTextBitmap(0, 0, nsRect, controlObject, Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight()));
 			//texteditCursorDraw(rect, text.c_str(), cursorPos);	// TODO: Cursor
 			g_system->updateScreen();
 		} else {
@@ -54,6 +54,9 @@ namespace Sci {
 
 // TODO/FIXME: This is all guesswork
 
+// Maximum number of separate dirty rects per frame, before they get merged
+#define MAX_DIRTY_RECTS 16
+
 enum SciSpeciaPlanelPictureCodes {
 	kPlaneTranslucent  = 0xfffe,	// -2
 	kPlanePlainColored = 0xffff		// -1
@@ -66,6 +69,8 @@ GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAd
 	_curScrollText = -1;
 	_showScrollText = false;
 	_maxScrollTexts = 0;
+	_fullRedraw = true;
+	memset(&_stats, 0, sizeof(_stats));
 }
 
 GfxFrameout::~GfxFrameout() {
@@ -77,6 +82,8 @@ void GfxFrameout::clear() {
 	_planes.clear();
 	deletePlanePictures(NULL_REG);
 	clearScrollTexts();
+	_lastFrame.clear();
+	_fullRedraw = true;
 }
 
 void GfxFrameout::clearScrollTexts() {
@@ -579,7 +586,7 @@ bool GfxFrameout::isPictureOutOfView(FrameoutEntry *itemEntry, Common::Rect plan
 	return false;
 }
 
-void GfxFrameout::drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, bool planePictureMirrored) {
+void GfxFrameout::getPictureDrawPosition(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, FrameoutDrawItem &item) {
 	int16 pictureOffsetX = planeOffsetX;
 	int16 pictureX = itemEntry->x;
 	if ((planeOffsetX) || (itemEntry->picStartX)) {
@@ -592,53 +599,67 @@ void GfxFrameout::drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int1
 	}
 
 	int16 pictureOffsetY = planeOffsetY;
-	int16 pictureY = itemEntry->y;
 	if ((planeOffsetY) || (itemEntry->picStartY)) {
 		if (planeOffsetY <= itemEntry->picStartY) {
-			pictureY += itemEntry->picStartY - planeOffsetY;
 			pictureOffsetY = 0;
 		} else {
 			pictureOffsetY = planeOffsetY - itemEntry->picStartY;
 		}
 	}
 
-	itemEntry->picture->drawSci32Vga(itemEntry->celNo, pictureX, itemEntry->y, pictureOffsetX, pictureOffsetY, planePictureMirrored);
-	//	warning("picture cel %d %d", itemEntry->celNo, itemEntry->priority);
+	item.pictureX = pictureX;
+	item.pictureY = itemEntry->y;
+	item.pictureOffsetX = pictureOffsetX;
+	item.pictureOffsetY = pictureOffsetY;
 }
 
-void GfxFrameout::kernelFrameout() {
-	if (g_sci->_robotDecoder->isVideoLoaded()) {
-		showVideo();
-		return;
-	}
+bool FrameoutDrawItem::matches(const FrameoutDrawItem &other) const {
+	return object == other.object && resourceId == other.resourceId &&
+		loopNo == other.loopNo && celNo == other.celNo &&
+		priority == other.priority && givenOrderNr == other.givenOrderNr &&
+		scaleX == other.scaleX && scaleY == other.scaleY &&
+		celRect == other.celRect && clipRect == other.clipRect && drawRect == other.drawRect &&
+		pictureX == other.pictureX && pictureY == other.pictureY &&
+		pictureOffsetX == other.pictureOffsetX && pictureOffsetY == other.pictureOffsetY &&
+		hasText == other.hasText && textX == other.textX && textY == other.textY &&
+		textRect == other.textRect && textChecksum == other.textChecksum;
+}
 
-	_palette->palVaryUpdate();
+bool FrameoutPlaneState::matches(const FrameoutPlaneState &other) const {
+	return object == other.object && priority == other.priority &&
+		pictureId == other.pictureId && planeRect == other.planeRect &&
+		planeOffsetX == other.planeOffsetX && planeOffsetY == other.planeOffsetY &&
+		planeBack == other.planeBack && planePictureMirrored == other.planePictureMirrored &&
+		fill == other.fill && blackout == other.blackout;
+}
 
+// Builds the draw list of the current frame, without drawing anything yet
+void GfxFrameout::buildFrame(FrameoutPlaneStateList &frame) {
 	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++) {
 		reg_t planeObject = it->object;
-
-		// Draw any plane lines, if they exist
-		// These are drawn on invisible planes as well. (e.g. "invisiblePlane" in LSL6 hires)
-		// FIXME: Lines aren't always drawn (e.g. when the narrator speaks in LSL6 hires).
-		// Perhaps something is painted over them?
-		for (PlaneLineList::iterator it2 = it->lines.begin(); it2 != it->lines.end(); ++it2) {
-			Common::Point startPoint = it2->startPoint;
-			Common::Point endPoint = it2->endPoint;
-			_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, it->object);
-			_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, it->object);
-			_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
-		}
-
 		int16 planeLastPriority = it->lastPriority;
 
 		// Update priority here, sq6 sets it w/o UpdatePlane
 		int16 planePriority = it->priority = readSelectorValue(_segMan, planeObject, SELECTOR(priority));
 
 		it->lastPriority = planePriority;
+
+		frame.push_back(FrameoutPlaneState());
+		FrameoutPlaneState &plane = frame.back();
+		plane.object = planeObject;
+		plane.priority = planePriority;
+		plane.pictureId = it->pictureId;
+		plane.planeRect = it->planeRect;
+		plane.planeOffsetX = it->planeOffsetX;
+		plane.planeOffsetY = it->planeOffsetY;
+		plane.planeBack = it->planeBack;
+		plane.planePictureMirrored = it->planePictureMirrored;
+		plane.fill = false;
+		plane.blackout = false;
+
 		if (planePriority < 0) { // Plane currently not meant to be shown
 			// If plane was shown before, delete plane rect
-			if (planePriority != planeLastPriority)
-				_paint32->fillRect(it->planeRect, 0);
+			plane.blackout = (planePriority != planeLastPriority);
 			continue;
 		}
 
@@ -646,10 +667,8 @@ void GfxFrameout::kernelFrameout() {
 		// Since I first wrote the patch, the race has stopped occurring for me though.
 		// I'll leave this for investigation later, when someone can reproduce.
 		//if (it->pictureId == kPlanePlainColored)	// FIXME: This is what SSCI does, and fixes the intro of LSL7, but breaks the dialogs in GK1 (adds black boxes)
-		if (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1))
-			_paint32->fillRect(it->planeRect, it->planeBack);
+		plane.fill = (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1));
 
-		_coordAdjuster->pictureSetDisplayArea(it->planeRect);
 		_palette->drewPicture(it->pictureId);
 
 		FrameoutList itemList;
@@ -662,125 +681,404 @@ void GfxFrameout::kernelFrameout() {
 			if (!itemEntry->visible)
 				continue;
 
+			FrameoutDrawItem item = FrameoutDrawItem();
+			item.object = itemEntry->object;
+			item.celNo = itemEntry->celNo;
+			item.priority = itemEntry->priority;
+
 			if (itemEntry->object.isNull()) {
 				// Picture cel data
 				_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
 				_coordAdjuster->fromScriptToDisplay(itemEntry->picStartY, itemEntry->picStartX);
 
-				if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY))
-					drawPicture(itemEntry, it->planeOffsetX, it->planeOffsetY, it->planePictureMirrored);
-			} else {
-				GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
-				int16 dummyX = 0;
+				if (isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY))
+					continue;
+
+				item.picture = itemEntry->picture;
+				item.resourceId = itemEntry->picture->getResourceId();
+				getPictureDrawPosition(itemEntry, it->planeOffsetX, it->planeOffsetY, item);
+				// Picture cels are clipped to the plane, but we don't know any
+				// better than that without unpacking them
+				item.drawRect = it->planeRect;
+				plane.items.push_back(item);
+				continue;
+			}
+
+			GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
+			int16 dummyX = 0;
+
+			if (view && view->isSci2Hires()) {
+				view->adjustToUpscaledCoordinates(itemEntry->y, itemEntry->x);
+				view->adjustToUpscaledCoordinates(itemEntry->z, dummyX);
+			} else if (getSciVersion() >= SCI_VERSION_2_1) {
+				_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
+				_coordAdjuster->fromScriptToDisplay(itemEntry->z, dummyX);
+			}
 
+			// Adjust according to current scroll position
+			itemEntry->x -= it->planeOffsetX;
+			itemEntry->y -= it->planeOffsetY;
+
+			uint16 useInsetRect = readSelectorValue(_segMan, itemEntry->object, SELECTOR(useInsetRect));
+			if (useInsetRect) {
+				itemEntry->celRect.top = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inTop));
+				itemEntry->celRect.left = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inLeft));
+				itemEntry->celRect.bottom = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inBottom));
+				itemEntry->celRect.right = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inRight));
 				if (view && view->isSci2Hires()) {
-					view->adjustToUpscaledCoordinates(itemEntry->y, itemEntry->x);
-					view->adjustToUpscaledCoordinates(itemEntry->z, dummyX);
+					view->adjustToUpscaledCoordinates(itemEntry->celRect.top, itemEntry->celRect.left);
+					view->adjustToUpscaledCoordinates(itemEntry->celRect.bottom, itemEntry->celRect.right);
+				}
+				itemEntry->celRect.translate(itemEntry->x, itemEntry->y);
+				// TODO: maybe we should clip the cels rect with this, i'm not sure
+				//  the only currently known usage is game menu of gk1
+			} else if (view) {
+				if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
+					view->getCelRect(itemEntry->loopNo, itemEntry->celNo,
+						itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->celRect);
+				else
+					view->getCelScaledRect(itemEntry->loopNo, itemEntry->celNo,
+						itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->scaleX,
+						itemEntry->scaleY, itemEntry->celRect);
+
+				Common::Rect nsRect = itemEntry->celRect;
+				// Translate back to actual coordinate within scrollable plane
+				nsRect.translate(it->planeOffsetX, it->planeOffsetY);
+
+				if (view && view->isSci2Hires()) {
+					view->adjustBackUpscaledCoordinates(nsRect.top, nsRect.left);
+					view->adjustBackUpscaledCoordinates(nsRect.bottom, nsRect.right);
 				} else if (getSciVersion() >= SCI_VERSION_2_1) {
-					_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
-					_coordAdjuster->fromScriptToDisplay(itemEntry->z, dummyX);
+					_coordAdjuster->fromDisplayToScript(nsRect.top, nsRect.left);
+					_coordAdjuster->fromDisplayToScript(nsRect.bottom, nsRect.right);
 				}
 
-				// Adjust according to current scroll position
-				itemEntry->x -= it->planeOffsetX;
-				itemEntry->y -= it->planeOffsetY;
-
-				uint16 useInsetRect = readSelectorValue(_segMan, itemEntry->object, SELECTOR(useInsetRect));
-				if (useInsetRect) {
-					itemEntry->celRect.top = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inTop));
-					itemEntry->celRect.left = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inLeft));
-					itemEntry->celRect.bottom = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inBottom));
-					itemEntry->celRect.right = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inRight));
-					if (view && view->isSci2Hires()) {
-						view->adjustToUpscaledCoordinates(itemEntry->celRect.top, itemEntry->celRect.left);
-						view->adjustToUpscaledCoordinates(itemEntry->celRect.bottom, itemEntry->celRect.right);
-					}
-					itemEntry->celRect.translate(itemEntry->x, itemEntry->y);
-					// TODO: maybe we should clip the cels rect with this, i'm not sure
-					//  the only currently known usage is game menu of gk1
-				} else if (view) {
-					if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-						view->getCelRect(itemEntry->loopNo, itemEntry->celNo,
-							itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->celRect);
-					else
-						view->getCelScaledRect(itemEntry->loopNo, itemEntry->celNo,
-							itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->scaleX,
-							itemEntry->scaleY, itemEntry->celRect);
-
-					Common::Rect nsRect = itemEntry->celRect;
-					// Translate back to actual coordinate within scrollable plane
-					nsRect.translate(it->planeOffsetX, it->planeOffsetY);
-
-					if (view && view->isSci2Hires()) {
-						view->adjustBackUpscaledCoordinates(nsRect.top, nsRect.left);
-						view->adjustBackUpscaledCoordinates(nsRect.bottom, nsRect.right);
-					} else if (getSciVersion() >= SCI_VERSION_2_1) {
-						_coordAdjuster->fromDisplayToScript(nsRect.top, nsRect.left);
-						_coordAdjuster->fromDisplayToScript(nsRect.bottom, nsRect.right);
-					}
+				if (g_sci->getGameId() == GID_PHANTASMAGORIA2) {
+					// HACK: Some (?) objects in Phantasmagoria 2 have no NS rect. Skip them for now.
+					// TODO: Remove once we figure out how Phantasmagoria 2 draws objects on screen.
+					if (lookupSelector(_segMan, itemEntry->object, SELECTOR(nsLeft), NULL, NULL) != kSelectorVariable)
+						continue;
+				}
 
-					if (g_sci->getGameId() == GID_PHANTASMAGORIA2) {
-						// HACK: Some (?) objects in Phantasmagoria 2 have no NS rect. Skip them for now.
-						// TODO: Remove once we figure out how Phantasmagoria 2 draws objects on screen.
-						if (lookupSelector(_segMan, itemEntry->object, SELECTOR(nsLeft), NULL, NULL) != kSelectorVariable)
-							continue;
-					}
+				g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
+			}
 
-					g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
-				}
+			// Don't attempt to draw sprites that are outside the visible
+			// screen area. An example is the random people walking in
+			// Jackson Square in GK1.
+			if (itemEntry->celRect.bottom < 0 || itemEntry->celRect.top  >= _screen->getDisplayHeight() ||
+			    itemEntry->celRect.right  < 0 || itemEntry->celRect.left >= _screen->getDisplayWidth())
+				continue;
 
-				// Don't attempt to draw sprites that are outside the visible
-				// screen area. An example is the random people walking in
-				// Jackson Square in GK1.
-				if (itemEntry->celRect.bottom < 0 || itemEntry->celRect.top  >= _screen->getDisplayHeight() ||
-				    itemEntry->celRect.right  < 0 || itemEntry->celRect.left >= _screen->getDisplayWidth())
+			Common::Rect clipRect, translatedClipRect;
+			clipRect = itemEntry->celRect;
+
+			if (view && view->isSci2Hires()) {
+				clipRect.clip(it->upscaledPlaneClipRect);
+				translatedClipRect = clipRect;
+				translatedClipRect.translate(it->upscaledPlaneRect.left, it->upscaledPlaneRect.top);
+			} else {
+				// QFG4 passes invalid rectangles when a battle is starting
+				if (!clipRect.isValidRect())
 					continue;
+				clipRect.clip(it->planeClipRect);
+				translatedClipRect = clipRect;
+				translatedClipRect.translate(it->planeRect.left, it->planeRect.top);
+			}
 
-				Common::Rect clipRect, translatedClipRect;
-				clipRect = itemEntry->celRect;
+			item.resourceId = itemEntry->viewId;
+			item.givenOrderNr = itemEntry->givenOrderNr;
+			item.loopNo = itemEntry->loopNo;
+			item.scaleX = itemEntry->scaleX;
+			item.scaleY = itemEntry->scaleY;
+			item.celRect = itemEntry->celRect;
+			if (view && !clipRect.isEmpty()) {
+				item.clipRect = clipRect;
+				item.drawRect = translatedClipRect;
+			}
 
-				if (view && view->isSci2Hires()) {
-					clipRect.clip(it->upscaledPlaneClipRect);
-					translatedClipRect = clipRect;
-					translatedClipRect.translate(it->upscaledPlaneRect.left, it->upscaledPlaneRect.top);
-				} else {
-					// QFG4 passes invalid rectangles when a battle is starting
-					if (!clipRect.isValidRect())
-						continue;
-					clipRect.clip(it->planeClipRect);
-					translatedClipRect = clipRect;
-					translatedClipRect.translate(it->planeRect.left, it->planeRect.top);
+			// Draw text, if it exists
+			if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
+				item.hasText = true;
+				item.textX = itemEntry->x;
+				item.textY = itemEntry->y;
+				item.textRect = g_sci->_gfxText32->getTextBitmapRect(itemEntry->x, itemEntry->y, it->planeRect, itemEntry->object, item.textChecksum);
+			}
+
+			plane.items.push_back(item);
+		}
+
+		for (PlanePictureList::iterator pictureIt = _planePictures.begin(); pictureIt != _planePictures.end(); pictureIt++) {
+			if (pictureIt->object == planeObject) {
+				delete[] pictureIt->pictureCels;
+				pictureIt->pictureCels = 0;
+			}
+		}
+	}
+}
+
+// Dirty rect tracking only works if everything on screen is the result of
+// drawing the planes and their items, and redrawing it is a no-op
+bool GfxFrameout::isFrameTrackable() {
+	if (_fullRedraw || _screen->getUpscaledHires())
+		return false;
+
+	// Remapped colors depend on what was on screen before
+	if (_palette->isRemapOn())
+		return false;
+
+	if (_showScrollText && _curScrollText >= 0)
+		return false;
+
+	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++) {
+		if (!it->lines.empty())
+			return false;
+	}
+
+	return true;
+}
+
+void GfxFrameout::addDirtyRect(const Common::Rect &rect) {
+	Common::Rect dirtyRect = rect.findIntersectingRect(Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight()));
+	if (dirtyRect.isEmpty())
+		return;
+
+	// Merge overlapping rects, so that no pixel gets repainted twice
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		if (_dirtyRects[i].contains(dirtyRect))
+			return;
+
+		if (_dirtyRects[i].intersects(dirtyRect)) {
+			dirtyRect.extend(_dirtyRects.remove_at(i));
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	// Too many separate rects cost more than they save
+	if (_dirtyRects.size() >= MAX_DIRTY_RECTS) {
+		for (i = 0; i < _dirtyRects.size(); i++)
+			dirtyRect.extend(_dirtyRects[i]);
+		_dirtyRects.clear();
+	}
+
+	_dirtyRects.push_back(dirtyRect);
+}
+
+void GfxFrameout::addDirtyPlane(const FrameoutPlaneState &plane) {
+	addDirtyRect(plane.planeRect);
+
+	for (FrameoutDrawList::const_iterator it = plane.items.begin(); it != plane.items.end(); ++it) {
+		addDirtyRect(it->drawRect);
+		addDirtyRect(it->textRect);
+	}
+}
+
+// Compares the draw list of the current frame with the one of the previous
+// frame, and marks every screen area where something changed as dirty
+void GfxFrameout::computeDirtyRects(const FrameoutPlaneStateList &frame) {
+	const uint planeCount = MAX(frame.size(), _lastFrame.size());
+
+	for (uint planeNr = 0; planeNr < planeCount; planeNr++) {
+		if (planeNr >= frame.size()) {
+			addDirtyPlane(_lastFrame[planeNr]);
+			continue;
+		}
+		if (planeNr >= _lastFrame.size()) {
+			addDirtyPlane(frame[planeNr]);
+			continue;
+		}
+
+		const FrameoutPlaneState &plane = frame[planeNr];
+		const FrameoutPlaneState &lastPlane = _lastFrame[planeNr];
+
+		if (!plane.matches(lastPlane)) {
+			addDirtyPlane(lastPlane);
+			addDirtyPlane(plane);
+			continue;
+		}
+
+		// Same plane, so only items which got added, removed or changed need
+		// to be redrawn. Items usually stay at the same list position.
+		Common::Array<bool> lastItemMatched;
+		lastItemMatched.resize(lastPlane.items.size());
+		for (uint itemNr = 0; itemNr < lastItemMatched.size(); itemNr++)
+			lastItemMatched[itemNr] = false;
+
+		for (uint itemNr = 0; itemNr < plane.items.size(); itemNr++) {
+			const FrameoutDrawItem &item = plane.items[itemNr];
+			bool found = false;
+
+			if (itemNr < lastPlane.items.size() && item.matches(lastPlane.items[itemNr])) {
+				lastItemMatched[itemNr] = true;
+				found = true;
+			} else {
+				for (uint lastItemNr = 0; lastItemNr < lastPlane.items.size(); lastItemNr++) {
+					if (!lastItemMatched[lastItemNr] && item.matches(lastPlane.items[lastItemNr])) {
+						lastItemMatched[lastItemNr] = true;
+						found = true;
+						break;
+					}
 				}
+			}
 
-				if (view) {
+			if (!found) {
+				addDirtyRect(item.drawRect);
+				addDirtyRect(item.textRect);
+			}
+		}
+
+		for (uint lastItemNr = 0; lastItemNr < lastPlane.items.size(); lastItemNr++) {
+			if (!lastItemMatched[lastItemNr]) {
+				addDirtyRect(lastPlane.items[lastItemNr].drawRect);
+				addDirtyRect(lastPlane.items[lastItemNr].textRect);
+			}
+		}
+	}
+}
+
+// Repaints everything inside the current dirty rects
+void GfxFrameout::drawFrame(const FrameoutPlaneStateList &frame) {
+	// The frame was built from the plane list, so both are in the same order
+	PlaneList::const_iterator it = _planes.begin();
+
+	for (FrameoutPlaneStateList::const_iterator plane = frame.begin(); plane != frame.end(); ++plane, ++it) {
+		// Draw any plane lines, if they exist
+		// These are drawn on invisible planes as well. (e.g. "invisiblePlane" in LSL6 hires)
+		// FIXME: Lines aren't always drawn (e.g. when the narrator speaks in LSL6 hires).
+		// Perhaps something is painted over them?
+		for (PlaneLineList::const_iterator it2 = it->lines.begin(); it2 != it->lines.end(); ++it2) {
+			Common::Point startPoint = it2->startPoint;
+			Common::Point endPoint = it2->endPoint;
+			_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, it->object);
+			_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, it->object);
+			_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
+		}
+
+		if (plane->priority < 0) {
+			if (plane->blackout) {
+				for (uint i = 0; i < _dirtyRects.size(); i++)
+					_paint32->fillRect(plane->planeRect.findIntersectingRect(_dirtyRects[i]), 0);
+			}
+			continue;
+		}
+
+		if (plane->fill) {
+			for (uint i = 0; i < _dirtyRects.size(); i++)
+				_paint32->fillRect(plane->planeRect.findIntersectingRect(_dirtyRects[i]), plane->planeBack);
+		}
+
+		_coordAdjuster->pictureSetDisplayArea(plane->planeRect);
+
+		for (FrameoutDrawList::const_iterator item = plane->items.begin(); item != plane->items.end(); ++item) {
+			bool drawn = false;
+
+			if (item->picture) {
+				for (uint i = 0; i < _dirtyRects.size(); i++) {
+					Common::Rect clipRect = item->drawRect.findIntersectingRect(_dirtyRects[i]);
 					if (!clipRect.isEmpty()) {
-						if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-							view->draw(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, 0, view->isSci2Hires());
-						else
-							view->drawScaled(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, itemEntry->scaleX, itemEntry->scaleY);
+						item->picture->drawSci32Vga(item->celNo, item->pictureX, item->pictureY,
+							item->pictureOffsetX, item->pictureOffsetY, plane->planePictureMirrored, clipRect);
+						drawn = true;
 					}
 				}
+				// The picture palette gets set, even if nothing gets drawn
+				if (!drawn)
+					item->picture->drawSci32Vga(item->celNo, item->pictureX, item->pictureY,
+						item->pictureOffsetX, item->pictureOffsetY, plane->planePictureMirrored, Common::Rect());
+				continue;
+			}
+
+			// Views are looked up again, as the cache may have been purged
+			// while building the frame
+			GfxView *view = (item->resourceId != 0xFFFF) ? _cache->getView(item->resourceId) : NULL;
+
+			if (view && !item->drawRect.isEmpty()) {
+				for (uint i = 0; i < _dirtyRects.size(); i++) {
+					Common::Rect translatedClipRect = item->drawRect.findIntersectingRect(_dirtyRects[i]);
+					if (translatedClipRect.isEmpty())
+						continue;
 
-				// Draw text, if it exists
-				if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
-					g_sci->_gfxText32->drawTextBitmap(itemEntry->x, itemEntry->y, it->planeRect, itemEntry->object);
+					Common::Rect clipRect = translatedClipRect;
+					clipRect.translate(item->clipRect.left - item->drawRect.left, item->clipRect.top - item->drawRect.top);
+
+					if ((item->scaleX == 128) && (item->scaleY == 128))
+						view->draw(item->celRect, clipRect, translatedClipRect,
+							item->loopNo, item->celNo, 255, 0, view->isSci2Hires());
+					else
+						view->drawScaled(item->celRect, clipRect, translatedClipRect,
+							item->loopNo, item->celNo, 255, item->scaleX, item->scaleY);
+					drawn = true;
 				}
 			}
-		}
 
-		for (PlanePictureList::iterator pictureIt = _planePictures.begin(); pictureIt != _planePictures.end(); pictureIt++) {
-			if (pictureIt->object == planeObject) {
-				delete[] pictureIt->pictureCels;
-				pictureIt->pictureCels = 0;
+			// Merge in the view palette, like drawing the view would have done
+			if (view && !drawn) {
+				Palette *viewPalette = view->getPalette();
+				if (viewPalette)
+					_palette->set(viewPalette, false);
+			}
+
+			if (item->hasText) {
+				for (uint i = 0; i < _dirtyRects.size(); i++) {
+					if (item->textRect.intersects(_dirtyRects[i]))
+						g_sci->_gfxText32->drawTextBitmap(item->textX, item->textY, plane->planeRect, item->object, _dirtyRects[i]);
+				}
 			}
 		}
 	}
+}
+
+void GfxFrameout::kernelFrameout() {
+	if (g_sci->_robotDecoder->isVideoLoaded()) {
+		showVideo();
+		// The video was drawn directly to the screen
+		_fullRedraw = true;
+		return;
+	}
+
+	_palette->palVaryUpdate();
+
+	FrameoutPlaneStateList frame;
+	buildFrame(frame);
+
+	const Common::Rect screenRect(_screen->getDisplayWidth(), _screen->getDisplayHeight());
+	const bool trackable = isFrameTrackable();
+
+	_dirtyRects.clear();
+	if (trackable)
+		computeDirtyRects(frame);
+	else
+		_dirtyRects.push_back(screenRect);
+
+	drawFrame(frame);
 
 	showCurrentScrollText();
 
-	_screen->copyToScreen();
+	uint32 pixels = 0;
+	if (trackable) {
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			_screen->copyRectToScreen(_dirtyRects[i]);
+			pixels += _dirtyRects[i].width() * _dirtyRects[i].height();
+		}
+	} else {
+		_screen->copyToScreen();
+		pixels = screenRect.width() * screenRect.height();
+	}
+
+	_stats.frames++;
+	if (!trackable)
+		_stats.fullFrames++;
+	else if (_dirtyRects.empty())
+		_stats.skippedFrames++;
+	_stats.lastPixels = pixels;
+	_stats.maxPixels = MAX(_stats.maxPixels, pixels);
+	debugC(4, kDebugLevelGraphics, "kFrameOut: %d dirty rects, %d pixels repainted", _dirtyRects.size(), pixels);
+
+	_lastFrame = frame;
+	_fullRedraw = false;
 
 	g_sci->getEngineState()->_throttleTrigger = true;
 }
@@ -835,4 +1133,13 @@ void GfxFrameout::printPlaneItemList(Console *con, reg_t planeObject) {
 	}
 }
 
+void GfxFrameout::printFrameStats(Console *con) {
+	const uint32 screenPixels = _screen->getDisplayWidth() * _screen->getDisplayHeight();
+
+	con->DebugPrintf("Frames: %d, unchanged: %d, fully repainted: %d\n",
+						_stats.frames, _stats.skippedFrames, _stats.fullFrames);
+	con->DebugPrintf("Pixels repainted by the last frame: %d (%d%% of the screen), most in one frame: %d\n",
+						_stats.lastPixels, _stats.lastPixels * 100 / screenPixels, _stats.maxPixels);
+}
+
 } // End of namespace Sci
@@ -97,6 +97,74 @@ struct ScrollTextEntry {
 
 typedef Common::Array<ScrollTextEntry> ScrollTextList;
 
+/**
+ * Everything a single screen item or plane picture cel contributed to the
+ * screen during a kFrameOut call. The draw list of the previous frame is
+ * retained, so that only the screen areas which actually changed have to be
+ * repainted.
+ */
+struct FrameoutDrawItem {
+	reg_t object;	// NULL_REG for plane picture cels
+	GfxPicture *picture;	// only valid during the frame it was drawn in
+	GuiResourceId resourceId;
+	uint16 givenOrderNr;
+	int16 loopNo;
+	int16 celNo;
+	int16 priority;
+	int16 scaleX;
+	int16 scaleY;
+	Common::Rect celRect;
+	Common::Rect clipRect;
+	Common::Rect drawRect;	// clipRect translated to display coordinates
+	// Plane picture cels
+	int16 pictureX;
+	int16 pictureY;
+	int16 pictureOffsetX;
+	int16 pictureOffsetY;
+	// Text bitmaps of screen items
+	bool hasText;
+	int16 textX;
+	int16 textY;
+	Common::Rect textRect;
+	uint32 textChecksum;
+
+	bool matches(const FrameoutDrawItem &other) const;
+};
+
+typedef Common::Array<FrameoutDrawItem> FrameoutDrawList;
+
+/**
+ * State of a plane during a kFrameOut call, including the items drawn on it.
+ */
+struct FrameoutPlaneState {
+	reg_t object;
+	int16 priority;
+	GuiResourceId pictureId;
+	Common::Rect planeRect;
+	int16 planeOffsetX;
+	int16 planeOffsetY;
+	byte planeBack;
+	bool planePictureMirrored;
+	bool fill;		// plane gets filled with planeBack before drawing its items
+	bool blackout;	// plane got hidden in this frame and gets filled with black
+	FrameoutDrawList items;
+
+	bool matches(const FrameoutPlaneState &other) const;
+};
+
+typedef Common::Array<FrameoutPlaneState> FrameoutPlaneStateList;
+
+/**
+ * Statistics on the screen areas repainted by kFrameOut
+ */
+struct FrameoutStats {
+	uint32 frames;			// kFrameOut calls
+	uint32 skippedFrames;	// kFrameOut calls where nothing on screen changed
+	uint32 fullFrames;		// kFrameOut calls which repainted the whole screen
+	uint32 lastPixels;		// pixels repainted during the last kFrameOut call
+	uint32 maxPixels;		// most pixels repainted by a single kFrameOut call
+};
+
 class GfxCache;
 class GfxCoordAdjuster32;
 class GfxPaint32;
@@ -142,12 +210,25 @@ public:
 
 	void printPlaneList(Console *con);
 	void printPlaneItemList(Console *con, reg_t planeObject);
+	void printFrameStats(Console *con);
+
+	/**
+	 * Forces the next kFrameOut call to repaint the whole screen. Needs to be
+	 * called whenever something other than kFrameOut drew to the screen.
+	 */
+	void invalidate() { _fullRedraw = true; }
 
 private:
 	void showVideo();
 	void createPlaneItemList(reg_t planeObject, FrameoutList &itemList);
 	bool isPictureOutOfView(FrameoutEntry *itemEntry, Common::Rect planeRect, int16 planeOffsetX, int16 planeOffsetY);
-	void drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, bool planePictureMirrored);
+	void getPictureDrawPosition(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, FrameoutDrawItem &item);
+	void buildFrame(FrameoutPlaneStateList &frame);
+	bool isFrameTrackable();
+	void addDirtyRect(const Common::Rect &rect);
+	void addDirtyPlane(const FrameoutPlaneState &plane);
+	void computeDirtyRects(const FrameoutPlaneStateList &frame);
+	void drawFrame(const FrameoutPlaneStateList &frame);
 
 	SegManager *_segMan;
 	ResourceManager *_resMan;
@@ -165,6 +246,12 @@ private:
 	bool _showScrollText;
 	uint16 _maxScrollTexts;
 
+	// Retained draw list of the last frame, used for dirty rect tracking
+	FrameoutPlaneStateList _lastFrame;
+	Common::Array<Common::Rect> _dirtyRects;
+	bool _fullRedraw;
+	FrameoutStats _stats;
+
 	void sortPlanes();
 };
 
@@ -60,15 +60,61 @@ void GfxPaint16::debugSetEGAdrawingVisualize(bool state) {
 }
 
 void GfxPaint16::drawPicture(GuiResourceId pictureId, int16 animationNr, bool mirroredFlag, bool addToFlag, GuiResourceId paletteId) {
+	// Drawing a picture onto a cleared port always gives the same result, so
+	//  we keep the outcome around and just copy it back the next time. Adding
+	//  to a picture depends on what is on screen already, so that's not cached.
+	Common::Rect portRect = _ports->_curPort->rect;
+	_ports->offsetRect(portRect);
+	portRect.clip(_screen->getWidth(), _screen->getHeight());
+	bool cacheRaster = !addToFlag && !_EGAdrawingVisualize && _ports->_curPort->penMode != 2
+		&& portRect.left == 0 && portRect.right == _screen->getWidth() && portRect.bottom == _screen->getHeight()
+		&& _cache->arePictureRastersEnabled();
+	PictureRasterKey rasterKey;
+	rasterKey.pictureId = pictureId;
+	rasterKey.mirrored = mirroredFlag;
+	rasterKey.EGApaletteNo = paletteId;
+
+	if (cacheRaster) {
+		PictureRaster *raster = _cache->getPictureRaster(rasterKey);
+		if (raster && raster->portRect == portRect && raster->undithering == _screen->isUnditheringEnabled()) {
+			_screen->bitsRestore(raster->bits);
+			if (raster->ditheredPicColors)
+				memcpy(_screen->unditherGetDitheredBgColors(), raster->ditheredPicColors, DITHERED_BG_COLORS_SIZE * sizeof(int16));
+			GfxPicture::replayEffects(raster, _ports, _palette);
+			if (getSciVersion() == SCI_VERSION_1_1)
+				_palette->drewPicture(pictureId);
+			return;
+		}
+	}
+
 	GfxPicture *picture = new GfxPicture(_resMan, _coordAdjuster, _ports, _screen, _palette, pictureId, _EGAdrawingVisualize);
+	PictureRaster *raster = NULL;
 
 	// do we add to a picture? if not -> clear screen with white
 	if (!addToFlag)
 		clearScreen(_screen->getColorWhite());
 
+	if (cacheRaster) {
+		raster = new PictureRaster();
+		picture->recordEffects(raster);
+	}
+
 	picture->draw(animationNr, mirroredFlag, addToFlag, paletteId);
 	delete picture;
 
+	if (raster) {
+		raster->portRect = portRect;
+		raster->undithering = _screen->isUnditheringEnabled();
+		raster->bitsSize = _screen->bitsGetDataSize(portRect, GFX_SCREEN_MASK_ALL);
+		raster->bits = new byte[raster->bitsSize];
+		_screen->bitsSave(portRect, GFX_SCREEN_MASK_ALL, raster->bits);
+		if (raster->undithering) {
+			raster->ditheredPicColors = new int16[DITHERED_BG_COLORS_SIZE];
+			memcpy(raster->ditheredPicColors, _screen->unditherGetDitheredBgColors(), DITHERED_BG_COLORS_SIZE * sizeof(int16));
+		}
+		_cache->addPictureRaster(rasterKey, raster);
+	}
+
 	// We make a call to SciPalette here, for increasing sys timestamp and also loading targetpalette, if palvary active
 	//  (SCI1.1 only)
 	if (getSciVersion() == SCI_VERSION_1_1)
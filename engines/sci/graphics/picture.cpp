@@ -38,6 +38,8 @@ namespace Sci {
 GfxPicture::GfxPicture(ResourceManager *resMan, GfxCoordAdjuster *coordAdjuster, GfxPorts *ports, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId, bool EGAdrawingVisualize)
 	: _resMan(resMan), _coordAdjuster(coordAdjuster), _ports(ports), _screen(screen), _palette(palette), _resourceId(resourceId), _EGAdrawingVisualize(EGAdrawingVisualize) {
 	assert(resourceId != -1);
+	_clipRect = Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight());
+	_raster = 0;
 	initData(resourceId);
 }
 
@@ -77,7 +79,7 @@ void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int1
 #ifdef ENABLE_SCI32
 	case 0x0e: // SCI32 VGA picture
 		_resourceType = SCI_PICTURE_TYPE_SCI32;
-		drawSci32Vga(0, 0, 0, 0, 0, false);
+		drawSci32Vga(0, 0, 0, 0, 0, false, Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight()));
 		break;
 #endif
 	default:
@@ -130,7 +132,7 @@ void GfxPicture::drawSci11Vga() {
 	if (has_cel) {
 		// Create palette and set it
 		_palette->createFromData(inbuffer + palette_data_ptr, size - palette_data_ptr, &palette);
-		_palette->set(&palette, true);
+		setPalette(&palette);
 
 		drawCelData(inbuffer, size, cel_headerPos, cel_RlePos, cel_LiteralPos, 0, 0, 0, 0);
 	}
@@ -139,7 +141,7 @@ void GfxPicture::drawSci11Vga() {
 	drawVectorData(inbuffer + vector_dataPos, vector_size);
 
 	// Set priority band information
-	_ports->priorityBandsInitSci11(inbuffer + 40);
+	priorityBandsInitSci11(inbuffer + 40);
 }
 
 #ifdef ENABLE_SCI32
@@ -184,7 +186,7 @@ int16 GfxPicture::getSci32celPriority(int16 celNo) {
 	return READ_SCI11ENDIAN_UINT16(inbuffer + cel_headerPos + 36);
 }
 
-void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictureX, int16 pictureY, bool mirrored) {
+void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictureX, int16 pictureY, bool mirrored, const Common::Rect &clipRect) {
 	byte *inbuffer = _resource->data;
 	int size = _resource->size;
 	int header_size = READ_SCI11ENDIAN_UINT16(inbuffer);
@@ -205,6 +207,10 @@ void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictu
 		_palette->set(&palette, true);
 	}
 
+	// Nothing of this cel needs to get redrawn, so don't bother unpacking it
+	if (clipRect.isEmpty())
+		return;
+
 	// Header
 	// [headerSize:WORD] [celCount:BYTE] [Unknown:BYTE] [Unknown:WORD] [paletteOffset:DWORD] [Unknown:DWORD]
 	// cel-header follow afterwards, each is 42 bytes
@@ -224,7 +230,9 @@ void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictu
 	cel_RlePos = READ_SCI11ENDIAN_UINT32(inbuffer + cel_headerPos + 24);
 	cel_LiteralPos = READ_SCI11ENDIAN_UINT32(inbuffer + cel_headerPos + 28);
 
+	_clipRect = clipRect;
 	drawCelData(inbuffer, size, cel_headerPos, cel_RlePos, cel_LiteralPos, drawX, drawY, pictureX, pictureY);
+	_clipRect = Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight());
 	cel_headerPos += 42;
 }
 #endif
@@ -363,7 +371,7 @@ void GfxPicture::drawCelData(byte *inbuffer, int size, int headerPos, int rlePos
 			x = leftX;
 			while (y < lastY) {
 				curByte = *ptr++;
-				if ((curByte != clearColor) && (priority >= _screen->getPriority(x, y)))
+				if ((curByte != clearColor) && _clipRect.contains(x, y) && (priority >= _screen->getPriority(x, y)))
 					_screen->putPixel(x, y, drawMask, curByte, priority, 0);
 
 				x++;
@@ -379,7 +387,7 @@ void GfxPicture::drawCelData(byte *inbuffer, int size, int headerPos, int rlePos
 			x = rightX - 1;
 			while (y < lastY) {
 				curByte = *ptr++;
-				if ((curByte != clearColor) && (priority >= _screen->getPriority(x, y)))
+				if ((curByte != clearColor) && _clipRect.contains(x, y) && (priority >= _screen->getPriority(x, y)))
 					_screen->putPixel(x, y, drawMask, curByte, priority, 0);
 
 				if (x == leftX) {
@@ -742,7 +750,7 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 					curPos += size;
 					break;
 				case PIC_OPX_EGA_SET_PRIORITY_TABLE:
-					_ports->priorityBandsInit(data + curPos);
+					priorityBandsInit(data + curPos);
 					curPos += 14;
 					break;
 				default:
@@ -765,7 +773,7 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 							curPos += 256 + 4 + 1024;
 						} else {
 							// Setting half of the Amiga palette
-							_palette->modifyAmigaPalette(&data[curPos]);
+							modifyAmigaPalette(&data[curPos]);
 							curPos += 32;
 						}
 					} else {
@@ -774,7 +782,7 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 							palette.colors[i].used = data[curPos++];
 							palette.colors[i].r = data[curPos++]; palette.colors[i].g = data[curPos++]; palette.colors[i].b = data[curPos++];
 						}
-						_palette->set(&palette, true);
+						setPalette(&palette);
 					}
 					break;
 				case PIC_OPX_VGA_EMBEDDED_VIEW: // draw cel
@@ -785,11 +793,11 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 					curPos += size;
 					break;
 				case PIC_OPX_VGA_PRIORITY_TABLE_EQDIST:
-					_ports->priorityBandsInit(-1, READ_LE_UINT16(data + curPos), READ_LE_UINT16(data + curPos + 2));
+					priorityBandsInit(-1, READ_LE_UINT16(data + curPos), READ_LE_UINT16(data + curPos + 2));
 					curPos += 4;
 					break;
 				case PIC_OPX_VGA_PRIORITY_TABLE_EXPLICIT:
-					_ports->priorityBandsInit(data + curPos);
+					priorityBandsInit(data + curPos);
 					curPos += 14;
 					break;
 				default:
@@ -829,6 +837,84 @@ void GfxPicture::drawVectorData(byte *data, int dataSize) {
 	error("picture vector data without terminator");
 }
 
+// The following wrap everything drawing a picture changes besides the screen,
+// so that it can be recorded for PictureRaster
+void GfxPicture::setPalette(Palette *palette) {
+	if (_raster) {
+		PictureRasterEffect effect;
+		effect.type = kPictureRasterSetPalette;
+		effect.palette = *palette;
+		_raster->effects.push_back(effect);
+	}
+	_palette->set(palette, true);
+}
+
+void GfxPicture::modifyAmigaPalette(byte *data) {
+	if (_raster) {
+		PictureRasterEffect effect;
+		effect.type = kPictureRasterModifyAmigaPalette;
+		memcpy(effect.data, data, 32);
+		_raster->effects.push_back(effect);
+	}
+	_palette->modifyAmigaPalette(data);
+}
+
+void GfxPicture::priorityBandsInit(byte *data) {
+	if (_raster) {
+		PictureRasterEffect effect;
+		effect.type = kPictureRasterPriorityBands;
+		memcpy(effect.data, data, 14);
+		_raster->effects.push_back(effect);
+	}
+	_ports->priorityBandsInit(data);
+}
+
+void GfxPicture::priorityBandsInit(int16 bandCount, int16 top, int16 bottom) {
+	assert(bandCount == -1);
+	if (_raster) {
+		PictureRasterEffect effect;
+		effect.type = kPictureRasterPriorityBandsRange;
+		effect.top = top;
+		effect.bottom = bottom;
+		_raster->effects.push_back(effect);
+	}
+	_ports->priorityBandsInit(bandCount, top, bottom);
+}
+
+void GfxPicture::priorityBandsInitSci11(byte *data) {
+	if (_raster) {
+		PictureRasterEffect effect;
+		effect.type = kPictureRasterPriorityBandsSci11;
+		memcpy(effect.data, data, 28);
+		_raster->effects.push_back(effect);
+	}
+	_ports->priorityBandsInitSci11(data);
+}
+
+void GfxPicture::replayEffects(const PictureRaster *raster, GfxPorts *ports, GfxPalette *palette) {
+	for (uint i = 0; i < raster->effects.size(); i++) {
+		PictureRasterEffect effect = raster->effects[i];
+
+		switch (effect.type) {
+		case kPictureRasterSetPalette:
+			palette->set(&effect.palette, true);
+			break;
+		case kPictureRasterModifyAmigaPalette:
+			palette->modifyAmigaPalette(effect.data);
+			break;
+		case kPictureRasterPriorityBands:
+			ports->priorityBandsInit(effect.data);
+			break;
+		case kPictureRasterPriorityBandsRange:
+			ports->priorityBandsInit(-1, effect.top, effect.bottom);
+			break;
+		case kPictureRasterPriorityBandsSci11:
+			ports->priorityBandsInitSci11(effect.data);
+			break;
+		}
+	}
+}
+
 bool GfxPicture::vectorIsNonOpcode(byte pixel) {
 	if (pixel >= PIC_OP_FIRST)
 		return false;
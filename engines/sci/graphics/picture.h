@@ -23,6 +23,9 @@
 #ifndef SCI_GRAPHICS_PICTURE_H
 #define SCI_GRAPHICS_PICTURE_H
 
+#include "common/array.h"
+#include "sci/graphics/helpers.h"
+
 namespace Sci {
 
 #define SCI_PATTERN_CODE_RECTANGLE 0x10
@@ -39,6 +42,43 @@ class GfxPorts;
 class GfxScreen;
 class GfxPalette;
 
+enum PictureRasterEffectType {
+	kPictureRasterSetPalette,
+	kPictureRasterModifyAmigaPalette,
+	kPictureRasterPriorityBands,
+	kPictureRasterPriorityBandsRange,
+	kPictureRasterPriorityBandsSci11
+};
+
+/**
+ * Something drawing a picture changed besides the screen, which needs to be
+ * done again when the picture gets restored from its raster.
+ */
+struct PictureRasterEffect {
+	PictureRasterEffectType type;
+	Palette palette;
+	byte data[32];
+	int16 top, bottom;
+};
+
+/**
+ * The result of drawing a picture onto a cleared port, so that drawing the
+ * same picture again can be done by copying it back instead of interpreting
+ * the picture again.
+ */
+struct PictureRaster {
+	PictureRaster() : bits(0), bitsSize(0), ditheredPicColors(0), lastUsed(0) {}
+	~PictureRaster() { delete[] bits; delete[] ditheredPicColors; }
+
+	Common::Rect portRect;	// the cleared area the picture got drawn into
+	bool undithering;
+	byte *bits;				// visual/priority/control data from GfxScreen::bitsSave()
+	int bitsSize;
+	int16 *ditheredPicColors;	// only set when undithering
+	Common::Array<PictureRasterEffect> effects;
+	uint32 lastUsed;
+};
+
 /**
  * Picture class, handles loading and displaying of picture resources
  *  every picture resource has its own instance of this class
@@ -50,6 +90,8 @@ public:
 
 	GuiResourceId getResourceId();
 	void draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int16 EGApaletteNo);
+	void recordEffects(PictureRaster *raster) { _raster = raster; }
+	static void replayEffects(const PictureRaster *raster, GfxPorts *ports, GfxPalette *palette);
 
 #ifdef ENABLE_SCI32
 	int16 getSci32celCount();
@@ -58,7 +100,7 @@ public:
 	int16 getSci32celWidth(int16 celNo);
 	int16 getSci32celHeight(int16 celNo);
 	int16 getSci32celPriority(int16 celNo);
-	void drawSci32Vga(int16 celNo, int16 callerX, int16 callerY, int16 pictureX, int16 pictureY, bool mirrored);
+	void drawSci32Vga(int16 celNo, int16 callerX, int16 callerY, int16 pictureX, int16 pictureY, bool mirrored, const Common::Rect &clipRect);
 #endif
 
 private:
@@ -80,6 +122,12 @@ private:
 	void vectorPatternCircle(Common::Rect box, byte size, byte color, byte prio, byte control);
 	void vectorPatternTexturedCircle(Common::Rect box, byte size, byte color, byte prio, byte control, byte texture);
 
+	void setPalette(Palette *palette);
+	void modifyAmigaPalette(byte *data);
+	void priorityBandsInit(byte *data);
+	void priorityBandsInit(int16 bandCount, int16 top, int16 bottom);
+	void priorityBandsInitSci11(byte *data);
+
 	ResourceManager *_resMan;
 	GfxCoordAdjuster *_coordAdjuster;
 	GfxPorts *_ports;
@@ -96,6 +144,12 @@ private:
 	int16 _EGApaletteNo;
 	byte _priority;
 
+	// Only pixels inside this rect (display coordinates) get drawn
+	Common::Rect _clipRect;
+
+	// Receives all side effects of drawing besides the pixels, if set
+	PictureRaster *_raster;
+
 	// If true, we will show the whole EGA drawing process...
 	bool _EGAdrawingVisualize;
 };
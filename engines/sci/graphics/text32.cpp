@@ -199,9 +199,47 @@ void GfxText32::disposeTextBitmap(reg_t hunkId) {
 	_segMan->freeHunkEntry(hunkId);
 }
 
-void GfxText32::drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject) {
+void GfxText32::drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, const Common::Rect &clipRect) {
 	reg_t hunkId = readSelector(_segMan, textObject, SELECTOR(bitmap));
-	drawTextBitmapInternal(x, y, planeRect, textObject, hunkId);
+	drawTextBitmapInternal(x, y, planeRect, textObject, hunkId, clipRect);
+}
+
+/**
+ * Returns the display area drawTextBitmap() would draw to, together with a
+ * checksum of everything that affects what gets drawn there. Used by
+ * GfxFrameout to find out if a text needs to get redrawn.
+ */
+Common::Rect GfxText32::getTextBitmapRect(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, uint32 &checksum) {
+	reg_t hunkId = readSelector(_segMan, textObject, SELECTOR(bitmap));
+	checksum = 0;
+
+	if (hunkId.isNull() || x < 0 || y < 0)
+		return Common::Rect();
+
+	byte *memoryPtr = _segMan->getHunkPointer(hunkId);
+	if (!memoryPtr)
+		return Common::Rect();
+
+	uint16 textX = planeRect.left + x;
+	uint16 textY = planeRect.top + y;
+	uint16 width = READ_LE_UINT16(memoryPtr);
+	uint16 height = READ_LE_UINT16(memoryPtr + 2);
+
+	if (_screen->fontIsUpscaled()) {
+		textX = textX * _screen->getDisplayWidth() / _screen->getWidth();
+		textY = textY * _screen->getDisplayHeight() / _screen->getHeight();
+	}
+
+	checksum = (hunkId.getSegment() << 16) | hunkId.getOffset();
+	checksum = checksum * 31 + (uint16)readSelectorValue(_segMan, textObject, SELECTOR(back));
+	checksum = checksum * 31 + (uint16)readSelectorValue(_segMan, textObject, SELECTOR(skip));
+
+	const byte *surface = memoryPtr + BITMAP_HEADER_SIZE;
+	const uint32 pixelCount = width * height;
+	for (uint32 i = 0; i < pixelCount; i++)
+		checksum = checksum * 31 + surface[i];
+
+	return Common::Rect(textX, textY, textX + width, textY + height);
 }
 
 void GfxText32::drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, uint16 y) {
@@ -215,10 +253,11 @@ void GfxText32::drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, u
 	drawTextBitmapInternal(x, y, planeRect, textObject, hunkId);*/
 
 	// HACK: we pretty much ignore the plane rect and x, y...
-	drawTextBitmapInternal(0, 0, Common::Rect(20, 390, 600, 460), textObject, hunkId);
+	drawTextBitmapInternal(0, 0, Common::Rect(20, 390, 600, 460), textObject, hunkId,
+							Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight()));
 }
 
-void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId) {
+void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId, const Common::Rect &clipRect) {
 	int16 backColor = (int16)readSelectorValue(_segMan, textObject, SELECTOR(back));
 	// Sanity check: Check if the hunk is set. If not, either the game scripts
 	// didn't set it, or an old saved game has been loaded, where it wasn't set.
@@ -259,6 +298,8 @@ void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect,
 	for (int curY = 0; curY < height; curY++) {
 		for (int curX = 0; curX < width; curX++) {
 			byte pixel = surface[curByte++];
+			if (!clipRect.contains(curX + textX, curY + textY))
+				continue;
 			if ((!translucent && pixel != skipColor && pixel != backColor) ||
 				(translucent && pixel != 0xFF))
 				_screen->putFontPixel(textY, curX + textX, curY, pixel);
@@ -25,6 +25,9 @@
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/mappedfile.h"
+#include "common/memstream.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #include "sci/resource.h"
@@ -188,22 +191,28 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : _resMan(resMan), _i
 	_fileOffset = 0;
 	_status = kResStatusNoMalloc;
 	_lockers = 0;
+	_prefetched = false;
+	_dataMapped = false;
 	_source = NULL;
 	_header = NULL;
 	_headerSize = 0;
 }
 
 Resource::~Resource() {
-	delete[] data;
+	if (!_dataMapped)
+		delete[] data;
 	delete[] _header;
 	if (_source && _source->getSourceType() == kSourcePatch)
 		delete _source;
 }
 
 void Resource::unalloc() {
-	delete[] data;
+	if (!_dataMapped)
+		delete[] data;
 	data = NULL;
+	_dataMapped = false;
 	_status = kResStatusNoMalloc;
+	_prefetched = false;
 }
 
 void Resource::writeToStream(Common::WriteStream *stream) const {
@@ -337,6 +346,12 @@ Common::SeekableReadStream *ResourceManager::getVolumeFile(ResourceSource *sourc
 
 	const char *filename = source->getLocationName().c_str();
 
+	// Volumes get mapped into memory, if the backend is able to, so that
+	// uncompressed resources can be used in place
+	const MappedVolume &mappedVolume = getMappedVolume(source->getLocationName());
+	if (mappedVolume.file)
+		return mappedVolume.stream;
+
 	// check if file is already opened
 	while (it != _volumeFiles.end()) {
 		file = *it;
@@ -366,6 +381,36 @@ Common::SeekableReadStream *ResourceManager::getVolumeFile(ResourceSource *sourc
 	return NULL;
 }
 
+const ResourceManager::MappedVolume &ResourceManager::getMappedVolume(const Common::String &filename) {
+	MappedVolumeMap::const_iterator it = _mappedVolumes.find(filename);
+	if (it != _mappedVolumes.end())
+		return it->_value;
+
+	MappedVolume &volume = _mappedVolumes[filename];
+	volume.file = NULL;
+	volume.stream = NULL;
+
+	Common::ArchiveMemberPtr member = SearchMan.getMember(filename);
+	if (member)
+		volume.file = member->createMappedFile();
+	if (volume.file)
+		volume.stream = volume.file->createReadStream();
+
+	debugC(kDebugLevelResMan, 2, "[resMan] Volume %s %s", filename.c_str(), volume.file ? "mapped" : "not mapped");
+	return volume;
+}
+
+byte *ResourceManager::getMappedVolumeData(const ResourceSource *source, uint32 offset, uint32 size) {
+	if (source->_resourceFile || !_mappedVolumes.contains(source->getLocationName()))
+		return NULL;
+
+	const Common::MappedFile *file = _mappedVolumes[source->getLocationName()].file;
+	if (!file || offset > file->size() || size > file->size() - offset)
+		return NULL;
+
+	return file->getData() + offset;
+}
+
 void ResourceManager::loadResource(Resource *res) {
 	res->_source->loadResource(this, res);
 }
@@ -892,6 +937,7 @@ void ResourceManager::init(bool initFromFallbackDetector) {
 	_LRU.clear();
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
+	initPrefetch();
 
 	// FIXME: put this in an Init() function, so that we can error out if detection fails completely
 
@@ -985,6 +1031,12 @@ ResourceManager::~ResourceManager() {
 		delete *it;
 		++it;
 	}
+
+	// The resources were deleted already, nothing points into the mappings anymore
+	for (MappedVolumeMap::iterator volume = _mappedVolumes.begin(); volume != _mappedVolumes.end(); ++volume) {
+		delete volume->_value.stream;
+		delete volume->_value.file;
+	}
 }
 
 void ResourceManager::removeFromLRU(Resource *res) {
@@ -1060,13 +1112,22 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return NULL;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
+		if (isPrefetchableType(id.getType()))
+			_prefetchStats.stalls++;
+	} else if (retval->_status == kResStatusEnqueued)
 		removeFromLRU(retval);
 	// Unless an error occurred, the resource is now either
 	// locked or allocated, but never queued or freed.
 
+	if (retval->_prefetched) {
+		// Got loaded ahead of time, so it's just handed over to the LRU now
+		retval->_prefetched = false;
+		_prefetchStats.hits++;
+	}
+	notePrefetchUse(retval);
+
 	freeOldResources();
 
 	if (lock) {
@@ -1965,44 +2026,58 @@ int Resource::readResourceInfo(ResVersion volVersion, Common::SeekableReadStream
 	return (compression == kCompUnknown) ? SCI_ERROR_UNKNOWN_COMPRESSION : SCI_ERROR_NONE;
 }
 
-int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file) {
-	int errorNum;
-	uint32 szPacked = 0;
-	ResourceCompression compression = kCompUnknown;
-
-	// fill resource info
-	errorNum = readResourceInfo(volVersion, file, szPacked, compression);
-	if (errorNum)
-		return errorNum;
-
-	// getting a decompressor
-	Decompressor *dec = NULL;
+static Decompressor *createDecompressor(ResourceCompression compression) {
 	switch (compression) {
 	case kCompNone:
-		dec = new Decompressor;
-		break;
+		return new Decompressor;
 	case kCompHuffman:
-		dec = new DecompressorHuffman;
-		break;
+		return new DecompressorHuffman;
 	case kCompLZW:
 	case kCompLZW1:
 	case kCompLZW1View:
 	case kCompLZW1Pic:
-		dec = new DecompressorLZW(compression);
-		break;
+		return new DecompressorLZW(compression);
 	case kCompDCL:
-		dec = new DecompressorDCL;
-		break;
+		return new DecompressorDCL;
 #ifdef ENABLE_SCI32
 	case kCompSTACpack:
-		dec = new DecompressorLZS;
-		break;
+		return new DecompressorLZS;
 #endif
 	default:
+		return NULL;
+	}
+}
+
+int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file) {
+	int errorNum;
+	uint32 szPacked = 0;
+	ResourceCompression compression = kCompUnknown;
+
+	// fill resource info
+	errorNum = readResourceInfo(volVersion, file, szPacked, compression);
+	if (errorNum)
+		return errorNum;
+
+	// getting a decompressor
+	Decompressor *dec = createDecompressor(compression);
+	if (!dec) {
 		error("Resource %s: Compression method %d not supported", _id.toString().c_str(), compression);
 		return SCI_ERROR_UNKNOWN_COMPRESSION;
 	}
 
+	// Uncompressed resources in volumes which are mapped into memory are
+	// used in place, instead of being copied
+	if (compression == kCompNone && szPacked == size) {
+		byte *mappedData = _resMan->getMappedVolumeData(_source, file->pos(), size);
+		if (mappedData) {
+			delete dec;
+			data = mappedData;
+			_dataMapped = true;
+			_status = kResStatusAllocated;
+			return SCI_ERROR_NONE;
+		}
+	}
+
 	data = new byte[size];
 	_status = kResStatusAllocated;
 	errorNum = data ? dec->unpack(file, data, szPacked, size) : SCI_ERROR_RESOURCE_TOO_BIG;
@@ -2013,6 +2088,210 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 	return errorNum;
 }
 
+/** A resource stored in a volume, as found by benchmarkDecompression() */
+struct PackedResource {
+	Resource *res;
+	ResourceCompression compression;
+	uint32 packedSize;
+	uint32 packedOffset;
+};
+
+Common::Array<DecompressionBenchmark> ResourceManager::benchmarkDecompression(int iterations) {
+	Common::Array<PackedResource> packedResources;
+	Common::Array<DecompressionBenchmark> results;
+
+	for (ResourceMap::iterator it = _resMap.begin(); it != _resMap.end(); ++it) {
+		Resource *res = it->_value;
+		if (res->_source->getSourceType() != kSourceVolume)
+			continue;
+
+		Common::SeekableReadStream *fileStream = getVolumeFile(res->_source);
+		if (!fileStream)
+			continue;
+		fileStream->seek(res->_fileOffset, SEEK_SET);
+
+		PackedResource packed;
+		packed.res = res;
+		if (!res->readResourceInfo(_volVersion, fileStream, packed.packedSize, packed.compression)) {
+			packed.packedOffset = fileStream->pos();
+			packedResources.push_back(packed);
+		}
+
+		if (res->_source->_resourceFile)
+			delete fileStream;
+	}
+
+	// One compression method after the other, so that only the packed data of
+	// one method needs to be held in memory at a time. Reading it isn't timed.
+	Common::Array<bool> done;
+	done.resize(packedResources.size());
+	for (uint i = 0; i < packedResources.size(); i++)
+		done[i] = false;
+
+	for (uint i = 0; i < packedResources.size(); i++) {
+		if (done[i])
+			continue;
+
+		DecompressionBenchmark result;
+		memset(&result, 0, sizeof(result));
+		result.compression = packedResources[i].compression;
+
+		Common::Array<const PackedResource *> methodResources;
+		Common::Array<byte *> methodData;
+		uint32 maxUnpackedSize = 0;
+
+		for (uint j = i; j < packedResources.size(); j++) {
+			const PackedResource &packed = packedResources[j];
+			if (done[j] || packed.compression != result.compression)
+				continue;
+			done[j] = true;
+
+			Common::SeekableReadStream *fileStream = getVolumeFile(packed.res->_source);
+			if (!fileStream)
+				continue;
+
+			byte *data = new byte[packed.packedSize];
+			fileStream->seek(packed.packedOffset, SEEK_SET);
+			if (fileStream->read(data, packed.packedSize) == packed.packedSize) {
+				methodResources.push_back(&packed);
+				methodData.push_back(data);
+				result.packedSize += packed.packedSize;
+				result.unpackedSize += packed.res->size;
+				maxUnpackedSize = MAX(maxUnpackedSize, packed.res->size);
+			} else {
+				delete[] data;
+			}
+
+			if (packed.res->_source->_resourceFile)
+				delete fileStream;
+		}
+
+		Decompressor *dec = createDecompressor(result.compression);
+		if (dec) {
+			byte *unpacked = new byte[maxUnpackedSize];
+			result.resources = methodResources.size();
+
+			uint32 startTime = g_system->getMillis();
+			for (int iteration = 0; iteration < iterations; iteration++) {
+				for (uint j = 0; j < methodResources.size(); j++) {
+					const PackedResource &packed = *methodResources[j];
+					Common::MemoryReadStream stream(methodData[j], packed.packedSize);
+					if (dec->unpack(&stream, unpacked, packed.packedSize, packed.res->size) && iteration == 0) {
+						warning("Failed to decompress %s", packed.res->_id.toString().c_str());
+						result.failures++;
+					}
+				}
+			}
+			result.time = g_system->getMillis() - startTime;
+
+			delete[] unpacked;
+			delete dec;
+			results.push_back(result);
+		}
+
+		for (uint j = 0; j < methodData.size(); j++)
+			delete[] methodData[j];
+	}
+
+	return results;
+}
+
+Common::Array<MappingBenchmark> ResourceManager::benchmarkMapping() {
+	typedef Common::HashMap<Common::String, Common::Array<Resource *>, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> VolumeResourceMap;
+	VolumeResourceMap volumes;
+	Common::Array<MappingBenchmark> results;
+
+	for (ResourceMap::iterator it = _resMap.begin(); it != _resMap.end(); ++it) {
+		Resource *res = it->_value;
+		if (res->_source->getSourceType() == kSourceVolume && !res->_source->_resourceFile)
+			volumes[res->_source->getLocationName()].push_back(res);
+	}
+
+	for (VolumeResourceMap::iterator volume = volumes.begin(); volume != volumes.end(); ++volume) {
+		MappingBenchmark result;
+		result.volume = volume->_key;
+		result.resources = volume->_value.size();
+		result.size = 0;
+		result.fileTime = result.mappedTime = 0;
+		result.fileMemory = result.mappedMemory = 0;
+		for (uint i = 0; i < volume->_value.size(); i++)
+			result.size += volume->_value[i]->size;
+
+		Common::File file;
+		if (!file.open(volume->_key))
+			continue;
+
+		// A separate mapping, so that the resources currently in use stay untouched.
+		// The file is read once up front, so that both ways find it in the
+		// system's file cache.
+		Common::ArchiveMemberPtr member = SearchMan.getMember(volume->_key);
+		Common::MappedFile *mapping = member ? member->createMappedFile() : 0;
+		result.mapped = (mapping != 0);
+		benchmarkLoadVolume(&file, 0, volume->_value);
+
+		uint32 startTime = g_system->getMillis();
+		result.fileMemory = benchmarkLoadVolume(&file, 0, volume->_value);
+		result.fileTime = g_system->getMillis() - startTime;
+
+		if (mapping) {
+			Common::SeekableReadStream *stream = mapping->createReadStream();
+			startTime = g_system->getMillis();
+			result.mappedMemory = benchmarkLoadVolume(stream, mapping, volume->_value);
+			result.mappedTime = g_system->getMillis() - startTime;
+			delete stream;
+			delete mapping;
+		}
+
+		results.push_back(result);
+	}
+
+	return results;
+}
+
+uint32 ResourceManager::benchmarkLoadVolume(Common::SeekableReadStream *volume, const Common::MappedFile *mapping, const Common::Array<Resource *> &resources) {
+	Common::Array<byte *> allocated;
+	uint32 memory = 0;
+	byte checksum = 0;
+
+	for (uint i = 0; i < resources.size(); i++) {
+		Resource *res = resources[i];
+		uint32 szPacked;
+		ResourceCompression compression;
+
+		volume->seek(res->_fileOffset, SEEK_SET);
+		if (res->readResourceInfo(_volVersion, volume, szPacked, compression))
+			continue;
+
+		// Like Resource::decompress(), which uses uncompressed resources in place
+		const byte *data;
+		const uint32 offset = volume->pos();
+		if (mapping && compression == kCompNone && szPacked == res->size && offset + res->size <= mapping->size()) {
+			data = mapping->getData() + offset;
+		} else {
+			Decompressor *dec = createDecompressor(compression);
+			if (!dec)
+				continue;
+			byte *buffer = new byte[res->size];
+			dec->unpack(volume, buffer, szPacked, res->size);
+			delete dec;
+
+			allocated.push_back(buffer);
+			memory += res->size;
+			data = buffer;
+		}
+
+		// Use the data, so that it really has to be read
+		for (uint32 j = 0; j < res->size; j++)
+			checksum ^= data[j];
+	}
+
+	for (uint i = 0; i < allocated.size(); i++)
+		delete[] allocated[i];
+
+	debugC(kDebugLevelResMan, 2, "[resMan] Checksum of all resources: %02x", checksum);
+	return memory;
+}
+
 ResourceCompression ResourceManager::getViewCompression() {
 	int viewsTested = 0;
 
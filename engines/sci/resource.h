@@ -26,6 +26,8 @@
 #include "common/str.h"
 #include "common/list.h"
 #include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/array.h"
 
 #include "sci/graphics/helpers.h"		// for ViewType
 #include "sci/decompressor.h"
@@ -35,6 +37,7 @@ namespace Common {
 class File;
 class FSList;
 class FSNode;
+class MappedFile;
 class WriteStream;
 class SeekableReadStream;
 }
@@ -240,6 +243,8 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	bool _prefetched; /**< Loaded ahead of time and not asked for yet */
+	bool _dataMapped; /**< data points into a mapped volume, instead of being allocated */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -254,6 +259,37 @@ protected:
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
+/** Counters of the resource prefetcher, shown by the "prefetch_stats" debugger command */
+struct ResourcePrefetchStats {
+	uint32 queued;		///< Resources predicted to be needed soon
+	uint32 prefetched;	///< Resources loaded while the game was idle
+	uint32 hits;		///< Main thread loads avoided, because the resource got prefetched
+	uint32 stalls;		///< Resources the main thread still had to load itself
+	uint32 wasted;		///< Prefetched resources thrown away without being used
+};
+
+/** Decompression throughput for the resources of one compression method */
+struct DecompressionBenchmark {
+	ResourceCompression compression;
+	uint32 resources;		///< Number of resources decompressed
+	uint32 failures;		///< Resources which failed to decompress
+	uint32 packedSize;		///< Total packed size of the resources, in bytes
+	uint32 unpackedSize;	///< Total unpacked size of the resources, in bytes
+	uint32 time;			///< Time it took to decompress them all, in milliseconds
+};
+
+/** Loading all resources of one volume, through Common::File and from the volume mapped into memory */
+struct MappingBenchmark {
+	Common::String volume;
+	bool mapped;			///< Whether the backend could map the volume at all
+	uint32 resources;		///< Number of resources loaded
+	uint32 size;			///< Total unpacked size of the resources, in bytes
+	uint32 fileTime;		///< Time it took to load them through Common::File, in milliseconds
+	uint32 fileMemory;		///< Memory allocated for them that way, in bytes
+	uint32 mappedTime;		///< Time it took to load them from the mapping, in milliseconds
+	uint32 mappedMemory;	///< Memory allocated for them that way, in bytes
+};
+
 class ResourceManager {
 	// FIXME: These 'friend' declarations are meant to be a temporary hack to
 	// ease transition to the ResourceSource class system.
@@ -378,6 +414,50 @@ public:
 	 */
 	ResourceType convertResType(byte type);
 
+	/**
+	 * Returns a pointer to the given part of a volume, if the volume is
+	 * mapped into memory.
+	 * @return the pointer, or NULL if the volume isn't mapped
+	 */
+	byte *getMappedVolumeData(const ResourceSource *source, uint32 offset, uint32 size);
+
+	/**
+	 * Tells the prefetcher which room the game is in. This gets called
+	 * whenever the game waits. The resources used in between are remembered
+	 * for the room, and the ones used when entering a room are prefetched
+	 * while the game waits in a room that was left for it before.
+	 * @param roomNumber	The current room number
+	 */
+	void setPrefetchRoom(uint16 roomNumber);
+
+	/**
+	 * Loads the next resource from the prefetch queue, if there is any.
+	 * @return false, if there was nothing left to prefetch
+	 */
+	bool prefetchStep();
+
+	void loadPrefetchHistory(Common::SeekableReadStream *stream);
+	void savePrefetchHistory(Common::WriteStream *stream) const;
+	bool hasPrefetchHistoryChanged() const { return _prefetchHistoryChanged; }
+	const ResourcePrefetchStats &getPrefetchStats() const { return _prefetchStats; }
+	uint getPrefetchQueueSize() const { return _prefetchQueue.size(); }
+
+	/**
+	 * Decompresses every resource stored in a resource volume from memory,
+	 * and measures how long that takes for each compression method.
+	 * @param iterations	How often each resource gets decompressed
+	 * @return the results, one entry per compression method used by the game
+	 */
+	Common::Array<DecompressionBenchmark> benchmarkDecompression(int iterations);
+
+	/**
+	 * Loads every resource of each resource volume once through Common::File
+	 * and once from the volume mapped into memory, keeping all of them in
+	 * memory until the whole volume is loaded, and measures both.
+	 * @return the results, one entry per volume
+	 */
+	Common::Array<MappingBenchmark> benchmarkMapping();
+
 protected:
 	// Maximum number of bytes to allow being allocated for resources
 	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
@@ -387,6 +467,16 @@ protected:
 		MAX_MEMORY = 256 * 1024	// 256KB
 	};
 
+	// Limits of the resource prefetcher
+	enum {
+		MAX_PREFETCH_MEMORY = 1024 * 1024,	// 1MB, for resources that weren't asked for yet
+		MAX_PREFETCH_ROOM_RESOURCES = 64,	// resources remembered per room
+		MAX_PREFETCH_ROOM_SUCCESSORS = 4	// rooms remembered to follow a room
+	};
+
+	typedef Common::HashMap<uint16, Common::Array<ResourceId> > PrefetchRoomResources;
+	typedef Common::HashMap<uint16, Common::Array<uint16> > PrefetchRoomSuccessors;
+
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
 	Common::List<ResourceSource *> _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
@@ -398,6 +488,22 @@ protected:
 	ResVersion _volVersion; ///< resource.0xx version
 	ResVersion _mapVersion; ///< resource.map version
 
+	struct MappedVolume {
+		Common::MappedFile *file; ///< NULL, if the volume couldn't be mapped
+		Common::SeekableReadStream *stream; ///< reads straight from file
+	};
+	typedef Common::HashMap<Common::String, MappedVolume, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> MappedVolumeMap;
+	MappedVolumeMap _mappedVolumes; ///< volumes mapped into memory, by file name
+
+	int _prefetchRoom; ///< Room the game was in when it last waited, -1 if none yet
+	Common::Array<ResourceId> _prefetchPendingUses; ///< Resources used since the game last waited
+	PrefetchRoomResources _prefetchRoomResources; ///< Resources used during the last visit of each room
+	PrefetchRoomSuccessors _prefetchRoomSuccessors; ///< Rooms entered from each room, most recent first
+	Common::List<ResourceId> _prefetchQueue; ///< Resources to load the next time the game waits
+	Common::List<ResourceId> _prefetched; ///< Resources loaded ahead of time, oldest first
+	bool _prefetchHistoryChanged;
+	ResourcePrefetchStats _prefetchStats;
+
 	/**
 	 * Add a path to the resource manager's list of sources.
 	 * @return a pointer to the added source structure, or NULL if an error occurred.
@@ -444,6 +550,8 @@ protected:
 	const char *versionDescription(ResVersion version) const;
 
 	Common::SeekableReadStream *getVolumeFile(ResourceSource *source);
+	const MappedVolume &getMappedVolume(const Common::String &filename);
+	uint32 benchmarkLoadVolume(Common::SeekableReadStream *volume, const Common::MappedFile *mapping, const Common::Array<Resource *> &resources);
 	void loadResource(Resource *res);
 	void freeOldResources();
 	void addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0);
@@ -512,6 +620,13 @@ protected:
 	void addToLRU(Resource *res);
 	void removeFromLRU(Resource *res);
 
+	/**--- Resource prefetching functions (resource_prefetch.cpp) ---*/
+	static bool isPrefetchableType(ResourceType type);
+	void initPrefetch();
+	void notePrefetchUse(Resource *res);
+	void queuePrefetchForRoom(uint16 roomNumber);
+	void freeOldPrefetchedResources();
+
 	ResourceCompression getViewCompression();
 	ViewType detectViewType();
 	bool hasSci0Voc999();
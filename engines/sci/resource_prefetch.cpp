@@ -0,0 +1,263 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Resource prefetching: room changes load scripts, pics, views and sounds
+// synchronously, right when a kernel call needs them. We remember which
+// resources got used when entering a room, and while the game waits in a room
+// we load the resources of the rooms that were entered from it before.
+
+#include "common/debug.h"
+#include "common/stream.h"
+#include "common/textconsole.h"
+
+#include "sci/resource.h"
+
+namespace Sci {
+
+// Version of the prefetch history file, bump when changing its layout
+#define PREFETCH_HISTORY_VERSION 1
+
+bool ResourceManager::isPrefetchableType(ResourceType type) {
+	// Audio is left out on purpose: it's big, streamed and depends on the
+	// currently loaded audio map
+	switch (type) {
+	case kResourceTypeView:
+	case kResourceTypePic:
+	case kResourceTypeScript:
+	case kResourceTypeHeap:
+	case kResourceTypeSound:
+	case kResourceTypePalette:
+	case kResourceTypeFont:
+	case kResourceTypeCursor:
+	case kResourceTypeMessage:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void ResourceManager::initPrefetch() {
+	_prefetchRoom = -1;
+	_prefetchPendingUses.clear();
+	_prefetchRoomResources.clear();
+	_prefetchRoomSuccessors.clear();
+	_prefetchQueue.clear();
+	_prefetched.clear();
+	_prefetchHistoryChanged = false;
+	memset(&_prefetchStats, 0, sizeof(_prefetchStats));
+}
+
+void ResourceManager::notePrefetchUse(Resource *res) {
+	if (!res->data || !isPrefetchableType(res->getType()))
+		return;
+
+	for (uint i = 0; i < _prefetchPendingUses.size(); i++) {
+		if (_prefetchPendingUses[i] == res->_id)
+			return;
+	}
+
+	if (_prefetchPendingUses.size() < MAX_PREFETCH_ROOM_RESOURCES)
+		_prefetchPendingUses.push_back(res->_id);
+}
+
+void ResourceManager::setPrefetchRoom(uint16 roomNumber) {
+	if (_prefetchRoom == roomNumber) {
+		// Still in the same room, remember what it needed in the meantime
+		Common::Array<ResourceId> &roomResources = _prefetchRoomResources[roomNumber];
+		for (uint i = 0; i < _prefetchPendingUses.size(); i++) {
+			if (roomResources.size() >= MAX_PREFETCH_ROOM_RESOURCES)
+				break;
+
+			uint j;
+			for (j = 0; j < roomResources.size(); j++) {
+				if (roomResources[j] == _prefetchPendingUses[i])
+					break;
+			}
+			if (j == roomResources.size()) {
+				roomResources.push_back(_prefetchPendingUses[i]);
+				_prefetchHistoryChanged = true;
+			}
+		}
+		_prefetchPendingUses.clear();
+		return;
+	}
+
+	// The room changed: everything used since the game last waited was needed
+	// for entering the new room. That replaces what was remembered from the
+	// last visit.
+	if (_prefetchRoom != -1) {
+		Common::Array<uint16> &successors = _prefetchRoomSuccessors[_prefetchRoom];
+		for (uint i = 0; i < successors.size(); i++) {
+			if (successors[i] == roomNumber) {
+				successors.remove_at(i);
+				break;
+			}
+		}
+		successors.insert_at(0, roomNumber);
+		if (successors.size() > MAX_PREFETCH_ROOM_SUCCESSORS)
+			successors.resize(MAX_PREFETCH_ROOM_SUCCESSORS);
+	}
+	_prefetchRoomResources[roomNumber] = _prefetchPendingUses;
+	_prefetchPendingUses.clear();
+	_prefetchHistoryChanged = true;
+
+	_prefetchRoom = roomNumber;
+	queuePrefetchForRoom(roomNumber);
+}
+
+void ResourceManager::queuePrefetchForRoom(uint16 roomNumber) {
+	_prefetchQueue.clear();
+
+	if (!_prefetchRoomSuccessors.contains(roomNumber))
+		return;
+
+	// Rooms that were entered from this one most recently come first
+	const Common::Array<uint16> &successors = _prefetchRoomSuccessors[roomNumber];
+	for (uint i = 0; i < successors.size(); i++) {
+		if (!_prefetchRoomResources.contains(successors[i]))
+			continue;
+
+		const Common::Array<ResourceId> &roomResources = _prefetchRoomResources[successors[i]];
+		for (uint j = 0; j < roomResources.size(); j++) {
+			Resource *res = testResource(roomResources[j]);
+			if (res && res->_status == kResStatusNoMalloc) {
+				_prefetchQueue.push_back(roomResources[j]);
+				_prefetchStats.queued++;
+			}
+		}
+	}
+
+	debugC(kDebugLevelResMan, 2, "[resMan] Room %d: %d resources queued for prefetching", roomNumber, _prefetchQueue.size());
+}
+
+bool ResourceManager::prefetchStep() {
+	while (!_prefetchQueue.empty()) {
+		ResourceId id = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		// Skip anything that got loaded in the meantime
+		Resource *res = testResource(id);
+		if (!res || res->_status != kResStatusNoMalloc)
+			continue;
+
+		loadResource(res);
+		if (res->_status != kResStatusAllocated)
+			continue;	// failed, loadResource() warned about it already
+
+		// Kept outside of the LRU, so that the resources of the room being
+		// left don't push it out before it's used
+		res->_prefetched = true;
+		_prefetched.push_back(id);
+		_prefetchStats.prefetched++;
+		freeOldPrefetchedResources();
+		return true;
+	}
+
+	return false;
+}
+
+void ResourceManager::freeOldPrefetchedResources() {
+	int memoryPrefetched = 0;
+
+	Common::List<ResourceId>::iterator it = _prefetched.begin();
+	while (it != _prefetched.end()) {
+		Resource *res = testResource(*it);
+		if (!res || !res->_prefetched) {
+			// Used or freed since it was prefetched
+			it = _prefetched.erase(it);
+		} else {
+			memoryPrefetched += res->size;
+			++it;
+		}
+	}
+
+	while (memoryPrefetched > MAX_PREFETCH_MEMORY) {
+		Resource *goner = testResource(_prefetched.front());
+		_prefetched.pop_front();
+		memoryPrefetched -= goner->size;
+		goner->unalloc();
+		_prefetchStats.wasted++;
+	}
+}
+
+void ResourceManager::loadPrefetchHistory(Common::SeekableReadStream *stream) {
+	if (stream->readUint32BE() != MKTAG('S', 'C', 'I', 'P') || stream->readByte() != PREFETCH_HISTORY_VERSION) {
+		warning("Ignoring unknown resource prefetch history");
+		return;
+	}
+
+	uint16 roomCount = stream->readUint16LE();
+	for (uint16 i = 0; i < roomCount && !stream->eos(); i++) {
+		uint16 roomNumber = stream->readUint16LE();
+
+		Common::Array<uint16> &successors = _prefetchRoomSuccessors[roomNumber];
+		byte successorCount = stream->readByte();
+		for (byte j = 0; j < successorCount; j++) {
+			uint16 successor = stream->readUint16LE();
+			if (successors.size() < MAX_PREFETCH_ROOM_SUCCESSORS)
+				successors.push_back(successor);
+		}
+
+		Common::Array<ResourceId> &roomResources = _prefetchRoomResources[roomNumber];
+		byte resourceCount = stream->readByte();
+		for (byte j = 0; j < resourceCount; j++) {
+			ResourceType type = (ResourceType)stream->readByte();
+			uint16 number = stream->readUint16LE();
+			if (roomResources.size() < MAX_PREFETCH_ROOM_RESOURCES && isPrefetchableType(type))
+				roomResources.push_back(ResourceId(type, number));
+		}
+	}
+
+	if (stream->err() || stream->eos()) {
+		warning("Resource prefetch history is truncated");
+		_prefetchRoomSuccessors.clear();
+		_prefetchRoomResources.clear();
+	}
+}
+
+void ResourceManager::savePrefetchHistory(Common::WriteStream *stream) const {
+	stream->writeUint32BE(MKTAG('S', 'C', 'I', 'P'));
+	stream->writeByte(PREFETCH_HISTORY_VERSION);
+
+	// Every room has resources remembered, but not necessarily successors
+	stream->writeUint16LE(_prefetchRoomResources.size());
+	for (PrefetchRoomResources::const_iterator it = _prefetchRoomResources.begin(); it != _prefetchRoomResources.end(); ++it) {
+		stream->writeUint16LE(it->_key);
+
+		PrefetchRoomSuccessors::const_iterator successors = _prefetchRoomSuccessors.find(it->_key);
+		if (successors != _prefetchRoomSuccessors.end()) {
+			stream->writeByte(successors->_value.size());
+			for (uint i = 0; i < successors->_value.size(); i++)
+				stream->writeUint16LE(successors->_value[i]);
+		} else {
+			stream->writeByte(0);
+		}
+
+		stream->writeByte(it->_value.size());
+		for (uint i = 0; i < it->_value.size(); i++) {
+			stream->writeByte(it->_value[i].getType());
+			stream->writeUint16LE(it->_value[i].getNumber());
+		}
+	}
+}
+
+} // End of namespace Sci
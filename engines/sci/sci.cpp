@@ -23,6 +23,7 @@
 #include "common/system.h"
 #include "common/config-manager.h"
 #include "common/debug-channels.h"
+#include "common/savefile.h"
 
 #include "engines/advancedDetector.h"
 #include "engines/util.h"
@@ -352,8 +353,11 @@ Common::Error SciEngine::run() {
 		                  "having unexpected errors and/or issues later on.");
 	}
 
+	loadPrefetchHistory();
+
 	runGame();
 
+	savePrefetchHistory();
 	ConfMan.flushToDisk();
 
 	return Common::kNoError;
@@ -923,4 +927,28 @@ void SciEngine::loadMacExecutable() {
 	}
 }
 
+void SciEngine::loadPrefetchHistory() {
+	Common::InSaveFile *in = _saveFileMan->openForLoading(wrapFilename("prefetch.dat"));
+	if (!in)
+		return;
+
+	_resMan->loadPrefetchHistory(in);
+	delete in;
+}
+
+void SciEngine::savePrefetchHistory() {
+	if (!_resMan->hasPrefetchHistoryChanged())
+		return;
+
+	Common::OutSaveFile *out = _saveFileMan->openForSaving(wrapFilename("prefetch.dat"));
+	if (!out)
+		return;
+
+	_resMan->savePrefetchHistory(out);
+	out->finalize();
+	if (out->err())
+		warning("Writing the resource prefetch history failed");
+	delete out;
+}
+
 } // End of namespace Sci
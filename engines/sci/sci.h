@@ -388,6 +388,13 @@ private:
 	 */
 	void loadMacExecutable();
 
+	/**
+	 * Loads/saves which resources the rooms of the game needed, so that the
+	 * resource manager can prefetch them the next time they are entered
+	 */
+	void loadPrefetchHistory();
+	void savePrefetchHistory();
+
 	void initStackBaseWithSelector(Selector selector);
 
 	bool gameHasFanMadePatch();
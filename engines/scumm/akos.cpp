@@ -539,12 +539,39 @@ byte AkosRenderer::drawLimb(const Actor *a, int limb) {
 	return result;
 }
 
+inline void AkosRenderer::codec1_putPixel(byte *dst, uint16 color) {
+	uint16 pcolor = _palette[color];
+	if (_shadow_mode == 1) {
+		if (pcolor == 13)
+			pcolor = _shadow_table[*dst];
+	} else if (_shadow_mode == 2) {
+		error("codec1_spec2"); // TODO
+	} else if (_shadow_mode == 3) {
+		if (_vm->_game.features & GF_16BIT_COLOR) {
+			uint16 srcColor = (pcolor >> 1) & 0x7DEF;
+			uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
+			pcolor = srcColor + dstColor;
+		} else if (_vm->_game.heversion >= 90) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = xmap[pcolor];
+		} else if (pcolor < 8) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = _shadow_table[pcolor];
+		}
+	}
+	if (_vm->_bytesPerPixel == 2) {
+		WRITE_UINT16(dst, pcolor);
+	} else {
+		*dst = pcolor;
+	}
+}
+
 void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
 	byte len, maskbit;
 	int y;
-	uint16 color, height, pcolor;
+	uint16 color, height;
 	const byte *scaleytab;
 	bool masked;
 	bool skip_column = false;
@@ -580,32 +607,8 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 				} else {
 					masked = (y < v1.boundsRect.top || y >= v1.boundsRect.bottom) || (v1.x < 0 || v1.x >= v1.boundsRect.right) || (*mask & maskbit);
 
-					if (color && !masked && !skip_column) {
-						pcolor = _palette[color];
-						if (_shadow_mode == 1) {
-							if (pcolor == 13)
-								pcolor = _shadow_table[*dst];
-						} else if (_shadow_mode == 2) {
-							error("codec1_spec2"); // TODO
-						} else if (_shadow_mode == 3) {
-							if (_vm->_game.features & GF_16BIT_COLOR) {
-								uint16 srcColor = (pcolor >> 1) & 0x7DEF;
-								uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
-								pcolor = srcColor + dstColor;
-							} else if (_vm->_game.heversion >= 90) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = xmap[pcolor];
-							} else if (pcolor < 8) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = _shadow_table[pcolor];
-							}
-						}
-						if (_vm->_bytesPerPixel == 2) {
-							WRITE_UINT16(dst, pcolor);
-						} else {
-							*dst = pcolor;
-						}
-					}
+					if (color && !masked && !skip_column)
+						codec1_putPixel(dst, color);
 				}
 				dst += _out.pitch;
 				mask += _numStrips;
@@ -637,6 +640,32 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	} while (1);
 }
 
+void AkosRenderer::codec1_cachedDecode(Codec1 &v1, const DecodedCel *cel) {
+	const int xstart = _vm->_virtscr[kMainVirtScreen].xstart & 7;
+
+	for (uint i = 0; i < cel->spans.size(); i++) {
+		const CelSpan &span = cel->spans[i];
+
+		const int x = v1.x + span.dx;
+		if (x < 0 || x >= v1.boundsRect.right)
+			continue;
+
+		const byte maskbit = revBitMask(x & 7);
+		const byte *mask = _vm->getMaskBuffer(x - xstart, v1.y, _zbuf) + span.dy * _numStrips;
+		const byte *color = &cel->colors[span.offset];
+		byte *dst = v1.destptr + span.dx * _vm->_bytesPerPixel + span.dy * _out.pitch;
+		int y = v1.y + span.dy;
+
+		for (uint j = 0; j < span.length; j++) {
+			if (y >= v1.boundsRect.top && y < v1.boundsRect.bottom && !(*mask & maskbit))
+				codec1_putPixel(dst, color[j]);
+			dst += _out.pitch;
+			mask += _numStrips;
+			y++;
+		}
+	}
+}
+
 // This is exact duplicate of smallCostumeScaleTable[] in costume.cpp
 // See FIXME below for explanation
 const byte smallCostumeScaleTableAKOS[256] = {
@@ -996,7 +1025,16 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.destptr = (byte *)_out.pixels + v1.y * _out.pitch + v1.x * _vm->_bytesPerPixel;
 
-	codec1_genericDecode(v1);
+	// Only cels which are not clipped horizontally get cached. Custom scale
+	// tables are strings, which scripts can change in place.
+	const DecodedCel *cel = 0;
+	if (drawFlag == 2 && !_actorHitMode && (!use_scaling || v1.scaletable == smallCostumeScaleTableAKOS || v1.scaletable == bigCostumeScaleTable))
+		cel = getDecodedCel(v1, v1.scaleXindex, v1.scaleYindex, false, true);
+
+	if (cel)
+		codec1_cachedDecode(v1, cel);
+	else
+		codec1_genericDecode(v1);
 
 	return drawFlag;
 }
@@ -23,9 +23,14 @@
 
 #include "scumm/base-costume.h"
 #include "scumm/costume.h"
+#include "scumm/resource.h"
 
 namespace Scumm {
 
+BaseCostumeRenderer::~BaseCostumeRenderer() {
+	purgeCelCache();
+}
+
 byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const Actor *a, bool drawToBackBuf) {
 	int i;
 	byte result = 0;
@@ -51,6 +56,14 @@ byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const
 	} else {
 		_xmove = _ymove = 0;
 	}
+	// The cel key holds every scaling parameter, so only its source pointer
+	// can go stale: once the costume is expired, another costume may be
+	// loaded at the same address with different pixels
+	if (_vm->_res->getNukeCount() != _celCacheNukeCount) {
+		purgeCelCache();
+		_celCacheNukeCount = _vm->_res->getNukeCount();
+	}
+
 	for (i = 0; i < 16; i++)
 		result |= drawLimb(a, i);
 	return result;
@@ -74,6 +87,123 @@ void BaseCostumeRenderer::codec1_ignorePakCols(Codec1 &v1, int num) {
 	} while (1);
 }
 
+const BaseCostumeRenderer::DecodedCel *BaseCostumeRenderer::getDecodedCel(const Codec1 &v1, int scaleXindex, int scaleYindex, bool wrapScaleIndex, bool skipScaledColumns) {
+	if (!_celCacheEnabled)
+		return 0;
+
+	CelCacheKey key;
+	key.src = _srcptr;
+	key.width = _width;
+	key.height = _height;
+	key.scaleXstep = v1.scaleXstep;
+	key.scaleX = _scaleX;
+	key.scaleY = _scaleY;
+	key.mask = v1.mask;
+	key.skipScaledColumns = skipScaledColumns;
+
+	// The scale table only matters for the directions which get scaled
+	key.scaletable = (_scaleX != 255 || _scaleY != 255) ? v1.scaletable : 0;
+	key.scaleXindex = (_scaleX != 255) ? scaleXindex : 0;
+	key.scaleYindex = (_scaleY != 255) ? scaleYindex : 0;
+
+	CelCache::iterator it = _celCache.find(key);
+	if (it != _celCache.end()) {
+		_celCacheHits++;
+		return it->_value;
+	}
+	_celCacheMisses++;
+
+	DecodedCel *cel = new DecodedCel();
+	if (!codec1_decodeCel(*cel, v1, scaleXindex, scaleYindex, wrapScaleIndex, skipScaledColumns)) {
+		delete cel;
+		return 0;
+	}
+
+	if (_celCacheSize + cel->size() > kMaxCelCacheSize)
+		purgeCelCache();
+
+	_celCache[key] = cel;
+	_celCacheSize += cel->size();
+	return cel;
+}
+
+bool BaseCostumeRenderer::codec1_decodeCel(DecodedCel &cel, const Codec1 &v1, int scaleXindex, int scaleYindex, bool wrapScaleIndex, bool skipScaledColumns) {
+	// This walks the cel exactly like the codec1 renderers do, but records
+	// the pixels instead of drawing them
+	if (_width <= 0 || _height <= 0 || _width * _height > kMaxCelCacheSize / 4)
+		return false;
+
+	const byte *src = _srcptr;
+	int columns = _width;
+	int height = _height;
+	int dx = 0, dy = 0;
+	int scaleYcur = scaleYindex;
+	bool skipColumn = false;
+	CelSpan *span = 0;
+
+	do {
+		byte len = *src++;
+		byte color = len >> v1.shr;
+		len &= v1.mask;
+		if (!len)
+			len = *src++;
+
+		do {
+			if (_scaleY == 255 || v1.scaletable[scaleYcur] < _scaleY) {
+				if (color && !(skipScaledColumns && skipColumn)) {
+					if (!span || span->dx != dx || span->dy + span->length != dy) {
+						CelSpan newSpan;
+						newSpan.dx = dx;
+						newSpan.dy = dy;
+						newSpan.length = 0;
+						newSpan.offset = cel.colors.size();
+						cel.spans.push_back(newSpan);
+						span = &cel.spans.back();
+					}
+					cel.colors.push_back(color);
+					span->length++;
+				}
+				dy++;
+			}
+			if (_scaleY != 255)
+				scaleYcur = wrapScaleIndex ? (scaleYcur + 1) & 0xFF : scaleYcur + 1;
+
+			if (!--height) {
+				if (!--columns)
+					return true;
+				height = _height;
+				dy = 0;
+				scaleYcur = scaleYindex;
+
+				if (_scaleX == 255 || v1.scaletable[scaleXindex] < _scaleX) {
+					dx += v1.scaleXstep;
+					skipColumn = false;
+				} else {
+					skipColumn = true;
+				}
+				scaleXindex += v1.scaleXstep;
+				if (wrapScaleIndex)
+					scaleXindex &= 0xFF;
+				span = 0;
+			}
+		} while (--len);
+	} while (1);
+}
+
+void BaseCostumeRenderer::purgeCelCache() {
+	for (CelCache::iterator it = _celCache.begin(); it != _celCache.end(); ++it)
+		delete it->_value;
+
+	_celCache.clear();
+	_celCacheSize = 0;
+}
+
+void BaseCostumeRenderer::enableCelCache(bool enable) {
+	_celCacheEnabled = enable;
+	if (!enable)
+		purgeCelCache();
+}
+
 bool ScummEngine::isCostumeInUse(int cost) const {
 	int i;
 	Actor *a;
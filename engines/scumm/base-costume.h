@@ -24,6 +24,8 @@
 #define SCUMM_BASE_COSTUME_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "scumm/actor.h"		// for CostumeData
 
 namespace Scumm {
@@ -124,6 +126,28 @@ public:
 		int scaleXindex, scaleYindex;
 	};
 
+	/**
+	 * A run of pixels in one column of a cel decoded by codec1_decodeCel(),
+	 * relative to where the first column of the cel is drawn.
+	 */
+	struct CelSpan {
+		int16 dx, dy;
+		uint16 length;
+		uint32 offset;	///< into DecodedCel::colors
+	};
+
+	/**
+	 * A scaled and mirrored cel, holding only the pixels which are not
+	 * transparent. The colors are left unmapped, so the palette and shadow
+	 * mode can change without having to decode it again.
+	 */
+	struct DecodedCel {
+		Common::Array<CelSpan> spans;
+		Common::Array<byte> colors;
+
+		uint32 size() const { return spans.size() * sizeof(CelSpan) + colors.size(); }
+	};
+
 	BaseCostumeRenderer(ScummEngine *scumm) {
 		_actorID = 0;
 		_shadow_mode = 0;
@@ -141,8 +165,14 @@ public:
 		_width = _height = 0;
 		_skipLimbs = 0;
 		_paletteNum = 0;
+
+		_celCacheEnabled = true;
+		_celCacheSize = 0;
+		_celCacheNukeCount = 0;
+		_celCacheHits = 0;
+		_celCacheMisses = 0;
 	}
-	virtual ~BaseCostumeRenderer() {}
+	virtual ~BaseCostumeRenderer();
 
 	virtual void setPalette(uint16 *palette) = 0;
 	virtual void setFacing(const Actor *a) = 0;
@@ -151,10 +181,58 @@ public:
 
 	byte drawCostume(const VirtScreen &vs, int numStrips, const Actor *a, bool drawToBackBuf);
 
+	uint32 _celCacheHits, _celCacheMisses;
+
+	void enableCelCache(bool enable);
+	bool isCelCacheEnabled() const { return _celCacheEnabled; }
+	void purgeCelCache();
+	uint32 getCelCacheSize() const { return _celCacheSize; }
+
 protected:
 	virtual byte drawLimb(const Actor *a, int limb) = 0;
 
 	void codec1_ignorePakCols(Codec1 &v1, int num);
+
+	const DecodedCel *getDecodedCel(const Codec1 &v1, int scaleXindex, int scaleYindex, bool wrapScaleIndex, bool skipScaledColumns);
+	bool codec1_decodeCel(DecodedCel &cel, const Codec1 &v1, int scaleXindex, int scaleYindex, bool wrapScaleIndex, bool skipScaledColumns);
+
+private:
+	struct CelCacheKey {
+		const byte *src;
+		const byte *scaletable;
+		int width, height;
+		int scaleXindex, scaleYindex;
+		int8 scaleXstep;
+		byte scaleX, scaleY;
+		byte mask;
+		bool skipScaledColumns;
+
+		bool operator==(const CelCacheKey &other) const {
+			return src == other.src && scaletable == other.scaletable &&
+				width == other.width && height == other.height &&
+				scaleXindex == other.scaleXindex && scaleYindex == other.scaleYindex &&
+				scaleXstep == other.scaleXstep && scaleX == other.scaleX && scaleY == other.scaleY &&
+				mask == other.mask && skipScaledColumns == other.skipScaledColumns;
+		}
+	};
+
+	struct CelCacheKeyHash {
+		uint operator()(const CelCacheKey &key) const {
+			return (uint)(size_t)key.src ^ (key.scaleX << 24) ^ (key.scaleY << 16) ^
+				(key.scaleXindex << 8) ^ key.scaleYindex ^ (key.scaleXstep << 12);
+		}
+	};
+
+	typedef Common::HashMap<CelCacheKey, DecodedCel *, CelCacheKeyHash> CelCache;
+
+	enum {
+		kMaxCelCacheSize = 1024 * 1024	///< in bytes
+	};
+
+	bool _celCacheEnabled;
+	CelCache _celCache;
+	uint32 _celCacheSize;
+	uint32 _celCacheNukeCount;
 };
 
 } // End of namespace Scumm
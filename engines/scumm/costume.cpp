@@ -305,8 +305,22 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 		proc3_ami(v1);
 	else if (pcEngCost)
 		procPCEngine(v1);
-	else
-		proc3(v1);
+	else {
+		// Only cels which are not clipped horizontally get cached
+		const DecodedCel *cel = 0;
+#ifdef USE_ARM_COSTUME_ASM
+		const bool useARM = !(_shadow_mode & 0x20) && v1.mask_ptr && _shadow_table;
+#else
+		const bool useARM = false;
+#endif
+		if (drawFlag == 2 && !useARM && _vm->_bytesPerPixel == 1)
+			cel = getDecodedCel(v1, _scaleIndexX, _scaleIndexY, true, false);
+
+		if (cel)
+			proc3_cached(v1, cel);
+		else
+			proc3(v1);
+	}
 
 	return drawFlag;
 }
@@ -431,7 +445,7 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	byte *dst;
 	byte len, maskbit;
 	int y;
-	uint color, height, pcolor;
+	uint color, height;
 	byte scaleIndexY;
 	bool masked;
 
@@ -480,16 +494,8 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 			if (_scaleY == 255 || v1.scaletable[scaleIndexY++] < _scaleY) {
 				masked = (y < 0 || y >= _out.h) || (v1.x < 0 || v1.x >= _out.w) || (v1.mask_ptr && (mask[0] & maskbit));
 
-				if (color && !masked) {
-					if (_shadow_mode & 0x20) {
-						pcolor = _shadow_table[*dst];
-					} else {
-						pcolor = _palette[color];
-						if (pcolor == 13 && _shadow_table)
-							pcolor = _shadow_table[*dst];
-					}
-					*dst = pcolor;
-				}
+				if (color && !masked)
+					proc3_putPixel(dst, color);
 				dst += _out.pitch;
 				mask += _numStrips;
 				y++;
@@ -518,6 +524,30 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	} while (1);
 }
 
+void ClassicCostumeRenderer::proc3_cached(Codec1 &v1, const DecodedCel *cel) {
+	for (uint i = 0; i < cel->spans.size(); i++) {
+		const CelSpan &span = cel->spans[i];
+
+		const int x = v1.x + span.dx;
+		if (x < 0 || x >= _out.w)
+			continue;
+
+		const byte maskbit = revBitMask(x & 7);
+		const byte *mask = v1.mask_ptr + x / 8 + span.dy * _numStrips;
+		const byte *color = &cel->colors[span.offset];
+		byte *dst = v1.destptr + span.dx + span.dy * _out.pitch;
+		int y = v1.y + span.dy;
+
+		for (uint j = 0; j < span.length; j++) {
+			if (y >= 0 && y < _out.h && !(v1.mask_ptr && (*mask & maskbit)))
+				proc3_putPixel(dst, color[j]);
+			dst += _out.pitch;
+			mask += _numStrips;
+			y++;
+		}
+	}
+}
+
 void ClassicCostumeRenderer::proc3_ami(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
@@ -98,8 +98,21 @@ protected:
 	byte drawLimb(const Actor *a, int limb);
 
 	void proc3(Codec1 &v1);
+	void proc3_cached(Codec1 &v1, const DecodedCel *cel);
 	void proc3_ami(Codec1 &v1);
 
+	inline void proc3_putPixel(byte *dst, uint color) {
+		uint pcolor;
+		if (_shadow_mode & 0x20) {
+			pcolor = _shadow_table[*dst];
+		} else {
+			pcolor = _palette[color];
+			if (pcolor == 13 && _shadow_table)
+				pcolor = _shadow_table[*dst];
+		}
+		*dst = pcolor;
+	}
+
 	void procC64(Codec1 &v1, int actor);
 
 	void procPCEngine(Codec1 &v1);
@@ -27,16 +27,25 @@
 #include "common/util.h"
 
 #include "scumm/actor.h"
+#include "scumm/base-costume.h"
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
+#include "scumm/file.h"
+#include "scumm/he/intern_he.h"
+#include "scumm/he/wiz_he.h"
 #include "scumm/imuse/imuse.h"
+#include "scumm/imuse_digi/dimuse.h"
 #include "scumm/object.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
+#include "scumm/scumm_v7.h"
 #include "scumm/sound.h"
+#include "scumm/smush/smush_player.h"
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -94,6 +103,19 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 
 	DCmd_Register("show",      WRAP_METHOD(ScummDebugger, Cmd_Show));
 	DCmd_Register("hide",      WRAP_METHOD(ScummDebugger, Cmd_Hide));
+	DCmd_Register("opcodes",   WRAP_METHOD(ScummDebugger, Cmd_Opcodes));
+	DCmd_Register("strips",    WRAP_METHOD(ScummDebugger, Cmd_Strips));
+	DCmd_Register("cels",      WRAP_METHOD(ScummDebugger, Cmd_Cels));
+	DCmd_Register("uploads",   WRAP_METHOD(ScummDebugger, Cmd_Uploads));
+	DCmd_Register("resources", WRAP_METHOD(ScummDebugger, Cmd_Resources));
+	DCmd_Register("mapping_bench", WRAP_METHOD(ScummDebugger, Cmd_MappingBench));
+#ifdef ENABLE_SCUMM_7_8
+	DCmd_Register("smush",     WRAP_METHOD(ScummDebugger, Cmd_Smush));
+	DCmd_Register("dimuse",    WRAP_METHOD(ScummDebugger, Cmd_IMuseDigital));
+#endif
+#ifdef ENABLE_HE
+	DCmd_Register("wiz_bench", WRAP_METHOD(ScummDebugger, Cmd_WizBench));
+#endif
 
 	DCmd_Register("imuse",     WRAP_METHOD(ScummDebugger, Cmd_IMuse));
 
@@ -242,6 +264,325 @@ bool ScummDebugger::Cmd_Hide(int argc, const char **argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_Opcodes(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		_vm->_opcodesExecuted = 0;
+		_vm->_scriptExecutionTime = 0;
+		DebugPrintf("Opcode statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		DebugPrintf("Syntax: opcodes [reset]\n");
+		return true;
+	}
+
+	DebugPrintf("%u opcodes executed in %u ms of script execution\n", _vm->_opcodesExecuted, _vm->_scriptExecutionTime);
+	if (_vm->_scriptExecutionTime)
+		DebugPrintf("%u opcodes per second\n", (uint32)((double)_vm->_opcodesExecuted * 1000 / _vm->_scriptExecutionTime));
+	return true;
+}
+
+bool ScummDebugger::Cmd_Strips(int argc, const char **argv) {
+	Gdi *gdi = _vm->_gdi;
+
+	if (argc >= 2 && !strcmp(argv[1], "bench")) {
+		if (!_vm->getResourceAddress(rtRoom, _vm->_roomResource)) {
+			DebugPrintf("No room loaded\n");
+			return true;
+		}
+
+		int count = (argc > 2) ? atoi(argv[2]) : 100;
+		if (count <= 0)
+			count = 100;
+
+		// Redraw the whole background, as scrolling would, without and with
+		// the cached strips
+		const bool enabled = gdi->isStripCacheEnabled();
+		uint32 time[2];
+		for (int i = 0; i < 2; i++) {
+			gdi->enableStripCache(i == 1);
+			uint32 start = g_system->getMillis();
+			for (int j = 0; j < count; j++)
+				_vm->redrawBGStrip(0, gdi->_numStrips);
+			time[i] = g_system->getMillis() - start;
+		}
+		gdi->enableStripCache(enabled);
+		_vm->_fullRedraw = true;
+
+		DebugPrintf("%d background redraws: %u ms decoding, %u ms cached\n", count, time[0], time[1]);
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "on")) {
+		gdi->enableStripCache(true);
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		gdi->enableStripCache(false);
+	} else if (argc == 2 && !strcmp(argv[1], "reset")) {
+		gdi->_stripCacheHits = 0;
+		gdi->_stripCacheMisses = 0;
+		gdi->purgeStripCache();
+	} else if (argc != 1) {
+		DebugPrintf("Syntax: strips [on | off | reset | bench [count]]\n");
+		return true;
+	}
+
+	DebugPrintf("Strip cache is %s, %u bytes used\n", gdi->isStripCacheEnabled() ? "enabled" : "disabled", gdi->getStripCacheSize());
+	DebugPrintf("%u hits, %u misses\n", gdi->_stripCacheHits, gdi->_stripCacheMisses);
+	return true;
+}
+
+bool ScummDebugger::Cmd_Cels(int argc, const char **argv) {
+	BaseCostumeRenderer *bcr = _vm->_costumeRenderer;
+
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		bcr->enableCelCache(true);
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		bcr->enableCelCache(false);
+	} else if (argc == 2 && !strcmp(argv[1], "reset")) {
+		bcr->_celCacheHits = 0;
+		bcr->_celCacheMisses = 0;
+		bcr->purgeCelCache();
+	} else if (argc != 1) {
+		DebugPrintf("Syntax: cels [on | off | reset]\n");
+		return true;
+	}
+
+	DebugPrintf("Costume cel cache is %s, %u bytes used\n", bcr->isCelCacheEnabled() ? "enabled" : "disabled", bcr->getCelCacheSize());
+	DebugPrintf("%u hits, %u misses", bcr->_celCacheHits, bcr->_celCacheMisses);
+	if (bcr->_celCacheHits + bcr->_celCacheMisses)
+		DebugPrintf(" (%u%% hit rate)", bcr->_celCacheHits * 100 / (bcr->_celCacheHits + bcr->_celCacheMisses));
+	DebugPrintf("\n");
+	return true;
+}
+
+bool ScummDebugger::Cmd_Uploads(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		_vm->_maxScreenUploadBytes = 0;
+	} else if (argc != 1) {
+		DebugPrintf("Syntax: uploads [reset]\n");
+		return true;
+	}
+
+	DebugPrintf("Last frame: %u rects, %u bytes copied to the screen\n", _vm->_lastScreenUploadRects, _vm->_lastScreenUploadBytes);
+	DebugPrintf("Most bytes in a frame: %u\n", _vm->_maxScreenUploadBytes);
+	return true;
+}
+
+bool ScummDebugger::Cmd_Resources(int argc, const char **argv) {
+	ResourceManager *res = _vm->_res;
+
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		res->resetStats();
+	} else if (argc != 1) {
+		DebugPrintf("Syntax: resources [reset]\n");
+		return true;
+	}
+
+	DebugPrintf("Heap: %d bytes allocated, thresholds %d - %d\n", res->getAllocatedSize(), res->getMinHeapThreshold(), res->getMaxHeapThreshold());
+	DebugPrintf("Type          Loaded    Bytes     Hits   Misses  Expired\n");
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		const ResourceManager::ResTypeData &data = res->_types[type];
+		uint32 loaded = 0, size = 0;
+		for (uint idx = 0; idx < data.size(); idx++) {
+			if (data[idx]._address) {
+				loaded++;
+				size += data[idx]._size;
+			}
+		}
+		if (!loaded && !data._hits && !data._misses)
+			continue;
+		DebugPrintf("%-12s %7d %8d %8d %8d %8d\n", nameOfResType(type), loaded, size, data._hits, data._misses, data._expired);
+	}
+
+	const ResourceManager::PrefetchStats &stats = res->_prefetchStats;
+	DebugPrintf("Prefetching: %d room changes, %d queued, %d loaded, %d used, %d expired unused\n",
+				stats.roomChanges, stats.queued, stats.prefetched, stats.used, stats.wasted);
+	return true;
+}
+
+#ifdef ENABLE_SCUMM_7_8
+bool ScummDebugger::Cmd_Smush(int argc, const char **argv) {
+	if (_vm->_game.version < 7 || _vm->_game.heversion != 0) {
+		DebugPrintf("SMUSH movies are only used by v7 and v8 games\n");
+		return true;
+	}
+
+	const SmushPlayer::Stats &stats = ((ScummEngine_v7 *)_vm)->_splayer->getStats();
+	DebugPrintf("Last movie: %d frames decoded, %d shown, %d read ahead\n", stats.frames, stats.shown, stats.prefetched);
+	if (stats.decodeTime)
+		DebugPrintf("Decoded in %d ms, %d frames per second\n", stats.decodeTime, stats.frames * 1000 / stats.decodeTime);
+	return true;
+}
+
+bool ScummDebugger::Cmd_IMuseDigital(int argc, const char **argv) {
+	if (!_vm->_imuseDigital) {
+		DebugPrintf("Digital iMUSE isn't used by this game\n");
+		return true;
+	}
+
+	const BundleBlockCache *blockCache = _vm->_imuseDigital->getBlockCache();
+	DebugPrintf("Bundle block cache: %d blocks, %d hits, %d misses, %d read ahead\n", blockCache->getSize(),
+				blockCache->_hits, blockCache->_misses, blockCache->_readAhead);
+	DebugPrintf("Track underruns: %d\n", _vm->_imuseDigital->getUnderruns());
+	return true;
+}
+#endif
+
+/**
+ * Reads all resource blocks of a room file the way loadResource() does, each
+ * into a buffer of its own, which is added to blocks. Block headers get
+ * decrypted with encByte, the block data only if decrypt is set.
+ */
+static uint32 loadRoomFileBlocks(Common::SeekableReadStream *file, uint32 end, byte encByte, bool decrypt, Common::Array<byte *> &blocks) {
+	const uint32 key = encByte * 0x01010101;
+	uint32 size = 0;
+
+	while ((uint32)file->pos() + 8 <= end) {
+		const uint32 start = file->pos();
+		const uint32 tag = file->readUint32BE() ^ key;
+		const uint32 blockSize = file->readUint32BE() ^ key;
+		if (blockSize < 8 || blockSize > end - start)
+			break;
+
+		if (tag == MKTAG('L','E','C','F') || tag == MKTAG('L','F','L','F')) {
+			size += loadRoomFileBlocks(file, start + blockSize, encByte, decrypt, blocks);
+		} else {
+			byte *block = new byte[blockSize];
+			file->seek(start, SEEK_SET);
+			file->read(block, blockSize);
+			if (decrypt) {
+				for (uint32 i = 0; i < blockSize; i++)
+					block[i] ^= encByte;
+			}
+			blocks.push_back(block);
+			size += blockSize;
+		}
+		file->seek(start + blockSize, SEEK_SET);
+	}
+	return size;
+}
+
+static void freeRoomFileBlocks(Common::Array<byte *> &blocks) {
+	for (uint i = 0; i < blocks.size(); i++)
+		delete[] blocks[i];
+	blocks.clear();
+}
+
+bool ScummDebugger::Cmd_MappingBench(int argc, const char **argv) {
+	if (_vm->_game.version < 5) {
+		DebugPrintf("Only the room files of version 5 and later games can be benchmarked\n");
+		return true;
+	}
+
+	int room = (argc > 1) ? atoi(argv[1]) : _vm->_currentRoom;
+	if (room <= 0 || room >= _vm->_numRooms) {
+		DebugPrintf("Syntax: mapping_bench [<room>]\n");
+		DebugPrintf("Room %d is out of range (range: 1 - %d)\n", room, _vm->_numRooms - 1);
+		return true;
+	}
+
+	const Common::String filename = _vm->generateFilename(room);
+	const byte encByte = (_vm->_game.features & GF_USE_KEY) ? 0x69 : 0;
+	Common::Array<byte *> blocks;
+
+	// The plain file first, decrypted like ScummFile does without a mapping.
+	// It is read once up front, so that both ways find it in the system's
+	// file cache.
+	Common::File file;
+	if (!file.open(filename)) {
+		DebugPrintf("Can't open %s\n", filename.c_str());
+		return true;
+	}
+	loadRoomFileBlocks(&file, file.size(), encByte, true, blocks);
+	freeRoomFileBlocks(blocks);
+	file.seek(0, SEEK_SET);
+
+	uint32 start = g_system->getMillis();
+	const uint32 size = loadRoomFileBlocks(&file, file.size(), encByte, true, blocks);
+	const uint32 fileTime = g_system->getMillis() - start;
+	const uint numBlocks = blocks.size();
+	freeRoomFileBlocks(blocks);
+	file.close();
+
+	DebugPrintf("%s: %d resources, %d KB allocated either way\n", filename.c_str(), numBlocks, size / 1024);
+	DebugPrintf("file:   %u ms\n", fileTime);
+
+	ScummFile mappedFile(true);
+	mappedFile.setEnc(encByte);
+	if (!mappedFile.open(filename) || !mappedFile.isMapped()) {
+		DebugPrintf("mapped: the file can't be mapped into memory\n");
+		return true;
+	}
+
+	start = g_system->getMillis();
+	loadRoomFileBlocks(&mappedFile, mappedFile.size(), 0, false, blocks);
+	DebugPrintf("mapped: %u ms\n", g_system->getMillis() - start);
+	freeRoomFileBlocks(blocks);
+	return true;
+}
+
+#ifdef ENABLE_HE
+bool ScummDebugger::Cmd_WizBench(int argc, const char **argv) {
+	if (_vm->_game.heversion < 71) {
+		DebugPrintf("Wiz images are only used by HE games\n");
+		return true;
+	}
+	if (argc < 2) {
+		DebugPrintf("Syntax: wiz_bench <image> [count]\n");
+		return true;
+	}
+
+	ScummEngine_v71he *vm = (ScummEngine_v71he *)_vm;
+	int resNum = atoi(argv[1]);
+	int count = (argc > 2) ? atoi(argv[2]) : 100;
+	if (count <= 0)
+		count = 100;
+
+	if (resNum <= 0 || resNum >= _vm->_numImages) {
+		DebugPrintf("Image %d is out of range (range: 1 - %d)\n", resNum, _vm->_numImages - 1);
+		return true;
+	}
+
+	byte *dataPtr = vm->getResourceAddress(rtImage, resNum);
+	byte *wizh = dataPtr ? vm->findWrappedBlock(MKTAG('W','I','Z','H'), dataPtr, 0, 0) : 0;
+	byte *wizd = dataPtr ? vm->findWrappedBlock(MKTAG('W','I','Z','D'), dataPtr, 0, 0) : 0;
+	if (!wizh || !wizd) {
+		DebugPrintf("Image %d has no Wiz data\n", resNum);
+		return true;
+	}
+
+	// Only the RLE compressed 8 bit images go through the decoders
+	const uint32 comp = READ_LE_UINT32(wizh + 0x0);
+	const int w = READ_LE_UINT32(wizh + 0x4);
+	const int h = READ_LE_UINT32(wizh + 0x8);
+	if (comp != 1) {
+		DebugPrintf("Image %d uses compression type %d, only type 1 can be benchmarked\n", resNum, comp);
+		return true;
+	}
+
+	const int bpp = _vm->_bytesPerPixel;
+	byte *dst = (byte *)calloc(w * h, bpp);
+	byte palette[512];
+	for (int i = 0; i < 256; i++) {
+		if (bpp == 2)
+			WRITE_LE_UINT16(palette + i * 2, i);
+		else
+			palette[i] = i;
+	}
+
+	static const char *const modeNames[] = { "copy", "remap", "flipped" };
+	for (int mode = 0; mode < 3; mode++) {
+		const int flags = (mode == 2) ? (kWIFFlipX | kWIFFlipY) : 0;
+		const byte *palPtr = (mode == 1) ? palette : 0;
+
+		uint32 start = g_system->getMillis();
+		for (int i = 0; i < count; i++)
+			Wiz::copyWizImage(dst, wizd, w * bpp, kDstMemory, w, h, 0, 0, w, h, 0, flags, palPtr, 0, bpp);
+		DebugPrintf("%-8s %d x %dx%d: %u ms\n", modeNames[mode], count, w, h, g_system->getMillis() - start);
+	}
+
+	free(dst);
+	return true;
+}
+#endif
+
 bool ScummDebugger::Cmd_Script(int argc, const char** argv) {
 	int scriptnum;
 
@@ -62,6 +62,19 @@ private:
 
 	bool Cmd_Show(int argc, const char **argv);
 	bool Cmd_Hide(int argc, const char **argv);
+	bool Cmd_Opcodes(int argc, const char **argv);
+	bool Cmd_Strips(int argc, const char **argv);
+	bool Cmd_Cels(int argc, const char **argv);
+	bool Cmd_Uploads(int argc, const char **argv);
+	bool Cmd_Resources(int argc, const char **argv);
+	bool Cmd_MappingBench(int argc, const char **argv);
+#ifdef ENABLE_SCUMM_7_8
+	bool Cmd_Smush(int argc, const char **argv);
+	bool Cmd_IMuseDigital(int argc, const char **argv);
+#endif
+#ifdef ENABLE_HE
+	bool Cmd_WizBench(int argc, const char **argv);
+#endif
 
 	bool Cmd_IMuse(int argc, const char **argv);
 
@@ -24,6 +24,8 @@
 
 #include "scumm/scumm.h"
 
+#include "common/archive.h"
+#include "common/mappedfile.h"
 #include "common/memstream.h"
 #include "common/substream.h"
 
@@ -33,7 +35,11 @@ namespace Scumm {
 #pragma mark --- ScummFile ---
 #pragma mark -
 
-ScummFile::ScummFile() : _subFileStart(0), _subFileLen(0) {
+ScummFile::ScummFile(bool mapIntoMemory) : _subFileStart(0), _subFileLen(0), _mapIntoMemory(mapIntoMemory), _mappedFile(0) {
+}
+
+ScummFile::~ScummFile() {
+	close();
 }
 
 void ScummFile::setSubfileRange(int32 start, int32 len) {
@@ -53,14 +59,39 @@ void ScummFile::resetSubfile() {
 }
 
 bool ScummFile::open(const Common::String &filename) {
-	if (File::open(filename)) {
+	// Map the file into memory, if possible. Reading resources is then just
+	// copying them out of the mapping, without any system calls. Other files,
+	// like the many iMUSE bundles, would only take up address space.
+	if (_mapIntoMemory) {
+		Common::ArchiveMemberPtr member = SearchMan.hasFile(filename) ? SearchMan.getMember(filename) : Common::ArchiveMemberPtr();
+		if (member)
+			_mappedFile = member->createMappedFile();
+	}
+
+	bool opened;
+	if (_mappedFile) {
+		opened = File::open(_mappedFile->createReadStream(), filename);
+	} else {
+		opened = File::open(filename);
+	}
+
+	if (opened) {
 		resetSubfile();
 		return true;
 	} else {
+		close();
 		return false;
 	}
 }
 
+void ScummFile::close() {
+	File::close();
+
+	// The stream reading from the mapping got deleted by File::close()
+	delete _mappedFile;
+	_mappedFile = 0;
+}
+
 bool ScummFile::openSubFile(const Common::String &filename) {
 	assert(isOpen());
 
@@ -26,6 +26,10 @@
 #include "common/file.h"
 #include "common/stream.h"
 
+namespace Common {
+class MappedFile;
+}
+
 #include "scumm/detection.h"
 
 namespace Scumm {
@@ -57,15 +61,24 @@ private:
 	int32	_subFileStart;
 	int32	_subFileLen;
 	bool	_myEos; // Have we read past the end of the subfile?
+	bool	_mapIntoMemory;
+	Common::MappedFile *_mappedFile; // Backs the file, if the backend could map it into memory
 
 	void setSubfileRange(int32 start, int32 len);
 	void resetSubfile();
 
 public:
-	ScummFile();
+	/**
+	 * @param mapIntoMemory	whether to map the file into memory if the backend
+	 *			can, meant for the resource volumes only
+	 */
+	explicit ScummFile(bool mapIntoMemory = false);
+	~ScummFile();
 
 	bool open(const Common::String &filename);
 	bool openSubFile(const Common::String &filename);
+	void close();
+	bool isMapped() const { return _mappedFile != 0; }
 
 	void clearErr() { _myEos = false; BaseScummFile::clearErr(); }
 
@@ -214,22 +214,35 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+
+	_stripCacheAllowed = true;
+	_stripCacheEnabled = true;
+	_stripCacheSize = 0;
+	_stripCacheState = 0;
+	_stripCacheNukeCount = 0;
+	_stripCacheHits = 0;
+	_stripCacheMisses = 0;
 }
 
 Gdi::~Gdi() {
+	purgeStripCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(0) {
+	// Transparency masks (TMSK) and 16 bit strips aren't cached
+	_stripCacheAllowed = false;
 }
 
 
 GdiNES::GdiNES(ScummEngine *vm) : Gdi(vm) {
 	memset(&_NES, 0, sizeof(_NES));
+	_stripCacheAllowed = false;
 }
 
 #ifdef USE_RGB_COLOR
 GdiPCEngine::GdiPCEngine(ScummEngine *vm) : Gdi(vm) {
 	memset(&_PCE, 0, sizeof(_PCE));
+	_stripCacheAllowed = false;
 }
 
 GdiPCEngine::~GdiPCEngine() {
@@ -241,10 +254,12 @@ GdiPCEngine::~GdiPCEngine() {
 
 GdiV1::GdiV1(ScummEngine *vm) : Gdi(vm) {
 	memset(&_V1, 0, sizeof(_V1));
+	_stripCacheAllowed = false;
 }
 
 GdiV2::GdiV2(ScummEngine *vm) : Gdi(vm) {
 	_roomStrips = 0;
+	_stripCacheAllowed = false;
 }
 
 GdiV2::~GdiV2() {
@@ -259,6 +274,13 @@ GdiHE16bit::GdiHE16bit(ScummEngine *vm) : GdiHE(vm) {
 void Gdi::init() {
 	_numStrips = _vm->_screenWidth / 8;
 
+	// Indy4 Amiga picks the palette map depending on the virtual screen
+	// drawn to, see drawStrip()
+	if (_vm->_game.platform == Common::kPlatformAmiga && _vm->_game.id == GID_INDY4)
+		_stripCacheAllowed = false;
+	if (_vm->_bytesPerPixel != 1)
+		_stripCacheAllowed = false;
+
 	// Increase the number of screen strips by one; needed for smooth scrolling
 	if (_vm->_game.version >= 7) {
 		// We now have mostly working smooth scrolling code in place for V7+ games
@@ -527,6 +549,13 @@ void ScummEngine::drawDirtyScreenParts() {
 		_shakeFrame = 0;
 		_system->setShakePos(0);
 	}
+
+	_lastScreenUploadRects = _screenUploadRects;
+	_lastScreenUploadBytes = _screenUploadBytes;
+	if (_maxScreenUploadBytes < _screenUploadBytes)
+		_maxScreenUploadBytes = _screenUploadBytes;
+	_screenUploadRects = 0;
+	_screenUploadBytes = 0;
 }
 
 void ScummEngine_v6::drawDirtyScreenParts() {
@@ -573,26 +602,44 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	if (vs->h == 0)
 		return;
 
-	int i;
-	int w = 8;
-	int start = 0;
-
-	for (i = 0; i < _gdi->_numStrips; i++) {
-		if (vs->bdirty[i]) {
-			const int top = vs->tdirty[i];
-			const int bottom = vs->bdirty[i];
+	// Neighboring dirty strips get drawn as one rectangle, as long as that
+	// doesn't redraw much more than what is dirty. Every rectangle costs a
+	// compositing pass and a copy to the backend of its own.
+	int start = -1;
+	int top = 0, bottom = 0;
+	int dirtyArea = 0;
+
+	for (int i = 0; i <= _gdi->_numStrips; i++) {
+		if (i < _gdi->_numStrips && vs->bdirty[i]) {
+			const int stripTop = vs->tdirty[i];
+			const int stripBottom = vs->bdirty[i];
+			const int stripArea = 8 * MAX(stripBottom - stripTop, 0);
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
-				w += 8;
-				continue;
+
+			if (start != -1) {
+				const int newTop = MIN(top, stripTop);
+				const int newBottom = MAX(bottom, stripBottom);
+				const int newArea = (i + 1 - start) * 8 * (newBottom - newTop);
+
+				// Allow for at most 50% of the rectangle not being dirty
+				if (2 * newArea <= 3 * (dirtyArea + stripArea)) {
+					top = newTop;
+					bottom = newBottom;
+					dirtyArea += stripArea;
+					continue;
+				}
+				drawStripToScreen(vs, start * 8, (i - start) * 8, top, bottom);
 			}
-			drawStripToScreen(vs, start * 8, w, top, bottom);
-			w = 8;
+
+			start = i;
+			top = stripTop;
+			bottom = stripBottom;
+			dirtyArea = stripArea;
+		} else if (start != -1) {
+			drawStripToScreen(vs, start * 8, (i - start) * 8, top, bottom);
+			start = -1;
 		}
-		start = i + 1;
 	}
 }
 
@@ -764,6 +811,8 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 
 	// Finally blit the whole thing to the screen
 	_system->copyRectToScreen(src, pitch, x, y, width, height);
+	_screenUploadRects++;
+	_screenUploadBytes += width * height * _outputPixelFormat.bytesPerPixel;
 }
 
 // CGA
@@ -1797,6 +1846,8 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	const bool useStripCache = _stripCacheAllowed && _stripCacheEnabled && validateStripCache();
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -1829,7 +1880,16 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->pixels + y * vs->pitch + (x * 8 * vs->format.bytesPerPixel);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		StripCacheEntry *cachedStrip = 0;
+		if (useStripCache)
+			cachedStrip = getCachedStrip(smap_ptr, stripnr, height);
+
+		if (cachedStrip) {
+			drawCachedStrip(dstPtr, vs->pitch, cachedStrip, height);
+			transpStrip = cachedStrip->transpStrip;
+		} else {
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		}
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -1843,7 +1903,15 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
 		}
 
-		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		// Masks which get OR'ed into the existing ones can't be cached
+		if (cachedStrip && !(transpStrip && (flag & dbAllowMaskOr))) {
+			if (!restoreCachedMasks(cachedStrip, x, y, height, numzbuf, flag)) {
+				decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+				storeCachedMasks(cachedStrip, x, y, height, numzbuf, zplane_list, flag);
+			}
+		} else {
+			decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		}
 
 #if 0
 		// HACK: blit mask(s) onto normal screen. Useful to debug masking
@@ -1871,8 +1939,159 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	}
 }
 
-bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
-					int stripnr, const byte *smap_ptr) {
+bool Gdi::validateStripCache() {
+	// Decoded strips depend on the room palette map and the transparent
+	// color, which the key does not hold. Leaving a room frees its image, so
+	// the next room can place its own strips at the same addresses
+	uint32 state = _transparentColor;
+	for (int i = 0; i < 256; i++)
+		state = state * 31 + _roomPalette[i];
+
+	uint32 nukeCount = _vm->_res->getNukeCount();
+	if (state != _stripCacheState || nukeCount != _stripCacheNukeCount) {
+		purgeStripCache();
+		_stripCacheState = state;
+		_stripCacheNukeCount = nukeCount;
+	}
+
+	return true;
+}
+
+Gdi::StripCacheEntry *Gdi::getCachedStrip(const byte *smap_ptr, int stripnr, int height) {
+	StripCacheKey key;
+	key.smap = smap_ptr;
+	key.stripnr = stripnr;
+	key.height = height;
+
+	StripCache::iterator it = _stripCache.find(key);
+	if (it != _stripCache.end()) {
+		_stripCacheHits++;
+		return it->_value;
+	}
+	_stripCacheMisses++;
+
+	const uint32 stripSize = 8 * height;
+	if (_stripCacheSize + stripSize > kMaxStripCacheSize)
+		purgeStripCache();
+
+	StripCacheEntry *entry = new StripCacheEntry();
+	entry->pixels = new byte[stripSize];
+	entry->size = stripSize;
+
+	const byte *src = getStripPtr(smap_ptr, stripnr);
+	const uint32 vertStripNextInc = _vertStripNextInc;
+	_vertStripNextInc = height * 8 - 1;
+
+	memset(entry->pixels, 0, stripSize);
+	entry->transpStrip = decompressBitmap(entry->pixels, 8, src, height);
+
+	if (entry->transpStrip) {
+		// Decode it again over a different background, the pixels which
+		// differ are the ones left out
+		byte *pixels = new byte[stripSize];
+		memset(pixels, 0xFF, stripSize);
+		decompressBitmap(pixels, 8, src, height);
+
+		entry->opaque = new byte[stripSize];
+		for (uint32 i = 0; i < stripSize; i++)
+			entry->opaque[i] = (pixels[i] == entry->pixels[i]) ? 0xFF : 0;
+		entry->size += stripSize;
+		delete[] pixels;
+	}
+
+	_vertStripNextInc = vertStripNextInc;
+
+	_stripCache[key] = entry;
+	_stripCacheSize += entry->size;
+	return entry;
+}
+
+void Gdi::drawCachedStrip(byte *dst, int dstPitch, const StripCacheEntry *entry, int height) const {
+	const byte *src = entry->pixels;
+
+	if (!entry->opaque) {
+		for (int h = 0; h < height; h++) {
+			memcpy(dst, src, 8);
+			dst += dstPitch;
+			src += 8;
+		}
+		return;
+	}
+
+	// Keep the pixels left out by a transparent strip, four at a time
+	const byte *opaque = entry->opaque;
+	for (int h = 0; h < height; h++) {
+		for (int i = 0; i < 8; i += 4) {
+			uint32 mask = READ_UINT32(opaque + i);
+			WRITE_UINT32(dst + i, (READ_UINT32(dst + i) & ~mask) | (READ_UINT32(src + i) & mask));
+		}
+		dst += dstPitch;
+		src += 8;
+		opaque += 8;
+	}
+}
+
+void Gdi::storeCachedMasks(StripCacheEntry *entry, int x, int y, int height, int numzbuf, const byte *zplane_list[9], byte flag) {
+	// The Z-planes decodeMask() wrote to
+	uint16 planes = 0;
+	for (int i = 0; i < numzbuf; i++) {
+		if ((flag & dbDrawMaskOnAll) || (i > 0 && zplane_list[i]))
+			planes |= 1 << i;
+	}
+
+	delete[] entry->masks;
+	_stripCacheSize -= entry->size;
+
+	entry->masks = new byte[numzbuf * height];
+	for (int i = 0; i < numzbuf; i++) {
+		if (!(planes & (1 << i)))
+			continue;
+
+		const byte *mask_ptr = getMaskBuffer(x, y, i);
+		byte *dst = entry->masks + i * height;
+		for (int h = 0; h < height; h++)
+			dst[h] = mask_ptr[h * _numStrips];
+	}
+
+	entry->numzbuf = numzbuf;
+	entry->maskFlag = flag & dbDrawMaskOnAll;
+	entry->maskPlanes = planes;
+	entry->size = 8 * height * (entry->opaque ? 2 : 1) + numzbuf * height;
+	_stripCacheSize += entry->size;
+}
+
+bool Gdi::restoreCachedMasks(const StripCacheEntry *entry, int x, int y, int height, int numzbuf, byte flag) {
+	if (!entry->masks || entry->numzbuf != numzbuf || entry->maskFlag != (flag & dbDrawMaskOnAll))
+		return false;
+
+	for (int i = 0; i < numzbuf; i++) {
+		if (!(entry->maskPlanes & (1 << i)))
+			continue;
+
+		byte *mask_ptr = getMaskBuffer(x, y, i);
+		const byte *src = entry->masks + i * height;
+		for (int h = 0; h < height; h++)
+			mask_ptr[h * _numStrips] = src[h];
+	}
+
+	return true;
+}
+
+void Gdi::purgeStripCache() {
+	for (StripCache::iterator it = _stripCache.begin(); it != _stripCache.end(); ++it)
+		delete it->_value;
+
+	_stripCache.clear();
+	_stripCacheSize = 0;
+}
+
+void Gdi::enableStripCache(bool enable) {
+	_stripCacheEnabled = enable;
+	if (!enable)
+		purgeStripCache();
+}
+
+const byte *Gdi::getStripPtr(const byte *smap_ptr, int stripnr) const {
 	// Do some input verification and make sure the strip/strip offset
 	// are actually valid. Normally, this should never be a problem,
 	// but if e.g. a savegame gets corrupted, we can easily get into
@@ -1894,6 +2113,11 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 	}
 	assertRange(0, offset, smapLen-1, "screen strip");
 
+	return smap_ptr + offset;
+}
+
+bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
+					int stripnr, const byte *smap_ptr) {
 	// Indy4 Amiga always uses the room or verb palette map to match colors to
 	// the currently setup palette, thus we need to select it over here too.
 	// Done like the original interpreter.
@@ -1904,7 +2128,7 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_roomPalette = _vm->_roomPalette;
 	}
 
-	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+	return decompressBitmap(dstPtr, vs->pitch, getStripPtr(smap_ptr, stripnr), height);
 }
 
 bool GdiNES::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
@@ -24,6 +24,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -197,6 +198,69 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * A strip decoded by drawBitmap(), kept to draw it again without decoding
+	 * it. Decoding is done into a buffer of its own, so pixels left out by
+	 * transparent strips can be told apart from the drawn ones.
+	 */
+	struct StripCacheEntry {
+		bool transpStrip;
+		byte *pixels;		///< 8 pixels for each line
+		byte *opaque;		///< 0xFF for every drawn pixel, only set for transparent strips
+		int numzbuf;		///< number of Z-planes when the masks got stored
+		byte maskFlag;		///< dbDrawMaskOnAll when the masks got stored
+		uint16 maskPlanes;	///< bit set for every Z-plane stored in masks
+		byte *masks;		///< one byte for each line of each Z-plane, 0 if not stored
+		uint32 size;
+
+		StripCacheEntry() : transpStrip(false), pixels(0), opaque(0), numzbuf(0), maskFlag(0), maskPlanes(0), masks(0), size(0) {}
+		~StripCacheEntry() { delete[] pixels; delete[] opaque; delete[] masks; }
+	};
+
+	struct StripCacheKey {
+		const byte *smap;
+		int stripnr;
+		int height;
+
+		bool operator==(const StripCacheKey &other) const {
+			return smap == other.smap && stripnr == other.stripnr && height == other.height;
+		}
+	};
+
+	struct StripCacheKeyHash {
+		uint operator()(const StripCacheKey &key) const {
+			return (uint)(size_t)key.smap ^ (key.stripnr << 16) ^ key.height;
+		}
+	};
+
+	typedef Common::HashMap<StripCacheKey, StripCacheEntry *, StripCacheKeyHash> StripCache;
+
+	enum {
+		kMaxStripCacheSize = 2 * 1024 * 1024	///< in bytes
+	};
+
+	/** False for the Gdi variants which don't decode strips from SMAP data */
+	bool _stripCacheAllowed;
+	bool _stripCacheEnabled;
+	StripCache _stripCache;
+	uint32 _stripCacheSize;
+	uint32 _stripCacheState;	///< checksum of the room palette and transparent color the strips got decoded with
+	uint32 _stripCacheNukeCount;
+
+	bool validateStripCache();
+	StripCacheEntry *getCachedStrip(const byte *smap_ptr, int stripnr, int height);
+	void drawCachedStrip(byte *dst, int dstPitch, const StripCacheEntry *entry, int height) const;
+	void storeCachedMasks(StripCacheEntry *entry, int x, int y, int height, int numzbuf, const byte *zplane_list[9], byte flag);
+	bool restoreCachedMasks(const StripCacheEntry *entry, int x, int y, int height, int numzbuf, byte flag);
+
+public:
+	uint32 _stripCacheHits, _stripCacheMisses;
+
+	void enableStripCache(bool enable);
+	bool isStripCacheEnabled() const { return _stripCacheEnabled; }
+	void purgeStripCache();
+	uint32 getStripCacheSize() const { return _stripCacheSize; }
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -207,6 +271,7 @@ public:
 
 protected:
 	/* Bitmap decompressors */
+	const byte *getStripPtr(const byte *smap_ptr, int stripnr) const;
 	bool decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLinesToProcess);
 
 	void drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) const;
@@ -24,6 +24,7 @@
 
 #include "scumm/he/animation_he.h"
 #include "scumm/he/intern_he.h"
+#include "scumm/he/wiz_he.h"
 
 #include "audio/audiostream.h"
 #include "video/smk_decoder.h"
@@ -157,6 +158,7 @@ void MoviePlayer::handleNextFrame() {
 		uint8 *dst = _vm->findWrappedBlock(MKTAG('W','I','Z','D'), dstPtr, 0, 0);
 		assert(dst);
 		copyFrameToBuffer(dst, kDstResource, 0, 0, _vm->_screenWidth * _vm->_bytesPerPixel);
+		_vm->_wiz->imageModified(_wizResNum);
 	} else if (_flags & 1) {
 		copyFrameToBuffer(pvs->getBackPixels(0, 0), kDstScreen, 0, 0, pvs->pitch);
 
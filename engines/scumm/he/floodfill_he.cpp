@@ -287,6 +287,7 @@ void Wiz::fillWizFlood(const WizParameters *params) {
 		}
 	}
 	_vm->_res->setModified(rtImage, params->img.resNum);
+	imageModified(params->img.resNum);
 }
 
 } // End of namespace Scumm
@@ -40,6 +40,131 @@ Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	memset(&_polygons, 0, sizeof(_polygons));
 	_cursorImage = false;
 	_rectOverrideEnabled = false;
+	_decodedImagesSize = 0;
+	_imageCacheNukeCount = 0;
+}
+
+Wiz::~Wiz() {
+	purgeImageCaches();
+}
+
+void Wiz::validateImageCaches() {
+	// Reloading a resource undoes whatever was drawn into it
+	if (_vm->_res->getNukeCount() != _imageCacheNukeCount) {
+		purgeImageCaches();
+		_imageCacheNukeCount = _vm->_res->getNukeCount();
+	}
+}
+
+void Wiz::purgeImageCaches() {
+	for (DecodedImageCache::iterator it = _decodedImages.begin(); it != _decodedImages.end(); ++it)
+		free(it->_value.pixels);
+	for (HistogramCache::iterator it = _histograms.begin(); it != _histograms.end(); ++it)
+		delete[] it->_value;
+
+	_decodedImages.clear();
+	_histograms.clear();
+	_decodedImagesSize = 0;
+}
+
+void Wiz::imageModified(int resNum) {
+	// Drop everything decoded from the image, or shaded with it
+	Common::Array<WizCacheKey> decodedImages;
+	for (DecodedImageCache::iterator it = _decodedImages.begin(); it != _decodedImages.end(); ++it) {
+		if (it->_key.resNum == resNum || it->_key.shadow == resNum)
+			decodedImages.push_back(it->_key);
+	}
+	for (uint i = 0; i < decodedImages.size(); i++) {
+		const DecodedImage &image = _decodedImages[decodedImages[i]];
+		_decodedImagesSize -= image.size;
+		free(image.pixels);
+		_decodedImages.erase(decodedImages[i]);
+	}
+
+	Common::Array<WizCacheKey> histograms;
+	for (HistogramCache::iterator it = _histograms.begin(); it != _histograms.end(); ++it) {
+		if (it->_key.resNum == resNum)
+			histograms.push_back(it->_key);
+	}
+	for (uint i = 0; i < histograms.size(); i++) {
+		delete[] _histograms[histograms[i]];
+		_histograms.erase(histograms[i]);
+	}
+}
+
+uint8 *Wiz::getDecodedWizImage(int resNum, int state, int shadow, int flags, const uint8 *palPtr) {
+	// Anything with side effects on the palette, or drawn differently
+	// depending on where it goes, is decoded every time
+	if ((flags & (kWIFHasPalette | kWIFRemapPalette)) || _rectOverrideEnabled || _cursorImage)
+		return NULL;
+
+	validateImageCaches();
+
+	WizCacheKey key;
+	key.resNum = resNum;
+	key.state = state;
+	key.shadow = shadow;
+	key.flags = flags & (kWIFFlipX | kWIFFlipY);
+	key.transColor = (_vm->VAR_WIZ_TCOLOR != 0xFF) ? _vm->VAR(_vm->VAR_WIZ_TCOLOR) : 5;
+	key.rect = Common::Rect();
+
+	// The remap tables of the palette slots can change at any time
+	key.palette = 0;
+	if (palPtr) {
+		key.palette = 1;
+		for (int i = 0; i < 256 * _vm->_bytesPerPixel; i++)
+			key.palette = key.palette * 31 + palPtr[i];
+	}
+
+	DecodedImageCache::iterator it = _decodedImages.find(key);
+	if (it != _decodedImages.end())
+		return it->_value.pixels;
+
+	int32 w, h;
+	getWizImageDim(resNum, state, w, h);
+	const uint32 size = w * h * _vm->_bytesPerPixel;
+	if (size > kMaxDecodedImagesSize / 4)
+		return NULL;
+	if (_decodedImagesSize + size > kMaxDecodedImagesSize)
+		purgeImageCaches();
+
+	DecodedImage image;
+	image.pixels = drawWizImage(resNum, state, 0, 0, 0, 0, 0, shadow, 0, NULL, flags | kWIFBlitToMemBuffer, 0, palPtr);
+	image.size = size;
+	_decodedImages[key] = image;
+	_decodedImagesSize += size;
+	return image.pixels;
+}
+
+bool Wiz::getCachedHistogram(int resNum, int state, const Common::Rect &rCapt, uint32 *histogram) {
+	validateImageCaches();
+
+	WizCacheKey key;
+	key.resNum = resNum;
+	key.state = state;
+	key.rect = rCapt;
+
+	HistogramCache::iterator it = _histograms.find(key);
+	if (it == _histograms.end())
+		return false;
+
+	memcpy(histogram, it->_value, 256 * sizeof(uint32));
+	return true;
+}
+
+void Wiz::cacheHistogram(int resNum, int state, const Common::Rect &rCapt, const uint32 *histogram) {
+	if (_histograms.size() >= kMaxHistograms)
+		purgeImageCaches();
+
+	WizCacheKey key;
+	key.resNum = resNum;
+	key.state = state;
+	key.rect = rCapt;
+
+	uint32 *&cached = _histograms[key];
+	if (!cached)
+		cached = new uint32[256];
+	memcpy(cached, histogram, 256 * sizeof(uint32));
 }
 
 void Wiz::clearWizBuffer() {
@@ -369,6 +494,19 @@ void Wiz::writeColor(uint8 *dstPtr, int dstType, uint16 color) {
 	}
 }
 
+bool Wiz::isNativeEndianDst(int dstType) {
+	switch (dstType) {
+	case kDstCursor:
+	case kDstScreen:
+		return true;
+	case kDstMemory:
+	case kDstResource:
+		return false;
+	default:
+		error("writeColor: Unknown dstType %d", dstType);
+	}
+}
+
 #ifdef USE_RGB_COLOR
 void Wiz::copy16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int dstType, int dstw, int dsth, int srcx, int srcy, int srcw, int srch, const Common::Rect *rect, int flags, const uint8 *xmapPtr) {
 	Common::Rect r1, r2;
@@ -414,36 +552,38 @@ void Wiz::copyWizImage(uint8 *dst, const uint8 *src, int dstPitch, int dstType,
 }
 
 static void decodeWizMask(uint8 *&dst, uint8 &mask, int w, int maskType) {
-	switch (maskType) {
-	case 0:
-		while (w--) {
-			mask >>= 1;
-			if (mask == 0) {
-				mask = 0x80;
-				++dst;
-			}
-		}
-		break;
-	case 1:
-		while (w--) {
+	if (maskType < 0 || maskType > 2)
+		return;
+
+	// Handle the bits up to the next byte boundary one by one, then whole
+	// bytes at once
+	while (w > 0 && mask != 0x80) {
+		if (maskType == 1)
 			*dst &= ~mask;
-			mask >>= 1;
-			if (mask == 0) {
-				mask = 0x80;
-				++dst;
-			}
-		}
-		break;
-	case 2:
-		while (w--) {
+		else if (maskType == 2)
 			*dst |= mask;
-			mask >>= 1;
-			if (mask == 0) {
-				mask = 0x80;
-				++dst;
-			}
+		mask >>= 1;
+		if (mask == 0) {
+			mask = 0x80;
+			++dst;
 		}
-		break;
+		--w;
+	}
+
+	const int bytes = w / 8;
+	if (maskType == 1)
+		memset(dst, 0, bytes);
+	else if (maskType == 2)
+		memset(dst, 0xFF, bytes);
+	dst += bytes;
+	w &= 7;
+
+	while (w--) {
+		if (maskType == 1)
+			*dst &= ~mask;
+		else if (maskType == 2)
+			*dst |= mask;
+		mask >>= 1;
 	}
 }
 
@@ -508,7 +648,7 @@ void Wiz::copyMaskWizImage(uint8 *dst, const uint8 *src, const uint8 *mask, int
 					}
 					while (code--) {
 						if (*maskPtr != 5)
-							write16BitColor<kWizCopy>(dstPtr, dataPtr, dstType, palPtr);
+							writeColor(dstPtr, dstType, READ_LE_UINT16(dataPtr));
 						dataPtr += 2;
 						dstPtr += dstInc;
 					}
@@ -521,7 +661,7 @@ void Wiz::copyMaskWizImage(uint8 *dst, const uint8 *src, const uint8 *mask, int
 					}
 					while (code--) {
 						if (*maskPtr != 5)
-							write16BitColor<kWizCopy>(dstPtr, dataPtr, dstType, palPtr);
+							writeColor(dstPtr, dstType, READ_LE_UINT16(dataPtr));
 						dataPtr += 2;
 						dstPtr += dstInc;
 						maskPtr++;
@@ -688,16 +828,24 @@ void Wiz::copyRawWizImage(uint8 *dst, const uint8 *src, int dstPitch, int dstTyp
 
 #ifdef USE_RGB_COLOR
 template<int type>
-void Wiz::write16BitColor(uint8 *dstPtr, const uint8 *dataPtr, int dstType, const uint8 *xmapPtr) {
-	uint16 col = READ_LE_UINT16(dataPtr);
-	if (type == kWizXMap) {
-		uint16 srcColor = (col >> 1) & 0x7DEF;
-		uint16 dstColor = (READ_UINT16(dstPtr) >> 1) & 0x7DEF;
-		uint16 newColor = srcColor + dstColor;
-		writeColor(dstPtr, dstType, newColor);
-	}
-	if (type == kWizCopy) {
-		writeColor(dstPtr, dstType, col);
+void Wiz::write16BitColors(uint8 *dstPtr, const uint8 *dataPtr, int count, bool repeat, int dstInc, int dstType, const uint8 *xmapPtr) {
+	// Decide on the byte order once for the whole run, instead of per pixel
+	const bool native = isNativeEndianDst(dstType);
+	const int dataInc = repeat ? 0 : 2;
+
+	while (count--) {
+		uint16 color = READ_LE_UINT16(dataPtr);
+		if (type == kWizXMap) {
+			uint16 srcColor = (color >> 1) & 0x7DEF;
+			uint16 dstColor = (READ_UINT16(dstPtr) >> 1) & 0x7DEF;
+			color = srcColor + dstColor;
+		}
+		if (native)
+			WRITE_UINT16(dstPtr, color);
+		else
+			WRITE_LE_UINT16(dstPtr, color);
+		dataPtr += dataInc;
+		dstPtr += dstInc;
 	}
 }
 
@@ -770,10 +918,8 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
-					}
+					write16BitColors<type>(dstPtr, dataPtr, code, true, dstInc, dstType, xmapPtr);
+					dstPtr += dstInc * code;
 					dataPtr += 2;
 				} else {
 					code = (code >> 2) + 1;
@@ -790,11 +936,9 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dataPtr += 2;
-						dstPtr += dstInc;
-					}
+					write16BitColors<type>(dstPtr, dataPtr, code, false, dstInc, dstType, xmapPtr);
+					dataPtr += code * 2;
+					dstPtr += dstInc * code;
 				}
 			}
 		}
@@ -805,22 +949,49 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 #endif
 
 template<int type>
-void Wiz::write8BitColor(uint8 *dstPtr, const uint8 *dataPtr, int dstType, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth) {
+void Wiz::write8BitColors(uint8 *dstPtr, const uint8 *dataPtr, int count, bool repeat, int dstInc, int dstType, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth) {
+	const int dataInc = repeat ? 0 : 1;
+
 	if (bitDepth == 2) {
-		if (type == kWizXMap) {
-			uint16 color = READ_LE_UINT16(palPtr + *dataPtr * 2);
-			uint16 srcColor = (color >> 1) & 0x7DEF;
-			uint16 dstColor = (READ_UINT16(dstPtr) >> 1) & 0x7DEF;
-			uint16 newColor = srcColor + dstColor;
-			writeColor(dstPtr, dstType, newColor);
-		}
-		if (type == kWizRMap) {
-			writeColor(dstPtr, dstType, READ_LE_UINT16(palPtr + *dataPtr * 2));
+		const bool native = isNativeEndianDst(dstType);
+		while (count--) {
+			uint16 color;
+			if (type == kWizXMap) {
+				color = READ_LE_UINT16(palPtr + *dataPtr * 2);
+				uint16 srcColor = (color >> 1) & 0x7DEF;
+				uint16 dstColor = (READ_UINT16(dstPtr) >> 1) & 0x7DEF;
+				color = srcColor + dstColor;
+			} else if (type == kWizRMap) {
+				color = READ_LE_UINT16(palPtr + *dataPtr * 2);
+			} else {
+				color = *dataPtr;
+			}
+			if (native)
+				WRITE_UINT16(dstPtr, color);
+			else
+				WRITE_LE_UINT16(dstPtr, color);
+			dataPtr += dataInc;
+			dstPtr += dstInc;
 		}
+		return;
+	}
+
+	// Runs which are not flipped are plain copies and fills
+	if (dstInc == 1) {
 		if (type == kWizCopy) {
-			writeColor(dstPtr, dstType, *dataPtr);
+			if (repeat)
+				memset(dstPtr, *dataPtr, count);
+			else
+				memcpy(dstPtr, dataPtr, count);
+			return;
 		}
-	} else {
+		if (type == kWizRMap && repeat) {
+			memset(dstPtr, palPtr[*dataPtr], count);
+			return;
+		}
+	}
+
+	while (count--) {
 		if (type == kWizXMap) {
 			*dstPtr = xmapPtr[*dataPtr * 256 + *dstPtr];
 		}
@@ -830,6 +1001,8 @@ void Wiz::write8BitColor(uint8 *dstPtr, const uint8 *dataPtr, int dstType, const
 		if (type == kWizCopy) {
 			*dstPtr = *dataPtr;
 		}
+		dataPtr += dataInc;
+		dstPtr += dstInc;
 	}
 }
 
@@ -904,10 +1077,8 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
-					}
+					write8BitColors<type>(dstPtr, dataPtr, code, true, dstInc, dstType, palPtr, xmapPtr, bitDepth);
+					dstPtr += dstInc * code;
 					dataPtr++;
 				} else {
 					code = (code >> 2) + 1;
@@ -924,11 +1095,9 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
-					}
+					write8BitColors<type>(dstPtr, dataPtr, code, false, dstInc, dstType, palPtr, xmapPtr, bitDepth);
+					dataPtr += code;
+					dstPtr += dstInc * code;
 				}
 			}
 		}
@@ -1409,6 +1578,7 @@ void Wiz::captureImage(uint8 *src, int srcPitch, int srcw, int srch, int resNum,
 		}
 	}
 	_vm->_res->setModified(rtImage, resNum);
+	imageModified(resNum);
 }
 
 void Wiz::displayWizImage(WizImage *pwi) {
@@ -1528,6 +1698,7 @@ uint8 *Wiz::drawWizImage(int resNum, int state, int maskNum, int maskState, int
 			getWizImageDim(dstResNum, 0, cw, ch);
 			dstPitch = cw * _vm->_bytesPerPixel;
 			dstType = kDstResource;
+			imageModified(dstResNum);
 		} else {
 			VirtScreen *pvs = &_vm->_virtscr[kMainVirtScreen];
 			if (flags & kWIFMarkBufferDirty) {
@@ -1809,7 +1980,11 @@ void Wiz::drawWizPolygonTransform(int resNum, int state, Common::Point *wp, int
 				debug(0, "drawWizPolygonTransform() unhandled flag 0x800000");
 			}
 
-			srcWizBuf = drawWizImage(resNum, state, 0, 0, 0, 0, 0, shadow, 0, r, flags, 0, _vm->getHEPaletteSlot(palette));
+			srcWizBuf = getDecodedWizImage(resNum, state, shadow, flags, _vm->getHEPaletteSlot(palette));
+			if (srcWizBuf)
+				freeBuffer = false;
+			else
+				srcWizBuf = drawWizImage(resNum, state, 0, 0, 0, 0, 0, shadow, 0, r, flags, 0, _vm->getHEPaletteSlot(palette));
 		} else {
 			assert(_vm->_bytesPerPixel == 1);
 			uint8 *dataPtr = _vm->getResourceAddress(rtImage, resNum);
@@ -1820,7 +1995,11 @@ void Wiz::drawWizPolygonTransform(int resNum, int state, Common::Point *wp, int
 		}
 	} else {
 		if (getWizImageData(resNum, state, 0) != 0) {
-			srcWizBuf = drawWizImage(resNum, state, 0, 0, 0, 0, 0, shadow, 0, r, kWIFBlitToMemBuffer, 0, _vm->getHEPaletteSlot(palette));
+			srcWizBuf = getDecodedWizImage(resNum, state, shadow, kWIFBlitToMemBuffer, _vm->getHEPaletteSlot(palette));
+			if (srcWizBuf)
+				freeBuffer = false;
+			else
+				srcWizBuf = drawWizImage(resNum, state, 0, 0, 0, 0, 0, shadow, 0, r, kWIFBlitToMemBuffer, 0, _vm->getHEPaletteSlot(palette));
 		} else {
 			uint8 *dataPtr = _vm->getResourceAddress(rtImage, resNum);
 			assert(dataPtr);
@@ -1868,6 +2047,9 @@ void Wiz::drawWizPolygonTransform(int resNum, int state, Common::Point *wp, int
 
 	if (freeBuffer)
 		free(srcWizBuf);
+
+	if (dstResNum)
+		imageModified(dstResNum);
 }
 
 void Wiz::drawWizPolygonImage(uint8 *dst, const uint8 *src, const uint8 *mask, int dstpitch, int dstType, int dstw, int dsth, int wizW, int wizH, Common::Rect &bound, Common::Point *wp, uint8 bitDepth) {
@@ -1965,20 +2147,32 @@ void Wiz::drawWizPolygonImage(uint8 *dst, const uint8 *src, const uint8 *mask, i
 		int32 w = pra->w;
 		int32 x_acc = pra->x_s;
 		int32 y_acc = pra->y_s;
-		while (--w) {
-			int32 src_offs = (y_acc >> 16) * wizW + (x_acc >> 16);
-			assert(src_offs < wizW * wizH);
-			x_acc += pra->x_step;
-			y_acc += pra->y_step;
-			if (bitDepth == 2) {
-				if (transColor == -1 || transColor != READ_LE_UINT16(src + src_offs * 2)) {
-					writeColor(dstPtr, dstType, READ_LE_UINT16(src + src_offs * 2));
+		if (bitDepth == 2) {
+			const bool native = isNativeEndianDst(dstType);
+			while (--w) {
+				int32 src_offs = (y_acc >> 16) * wizW + (x_acc >> 16);
+				assert(src_offs < wizW * wizH);
+				x_acc += pra->x_step;
+				y_acc += pra->y_step;
+				uint16 color = READ_LE_UINT16(src + src_offs * 2);
+				if (transColor == -1 || transColor != color) {
+					if (native)
+						WRITE_UINT16(dstPtr, color);
+					else
+						WRITE_LE_UINT16(dstPtr, color);
 				}
-			} else {
+				dstPtr += 2;
+			}
+		} else {
+			while (--w) {
+				int32 src_offs = (y_acc >> 16) * wizW + (x_acc >> 16);
+				assert(src_offs < wizW * wizH);
+				x_acc += pra->x_step;
+				y_acc += pra->y_step;
 				if (transColor == -1 || transColor != src[src_offs])
 					*dstPtr = src[src_offs];
+				dstPtr++;
 			}
-			dstPtr += bitDepth;
 		}
 	}
 
@@ -2173,6 +2367,7 @@ void Wiz::createWizEmptyImage(int resNum, int img_x, int img_y, int img_w, int i
 		WRITE_BE_UINT32(res_data, 8 + img_w * img_h * bitDepth); res_data += 4;
 	}
 	_vm->_res->setModified(rtImage, resNum);
+	imageModified(resNum);
 }
 
 void Wiz::fillWizRect(const WizParameters *params) {
@@ -2224,6 +2419,7 @@ void Wiz::fillWizRect(const WizParameters *params) {
 		}
 	}
 	_vm->_res->setModified(rtImage, params->img.resNum);
+	imageModified(params->img.resNum);
 }
 
 struct drawProcP {
@@ -2293,6 +2489,7 @@ void Wiz::fillWizLine(const WizParameters *params) {
 		}
 	}
 	_vm->_res->setModified(rtImage, params->img.resNum);
+	imageModified(params->img.resNum);
 }
 
 void Wiz::fillWizPixel(const WizParameters *params) {
@@ -2330,6 +2527,7 @@ void Wiz::fillWizPixel(const WizParameters *params) {
 		}
 	}
 	_vm->_res->setModified(rtImage, params->img.resNum);
+	imageModified(params->img.resNum);
 }
 
 void Wiz::remapWizImagePal(const WizParameters *params) {
@@ -2346,6 +2544,7 @@ void Wiz::remapWizImagePal(const WizParameters *params) {
 		rmap[4 + idx] = params->remapColor[idx];
 	}
 	_vm->_res->setModified(rtImage, params->img.resNum);
+	imageModified(params->img.resNum);
 }
 
 void Wiz::processWizImage(const WizParameters *params) {
@@ -2387,6 +2586,7 @@ void Wiz::processWizImage(const WizParameters *params) {
 						_vm->VAR(119) = -2;
 					} else {
 						_vm->_res->setModified(rtImage, params->img.resNum);
+						imageModified(params->img.resNum);
 						_vm->VAR(_vm->VAR_GAME_LOADED) = 0;
 						_vm->VAR(119) = 0;
 					}
@@ -2497,6 +2697,7 @@ void Wiz::processWizImage(const WizParameters *params) {
 		// Used in to draw circles in FreddisFunShop/PuttsFunShop/SamsFunShop
 		// TODO: Ellipse
 		_vm->_res->setModified(rtImage, params->img.resNum);
+		imageModified(params->img.resNum);
 		break;
 	default:
 		error("Unhandled processWizImage mode %d", params->processMode);
@@ -2678,17 +2879,20 @@ int ScummEngine_v90he::computeWizHistogram(int resNum, int state, int x, int y,
 		if (rCapt.intersects(rWiz)) {
 			rCapt.clip(rWiz);
 			uint32 histogram[256];
-			memset(histogram, 0, sizeof(histogram));
-			switch (c) {
-			case 0:
-				_wiz->computeRawWizHistogram(histogram, wizd, w, rCapt);
-				break;
-			case 1:
-				_wiz->computeWizHistogram(histogram, wizd, rCapt);
-				break;
-			default:
-				error("computeWizHistogram: Unhandled wiz compression type %d", c);
-				break;
+			if (!_wiz->getCachedHistogram(resNum, state, rCapt, histogram)) {
+				memset(histogram, 0, sizeof(histogram));
+				switch (c) {
+				case 0:
+					_wiz->computeRawWizHistogram(histogram, wizd, w, rCapt);
+					break;
+				case 1:
+					_wiz->computeWizHistogram(histogram, wizd, rCapt);
+					break;
+				default:
+					error("computeWizHistogram: Unhandled wiz compression type %d", c);
+					break;
+				}
+				_wiz->cacheHistogram(resNum, state, rCapt, histogram);
 			}
 			for (int i = 0; i < 256; ++i) {
 				writeArray(0, 0, i, histogram[i]);
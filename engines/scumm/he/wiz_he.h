@@ -23,6 +23,8 @@
 #if !defined(SCUMM_HE_WIZ_HE_H) && defined(ENABLE_HE)
 #define SCUMM_HE_WIZ_HE_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
 
 namespace Scumm {
@@ -160,6 +162,7 @@ public:
 	WizPolygon _polygons[NUM_POLYGONS];
 
 	Wiz(ScummEngine_v71he *vm);
+	~Wiz();
 
 	void clearWizBuffer();
 	Common::Rect _rectOverride;
@@ -225,10 +228,11 @@ public:
 	template<int type> static void decompressRawWizImage(uint8 *dst, int dstPitch, int dstType, const uint8 *src, int srcPitch, int w, int h, int transColor, const uint8 *palPtr, uint8 bitdepth);
 
 #ifdef USE_RGB_COLOR
-	template<int type> static void write16BitColor(uint8 *dst, const uint8 *src, int dstType, const uint8 *xmapPtr);
+	template<int type> static void write16BitColors(uint8 *dst, const uint8 *src, int count, bool repeat, int dstInc, int dstType, const uint8 *xmapPtr);
 #endif
-	template<int type> static void write8BitColor(uint8 *dst, const uint8 *src, int dstType, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth);
+	template<int type> static void write8BitColors(uint8 *dst, const uint8 *src, int count, bool repeat, int dstInc, int dstType, const uint8 *palPtr, const uint8 *xmapPtr, uint8 bitDepth);
 	static void writeColor(uint8 *dstPtr, int dstType, uint16 color);
+	static bool isNativeEndianDst(int dstType);
 
 	int isWizPixelNonTransparent(const uint8 *data, int x, int y, int w, int h, uint8 bitdepth);
 	uint16 getWizPixelColor(const uint8 *data, int x, int y, int w, int h, uint8 bitDepth, uint16 color);
@@ -236,8 +240,59 @@ public:
 	void computeWizHistogram(uint32 *histogram, const uint8 *data, const Common::Rect& rCapt);
 	void computeRawWizHistogram(uint32 *histogram, const uint8 *data, int srcPitch, const Common::Rect& rCapt);
 
+	/** Has to be called whenever the pixels of an image resource change */
+	void imageModified(int resNum);
+
+	uint8 *getDecodedWizImage(int resNum, int state, int shadow, int flags, const uint8 *palPtr);
+	bool getCachedHistogram(int resNum, int state, const Common::Rect &rCapt, uint32 *histogram);
+	void cacheHistogram(int resNum, int state, const Common::Rect &rCapt, const uint32 *histogram);
+
 private:
 	ScummEngine_v71he *_vm;
+
+	struct WizCacheKey {
+		int resNum, state;
+		int shadow, flags, transColor;
+		uint32 palette;			///< checksum of the remap table, 0 if there is none
+		Common::Rect rect;		///< histograms only
+
+		WizCacheKey() : resNum(0), state(0), shadow(0), flags(0), transColor(0), palette(0) {}
+
+		bool operator==(const WizCacheKey &other) const {
+			return resNum == other.resNum && state == other.state && shadow == other.shadow &&
+				flags == other.flags && transColor == other.transColor && palette == other.palette &&
+				rect == other.rect;
+		}
+	};
+
+	struct WizCacheKeyHash {
+		uint operator()(const WizCacheKey &key) const {
+			return (key.resNum << 16) ^ (key.state << 8) ^ key.shadow ^ key.flags ^ key.palette ^
+				(key.rect.left << 20) ^ (key.rect.top << 10) ^ key.rect.right ^ (key.rect.bottom << 5);
+		}
+	};
+
+	/** An image decoded for drawWizPolygonTransform(), see getDecodedWizImage() */
+	struct DecodedImage {
+		uint8 *pixels;
+		uint32 size;
+	};
+
+	typedef Common::HashMap<WizCacheKey, DecodedImage, WizCacheKeyHash> DecodedImageCache;
+	typedef Common::HashMap<WizCacheKey, uint32 *, WizCacheKeyHash> HistogramCache;
+
+	enum {
+		kMaxDecodedImagesSize = 4 * 1024 * 1024,	///< in bytes
+		kMaxHistograms = 256
+	};
+
+	DecodedImageCache _decodedImages;
+	uint32 _decodedImagesSize;
+	HistogramCache _histograms;
+	uint32 _imageCacheNukeCount;
+
+	void validateImageCaches();
+	void purgeImageCaches();
 };
 
 } // End of namespace Scumm
@@ -48,6 +48,7 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, Audio::Mixer *mixer, int fps)
 	assert(mixer);
 
 	_pause = false;
+	_underruns = 0;
 	_sound = new ImuseDigiSndMgr(_vm);
 	assert(_sound);
 	_callbackFps = fps;
@@ -268,6 +269,8 @@ void IMuseDigital::callback() {
 
 				if (track->stream->endOfData()) {
 					feedSize *= 2;
+					if (track->regionOffset != 0)
+						_underruns++;
 				}
 
 				if ((bits == 12) || (bits == 16)) {
@@ -436,4 +439,39 @@ void IMuseDigital::switchToNextRegion(Track *track) {
 	debug(5, "SwToNeReg(trackId:%d) - end of func", track->trackId);
 }
 
+void IMuseDigital::readAhead() {
+	Common::StackLock lock(_mutex, "IMuseDigital::readAhead()");
+
+	// Decompress the bundle blocks the callback is going to need during the
+	// next second, so that it doesn't have to.
+	for (int l = 0; l < MAX_DIGITAL_TRACKS + MAX_DIGITAL_FADETRACKS; l++) {
+		Track *track = _track[l];
+		if (!track->used || track->toBeRemoved || track->souStreamUsed || !track->soundDesc || track->curRegion == -1)
+			continue;
+
+		ImuseDigiSndMgr::SoundDesc *soundDesc = track->soundDesc;
+		int32 offset = track->regionOffset;
+		int32 size = track->feedSize;
+		if (_sound->getBits(soundDesc) == 12) {
+			offset = (offset * 3) / 4;
+			size = (size * 3) / 4;
+		}
+
+		size -= _sound->readAheadRegion(soundDesc, track->curRegion, offset, size);
+		if (size <= 0 || track->trackId >= MAX_DIGITAL_TRACKS)
+			continue;
+
+		// Near the end of the region, also get the start of the region
+		// switchToNextRegion() is going to pick
+		int region = track->curRegion + 1;
+		if (region == _sound->getNumRegions(soundDesc))
+			continue;
+		int jumpId = _sound->getJumpIdByRegionAndHookId(soundDesc, region, track->curHookId);
+		if (jumpId != -1)
+			region = _sound->getRegionIdByJumpId(soundDesc, jumpId);
+		if (region != -1)
+			_sound->readAheadRegion(soundDesc, region, 0, size);
+	}
+}
+
 } // End of namespace Scumm
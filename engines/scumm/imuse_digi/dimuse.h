@@ -77,6 +77,7 @@ private:
 	int32 _numAudioNames;	// number of above filenames
 
 	bool _pause;			// flag mean that iMuse callback should be idle
+	uint32 _underruns;		// number of times a playing track ran out of queued data
 
 	int32 _attributes[188];	// internal attributes for each music file to store and check later
 	int32 _nextSeqToPlay;	// id of sequence type of music needed played
@@ -152,6 +153,9 @@ public:
 	void parseScriptCmds(int cmd, int soundId, int sub_cmd, int d, int e, int f, int g, int h);
 	void refreshScripts();
 	void flushTracks();
+	void readAhead();
+	uint32 getUnderruns() const { return _underruns; }
+	const BundleBlockCache *getBlockCache() const { return _sound->getBlockCache(); }
 	int getSoundStatus(int sound) const;
 	int32 getCurMusicPosInMs();
 	int32 getCurVoiceLipSyncWidth();
@@ -138,8 +138,70 @@ int BundleDirCache::matchFile(const char *filename) {
 	}
 }
 
-BundleMgr::BundleMgr(BundleDirCache *cache) {
+// Decompressed blocks to keep around, up to 1MB
+#define MAX_CACHED_BLOCKS 128
+
+BundleBlockCache::BundleBlockCache() {
+	_useCounter = 0;
+	_hits = 0;
+	_misses = 0;
+	_readAhead = 0;
+}
+
+BundleBlockCache::~BundleBlockCache() {
+	purge();
+}
+
+void BundleBlockCache::purge() {
+	for (BlockMap::iterator iter = _blocks.begin(); iter != _blocks.end(); ++iter)
+		delete iter->_value;
+
+	_blocks.clear();
+}
+
+BundleBlockCache::Block *BundleBlockCache::getBlock(int bundle, int32 index, int32 block) {
+	BlockKey key;
+	key.bundle = bundle;
+	key.index = index;
+	key.block = block;
+
+	BlockMap::iterator iter = _blocks.find(key);
+	if (iter == _blocks.end())
+		return NULL;
+
+	iter->_value->lastUsed = ++_useCounter;
+	return iter->_value;
+}
+
+BundleBlockCache::Block *BundleBlockCache::addBlock(int bundle, int32 index, int32 block) {
+	BlockKey key;
+	key.bundle = bundle;
+	key.index = index;
+	key.block = block;
+
+	Block *cached = NULL;
+	if (_blocks.size() >= MAX_CACHED_BLOCKS) {
+		// Reuse the least recently used block
+		BlockMap::iterator oldest = _blocks.begin();
+		for (BlockMap::iterator iter = _blocks.begin(); iter != _blocks.end(); ++iter) {
+			if (iter->_value->lastUsed < oldest->_value->lastUsed)
+				oldest = iter;
+		}
+		cached = oldest->_value;
+		_blocks.erase(oldest);
+	} else {
+		cached = new Block;
+	}
+
+	cached->size = 0;
+	cached->lastUsed = ++_useCounter;
+	_blocks[key] = cached;
+	return cached;
+}
+
+BundleMgr::BundleMgr(BundleDirCache *cache, BundleBlockCache *blockCache) {
 	_cache = cache;
+	_blockCache = blockCache;
 	_bundleTable = NULL;
 	_compTable = NULL;
 	_numFiles = 0;
@@ -185,6 +247,7 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_fileBundleId = slot;
 	compressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -192,8 +255,6 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 	_indexTable = _cache->getIndexTable(slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
-	_outputSize = 0;
-	_lastBlock = -1;
 
 	return true;
 }
@@ -205,9 +266,8 @@ void BundleMgr::close() {
 		_numFiles = 0;
 		_numCompItems = 0;
 		_compTableLoaded = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
+		_fileBundleId = -1;
 		free(_compTable);
 		_compTable = NULL;
 		free(_compInputBuff);
@@ -245,6 +305,38 @@ bool BundleMgr::loadCompTable(int32 index) {
 	return true;
 }
 
+BundleBlockCache::Block *BundleMgr::decompressBlock(int32 index, int32 block) {
+	BundleBlockCache::Block *cached = _blockCache->addBlock(_fileBundleId, index, block);
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	cached->size = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, cached->data, _compTable[block].size);
+	if (cached->size > 0x2000) {
+		error("_outputSize: %d", cached->size);
+	}
+
+	return cached;
+}
+
+void BundleMgr::readAheadByCurIndex(int32 offset, int32 size, int headerSize) {
+	if (!_file->isOpen() || _curSampleId == -1 || !_compTableLoaded || size <= 0)
+		return;
+
+	int firstBlock = (offset + headerSize) / 0x2000;
+	int lastBlock = (offset + headerSize + size - 1) / 0x2000;
+	if (lastBlock >= _numCompItems)
+		lastBlock = _numCompItems - 1;
+
+	for (int i = firstBlock; i <= lastBlock; i++) {
+		if (!_blockCache->getBlock(_fileBundleId, _curSampleId, i)) {
+			decompressBlock(_curSampleId, i);
+			_blockCache->_readAhead++;
+		}
+	}
+}
+
 int32 BundleMgr::decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside) {
 	return decompressSampleByIndex(_curSampleId, offset, size, compFinal, headerSize, headerOutside);
 }
@@ -286,19 +378,15 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	skip = (offset + headerSize) % 0x2000;
 
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
-			}
-			_lastBlock = i;
+		BundleBlockCache::Block *block = _blockCache->getBlock(_fileBundleId, index, i);
+		if (block) {
+			_blockCache->_hits++;
+		} else {
+			block = decompressBlock(index, i);
+			_blockCache->_misses++;
 		}
 
-		outputSize = _outputSize;
+		outputSize = block->size;
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -315,7 +403,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, block->data + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
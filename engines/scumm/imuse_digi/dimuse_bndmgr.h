@@ -24,6 +24,7 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 
 namespace Scumm {
 
@@ -63,6 +64,54 @@ public:
 	bool isSndDataExtComp(int slot);
 };
 
+/**
+ * Decompressed blocks of bundled sounds, shared by all open bundles. Tracks
+ * playing the same sound, like the ones cross fading between music states,
+ * thus only decompress every block once.
+ */
+class BundleBlockCache {
+public:
+	struct Block {
+		byte data[0x2000];
+		int32 size;
+		uint32 lastUsed;
+	};
+
+	BundleBlockCache();
+	~BundleBlockCache();
+
+	Block *getBlock(int bundle, int32 index, int32 block);
+	Block *addBlock(int bundle, int32 index, int32 block);
+	void purge();
+
+	uint getSize() const { return _blocks.size(); }
+
+	uint32 _hits, _misses;	// blocks needed for playing sounds
+	uint32 _readAhead;		// blocks decompressed ahead of time
+
+private:
+	struct BlockKey {
+		int bundle;
+		int32 index;
+		int32 block;
+
+		bool operator==(const BlockKey &other) const {
+			return bundle == other.bundle && index == other.index && block == other.block;
+		}
+	};
+
+	struct BlockKeyHash {
+		uint operator()(const BlockKey &key) const {
+			return key.bundle ^ (key.index << 2) ^ (key.block << 14);
+		}
+	};
+
+	typedef Common::HashMap<BlockKey, Block *, BlockKeyHash> BlockMap;
+
+	BlockMap _blocks;
+	uint32 _useCounter;
+};
+
 class BundleMgr {
 
 private:
@@ -74,6 +123,7 @@ private:
 	};
 
 	BundleDirCache *_cache;
+	BundleBlockCache *_blockCache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable;
 	CompTable *_compTable;
@@ -84,16 +134,14 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
 
 	bool loadCompTable(int32 index);
+	BundleBlockCache::Block *decompressBlock(int32 index, int32 block);
 
 public:
 
-	BundleMgr(BundleDirCache *_cache);
+	BundleMgr(BundleDirCache *cache, BundleBlockCache *blockCache);
 	~BundleMgr();
 
 	bool open(const char *filename, bool &compressed, bool errorFlag = false);
@@ -102,6 +150,7 @@ public:
 	int32 decompressSampleByName(const char *name, int32 offset, int32 size, byte **compFinal, bool headerOutside);
 	int32 decompressSampleByIndex(int32 index, int32 offset, int32 size, byte **compFinal, int header_size, bool headerOutside);
 	int32 decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside);
+	void readAheadByCurIndex(int32 offset, int32 size, int headerSize);
 };
 
 } // End of namespace Scumm
@@ -46,6 +46,7 @@ ImuseDigiSndMgr::ImuseDigiSndMgr(ScummEngine *scumm) {
 	_disk = 0;
 	_cacheBundleDir = new BundleDirCache();
 	assert(_cacheBundleDir);
+	_cacheBundleBlocks = new BundleBlockCache();
 	BundleCodecs::initializeImcTables();
 }
 
@@ -55,6 +56,7 @@ ImuseDigiSndMgr::~ImuseDigiSndMgr() {
 	}
 
 	delete _cacheBundleDir;
+	delete _cacheBundleBlocks;
 	BundleCodecs::releaseImcTables();
 }
 
@@ -320,7 +322,7 @@ ImuseDigiSndMgr::SoundDesc *ImuseDigiSndMgr::allocSlot() {
 bool ImuseDigiSndMgr::openMusicBundle(SoundDesc *sound, int &disk) {
 	bool result = false;
 
-	sound->bundle = new BundleMgr(_cacheBundleDir);
+	sound->bundle = new BundleMgr(_cacheBundleDir, _cacheBundleBlocks);
 	assert(sound->bundle);
 	if (_vm->_game.id == GID_CMI) {
 		if (_vm->_game.features & GF_DEMO) {
@@ -355,7 +357,7 @@ bool ImuseDigiSndMgr::openMusicBundle(SoundDesc *sound, int &disk) {
 bool ImuseDigiSndMgr::openVoiceBundle(SoundDesc *sound, int &disk) {
 	bool result = false;
 
-	sound->bundle = new BundleMgr(_cacheBundleDir);
+	sound->bundle = new BundleMgr(_cacheBundleDir, _cacheBundleBlocks);
 	assert(sound->bundle);
 	if (_vm->_game.id == GID_CMI) {
 		if (_vm->_game.features & GF_DEMO) {
@@ -632,6 +634,24 @@ int ImuseDigiSndMgr::getJumpFade(SoundDesc *soundDesc, int number) {
 	return soundDesc->jump[number].fadeDelay;
 }
 
+int32 ImuseDigiSndMgr::readAheadRegion(SoundDesc *soundDesc, int region, int32 offset, int32 size) {
+	assert(checkForProperHandle(soundDesc));
+	assert(region >= 0 && region < soundDesc->numRegions);
+
+	// Same as getDataFromRegion(), only that the blocks end up in the cache
+	int32 region_length = soundDesc->region[region].length;
+	int32 offset_data = soundDesc->offsetData;
+	int32 start = soundDesc->region[region].offset - offset_data;
+
+	if (offset + size + offset_data > region_length)
+		size = MAX<int32>(region_length - offset, 0);
+
+	if (soundDesc->bundle && !soundDesc->compressed)
+		soundDesc->bundle->readAheadByCurIndex(start + offset, size, soundDesc->offsetData);
+
+	return size;
+}
+
 int32 ImuseDigiSndMgr::getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size) {
 	debug(6, "getDataFromRegion() region:%d, offset:%d, size:%d, numRegions:%d", region, offset, size, soundDesc->numRegions);
 	assert(checkForProperHandle(soundDesc));
@@ -115,6 +115,7 @@ private:
 	ScummEngine *_vm;
 	byte _disk;
 	BundleDirCache *_cacheBundleDir;
+	BundleBlockCache *_cacheBundleBlocks;
 
 	bool openMusicBundle(SoundDesc *sound, int &disk);
 	bool openVoiceBundle(SoundDesc *sound, int &disk);
@@ -130,6 +131,8 @@ public:
 	void closeSound(SoundDesc *soundDesc);
 	SoundDesc *cloneSound(SoundDesc *soundDesc);
 
+	const BundleBlockCache *getBlockCache() const { return _cacheBundleBlocks; }
+
 	bool isSndDataExtComp(SoundDesc *soundDesc);
 	int getFreq(SoundDesc *soundDesc);
 	int getBits(SoundDesc *soundDesc);
@@ -146,6 +149,7 @@ public:
 	void getSyncSizeAndPtrById(SoundDesc *soundDesc, int number, int32 &sync_size, byte **sync_ptr);
 
 	int32 getDataFromRegion(SoundDesc *soundDesc, int region, byte **buf, int32 offset, int32 size);
+	int32 readAheadRegion(SoundDesc *soundDesc, int region, int32 offset, int32 size);
 };
 
 } // End of namespace Scumm
@@ -55,6 +55,7 @@ MODULE_OBJS := \
 	resource_v3.o \
 	resource_v4.o \
 	resource.o \
+	resource_prefetch.o \
 	room.o \
 	saveload.o \
 	script_v0.o \
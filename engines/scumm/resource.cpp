@@ -535,12 +535,15 @@ void ResourceManager::allocResTypeData(ResType type, uint32 tag, int num, ResTyp
 	if (num >= 8000)
 		error("Too many %s resources (%d) in directory", nameOfResType(type), num);
 
-	_types[type]._mode = mode;
-	_types[type]._tag = tag;
-
 	// If there was data in there, let's clear it out completely. This is important
 	// in case we are restarting the game.
+	ResId idx = _types[type].size();
+	while (idx-- > 0)
+		nukeResource(type, idx);
 	_types[type].clear();
+
+	_types[type]._mode = mode;
+	_types[type]._tag = tag;
 	_types[type].resize(num);
 
 /*
@@ -697,6 +700,8 @@ int ScummEngine::loadResource(ResType type, ResId idx) {
 		error("Cannot read resource");
 	}
 
+	_res->notePrefetchUse(type, idx);
+
 	return 1;
 }
 
@@ -737,7 +742,12 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 
 	// If the resource is missing, but loadable from the game data files, try to do so.
 	if (!_res->_types[type][idx]._address && _res->_types[type]._mode != kDynamicResTypeMode) {
+		_res->_types[type]._misses++;
 		ensureResourceLoaded(type, idx);
+	} else {
+		_res->_types[type]._hits++;
+		if (_res->_types[type][idx]._prefetched)
+			_res->usePrefetched(type, idx);
 	}
 
 	ptr = (byte *)_res->_types[type][idx]._address;
@@ -777,19 +787,70 @@ void ResourceManager::increaseExpireCounter() {
 }
 
 void ResourceManager::increaseResourceCounters() {
-	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-		ResId idx = _types[type].size();
-		while (idx-- > 0) {
-			byte counter = _types[type][idx].getResourceCounter();
-			if (counter && counter < RF_USAGE_MAX) {
-				setResourceCounter(type, idx, counter + 1);
-			}
+	// Only the counters of resources which can be expired matter
+	for (uint32 id = _lruHead; id != RES_LRU_NONE; id = getLRUResource(id)._lruNext) {
+		Resource &res = getLRUResource(id);
+		byte counter = res.getResourceCounter();
+		if (counter && counter < RF_USAGE_MAX) {
+			res.setResourceCounter(counter + 1);
 		}
 	}
 }
 
 void ResourceManager::setResourceCounter(ResType type, ResId idx, byte counter) {
-	_types[type][idx].setResourceCounter(counter);
+	Resource &res = _types[type][idx];
+	res.setResourceCounter(counter);
+
+	// Just used resources go last, the ones scripts don't need anymore first
+	if (res._address && _types[type]._mode != kDynamicResTypeMode) {
+		if (counter == 1 && _lruTail != (uint32)((type << 16) | idx)) {
+			unlinkLRU(type, idx);
+			linkLRU(type, idx, true);
+		} else if (counter >= RF_USAGE_MAX) {
+			unlinkLRU(type, idx);
+			linkLRU(type, idx, false);
+		}
+	}
+}
+
+void ResourceManager::linkLRU(ResType type, ResId idx, bool mostRecent) {
+	const uint32 id = (type << 16) | idx;
+	Resource &res = _types[type][idx];
+
+	if (mostRecent) {
+		res._lruPrev = _lruTail;
+		res._lruNext = RES_LRU_NONE;
+		if (_lruTail != RES_LRU_NONE)
+			getLRUResource(_lruTail)._lruNext = id;
+		else
+			_lruHead = id;
+		_lruTail = id;
+	} else {
+		res._lruPrev = RES_LRU_NONE;
+		res._lruNext = _lruHead;
+		if (_lruHead != RES_LRU_NONE)
+			getLRUResource(_lruHead)._lruPrev = id;
+		else
+			_lruTail = id;
+		_lruHead = id;
+	}
+}
+
+void ResourceManager::unlinkLRU(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+
+	if (res._lruPrev != RES_LRU_NONE)
+		getLRUResource(res._lruPrev)._lruNext = res._lruNext;
+	else
+		_lruHead = res._lruNext;
+
+	if (res._lruNext != RES_LRU_NONE)
+		getLRUResource(res._lruNext)._lruPrev = res._lruPrev;
+	else
+		_lruTail = res._lruPrev;
+
+	res._lruPrev = RES_LRU_NONE;
+	res._lruNext = RES_LRU_NONE;
 }
 
 void ResourceManager::Resource::setResourceCounter(byte counter) {
@@ -833,6 +894,8 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
+	if (_types[type]._mode != kDynamicResTypeMode)
+		linkLRU(type, idx, true);
 	setResourceCounter(type, idx, 1);
 	return ptr;
 }
@@ -844,6 +907,9 @@ ResourceManager::Resource::Resource() {
 	_status = 0;
 	_roomno = 0;
 	_roomoffs = 0;
+	_lruPrev = RES_LRU_NONE;
+	_lruNext = RES_LRU_NONE;
+	_prefetched = false;
 }
 
 ResourceManager::Resource::~Resource() {
@@ -857,11 +923,15 @@ void ResourceManager::Resource::nuke() {
 	_size = 0;
 	_flags = 0;
 	_status &= ~RS_MODIFIED;
+	_prefetched = false;
 }
 
 ResourceManager::ResTypeData::ResTypeData() {
 	_mode = kDynamicResTypeMode;
 	_tag = 0;
+	_hits = 0;
+	_misses = 0;
+	_expired = 0;
 }
 
 ResourceManager::ResTypeData::~ResTypeData() {
@@ -872,6 +942,13 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_nukeCount = 0;
+	_lruHead = RES_LRU_NONE;
+	_lruTail = RES_LRU_NONE;
+	_prefetchRoom = -1;
+	_prefetching = false;
+	_prefetchUsedInRoom = 0;
+	memset(&_prefetchStats, 0, sizeof(_prefetchStats));
 }
 
 ResourceManager::~ResourceManager() {
@@ -897,8 +974,13 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 	byte *ptr = _types[type][idx]._address;
 	if (ptr != NULL) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
+		if (_types[type]._mode != kDynamicResTypeMode)
+			unlinkLRU(type, idx);
+		if (_types[type][idx]._prefetched)
+			_prefetchStats.wasted++;
 		_allocatedSize -= _types[type][idx]._size;
 		_types[type][idx].nuke();
+		_nukeCount++;
 	}
 }
 
@@ -1033,9 +1115,6 @@ void ResourceManager::Resource::setOnHeap() {
 }
 
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
-	ResType best_type;
-	int best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1048,31 +1127,20 @@ void ResourceManager::expireResources(uint32 size) {
 
 	oldAllocatedSize = _allocatedSize;
 
-	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
-				}
-			}
+	// Expire the least recently used resources first. Like before, ones
+	// which were used since the counters were last increased stay.
+	uint32 id = _lruHead;
+	while (id != RES_LRU_NONE && size + _allocatedSize > _minHeapThreshold) {
+		const ResType type = (ResType)(id >> 16);
+		const ResId idx = id & 0xFFFF;
+		Resource &tmp = _types[type][idx];
+		id = tmp._lruNext;
+
+		if (!tmp.isLocked() && tmp.getResourceCounter() >= 2 && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+			nukeResource(type, idx);
+			_types[type]._expired++;
 		}
-
-		if (!best_type)
-			break;
-		nukeResource(best_type, best_res);
-	} while (size + _allocatedSize > _minHeapThreshold);
+	}
 
 	increaseResourceCounters();
 
@@ -1080,6 +1148,7 @@ void ResourceManager::expireResources(uint32 size) {
 }
 
 void ResourceManager::freeResources() {
+	_prefetchQueue.clear();
 	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 		ResId idx = _types[type].size();
 		while (idx-- > 0) {
@@ -1119,6 +1188,15 @@ bool ResourceManager::isResourceLoaded(ResType type, ResId idx) const {
 	return _types[type][idx]._address != NULL;
 }
 
+void ResourceManager::resetStats() {
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		_types[type]._hits = 0;
+		_types[type]._misses = 0;
+		_types[type]._expired = 0;
+	}
+	memset(&_prefetchStats, 0, sizeof(_prefetchStats));
+}
+
 void ResourceManager::resourceStats() {
 	uint32 lockedSize = 0, lockedNum = 0;
 
@@ -23,6 +23,8 @@
 #define SCUMM_RESOURCE_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/list.h"
 #include "scumm/scumm.h"	// for ResType
 
 namespace Scumm {
@@ -45,7 +47,8 @@ public:
 };
 
 enum {
-	RES_INVALID_OFFSET = 0xFFFFFFFF
+	RES_INVALID_OFFSET = 0xFFFFFFFF,
+	RES_LRU_NONE = 0xFFFFFFFF	// end of the list of resources to expire
 };
 
 class ScummEngine;
@@ -80,6 +83,7 @@ protected:
 
 public:
 	class Resource {
+	friend class ResourceManager;
 	public:
 		/**
 		 * Pointer to the data contained in this resource
@@ -109,6 +113,12 @@ public:
 		 */
 		byte _status;
 
+		/**
+		 * Neighbors in the list of loaded resources that could be expired,
+		 * see ResourceManager::_lruHead. Packed as (type << 16) | idx.
+		 */
+		uint32 _lruPrev, _lruNext;
+
 	public:
 		/**
 		 * The id of the room (resp. the disk) the resource is contained in.
@@ -125,6 +135,12 @@ public:
 		 */
 		uint32 _roomoffs;
 
+		/**
+		 * Whether the resource was loaded ahead of time, and hasn't been
+		 * used since. See ResourceManager::prefetchStep().
+		 */
+		bool _prefetched;
+
 	public:
 		Resource();
 		~Resource();
@@ -164,6 +180,13 @@ public:
 		 */
 		uint32 _tag;
 
+		/**
+		 * Statistics: how often a resource of this type was needed while it
+		 * was loaded, how often it had to be loaded, and how often one was
+		 * expired to make room for others.
+		 */
+		uint32 _hits, _misses, _expired;
+
 	public:
 		ResTypeData();
 		~ResTypeData();
@@ -174,12 +197,45 @@ protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
+	uint32 _nukeCount;
+
+	/**
+	 * Loaded resources of types which can be reloaded from the data files,
+	 * from the least to the most recently used one. Resources are moved in
+	 * O(1) when used, and expireResources() takes them from the head.
+	 */
+	uint32 _lruHead, _lruTail;
+
+	Resource &getLRUResource(uint32 id) { return _types[id >> 16][id & 0xFFFF]; }
+	void linkLRU(ResType type, ResId idx, bool mostRecent);
+	void unlinkLRU(ResType type, ResId idx);
+
+	// Prefetching, see resource_prefetch.cpp. Resources are packed as
+	// (type << 16) | idx, like in the LRU list.
+	typedef Common::HashMap<int, Common::Array<uint32> > PrefetchRoomResources;
+	typedef Common::HashMap<int, Common::Array<int> > PrefetchRoomSuccessors;
+
+	int _prefetchRoom;
+	bool _prefetching;
+	Common::Array<uint32> _prefetchPendingUses;
+	PrefetchRoomResources _prefetchRoomResources;
+	PrefetchRoomSuccessors _prefetchRoomSuccessors;
+	Common::List<uint32> _prefetchQueue;
+	uint32 _prefetchUsedInRoom;
+
+	bool isPrefetchableType(ResType type) const;
+	bool isInOpenRoomFile(ResType type, ResId idx) const;
+	void queuePrefetchForRoom(int room);
 
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
 
 	void setHeapThreshold(int min, int max);
+	uint32 getMinHeapThreshold() const { return _minHeapThreshold; }
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
+	uint32 getAllocatedSize() const { return _allocatedSize; }
+	void resetStats();
 
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
@@ -187,6 +243,12 @@ public:
 	byte *createResource(ResType type, ResId idx, uint32 size);
 	void nukeResource(ResType type, ResId idx);
 
+	/**
+	 * Returns how many resources got freed so far. Pointers into resources
+	 * obtained before this changed may be stale.
+	 */
+	uint32 getNukeCount() const { return _nukeCount; }
+
 //	inline Resource &getRes(ResType type, ResId idx) { return _types[type][idx]; }
 //	inline const Resource &getRes(ResType type, ResId idx) const { return _types[type][idx]; }
 
@@ -215,8 +277,8 @@ public:
 	void setResourceCounter(ResType type, ResId idx, byte counter);
 
 	/**
-	 * Increment the counter of all unlocked loaded resources.
-	 * The maximal count is 255.
+	 * Increment the counter of all loaded resources which could be expired.
+	 * The maximal count is 127.
 	 * This is called by increaseExpireCounter and expireResources,
 	 * but also by ScummEngine::startScene.
 	 */
@@ -224,6 +286,33 @@ public:
 
 	void resourceStats();
 
+	struct PrefetchStats {
+		uint32 roomChanges;	// rooms entered
+		uint32 queued;		// resources queued for loading ahead of time
+		uint32 prefetched;	// resources loaded ahead of time
+		uint32 used;		// prefetched resources used, i.e. loads avoided
+		uint32 wasted;		// prefetched resources expired unused
+	} _prefetchStats;
+
+	/**
+	 * Called when entering a room. Remembers which resources got loaded since
+	 * the last room was entered, and queues the resources of the rooms which
+	 * were entered from the new one before for prefetching.
+	 */
+	void setPrefetchRoom(int room);
+
+	/** Called for every resource loaded from the data files. */
+	void notePrefetchUse(ResType type, ResId idx);
+
+	/** Called for every use of a resource which was prefetched. */
+	void usePrefetched(ResType type, ResId idx);
+
+	/**
+	 * Loads one queued resource. Called while the engine waits for the next
+	 * frame, returns false when there is nothing left to do.
+	 */
+	bool prefetchStep();
+
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
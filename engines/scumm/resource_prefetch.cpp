@@ -0,0 +1,198 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Resource prefetching: entering a room loads the room, its scripts and the
+// costumes it uses synchronously, right when the scripts need them. We
+// remember which resources got loaded after entering a room, and while the
+// engine waits for the next frame we load the resources of the rooms that
+// were entered from the current one before, as far as they are in the disk
+// file that is open already.
+
+#include "scumm/resource.h"
+#include "scumm/scumm.h"
+
+namespace Scumm {
+
+extern const char *nameOfResType(ResType type);
+
+enum {
+	MAX_PREFETCH_ROOM_RESOURCES = 64,
+	MAX_PREFETCH_ROOM_SUCCESSORS = 3
+};
+
+bool ResourceManager::isPrefetchableType(ResType type) const {
+	// Sounds are left out on purpose: loading them may also set up
+	// streaming, and they are big
+	switch (type) {
+	case rtRoom:
+		// Loading the room of a v5 game through ensureResourceLoaded() sets
+		// VAR_ROOM_FLAG, which scripts see. A prefetched room wouldn't.
+		return _vm->_game.version != 5;
+	case rtRoomImage:
+	case rtRoomScripts:
+	case rtScript:
+	case rtCostume:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void ResourceManager::notePrefetchUse(ResType type, ResId idx) {
+	if (_prefetching || !isPrefetchableType(type))
+		return;
+
+	const uint32 id = (type << 16) | idx;
+	for (uint i = 0; i < _prefetchPendingUses.size(); i++) {
+		if (_prefetchPendingUses[i] == id)
+			return;
+	}
+
+	if (_prefetchPendingUses.size() < MAX_PREFETCH_ROOM_RESOURCES)
+		_prefetchPendingUses.push_back(id);
+}
+
+void ResourceManager::usePrefetched(ResType type, ResId idx) {
+	_types[type][idx]._prefetched = false;
+	_prefetchStats.used++;
+	_prefetchUsedInRoom++;
+}
+
+void ResourceManager::setPrefetchRoom(int room) {
+	// Older games keep several rooms in one file and use a different
+	// resource layout, leave them alone
+	if (_vm->_game.version < 5)
+		return;
+
+	if (_prefetchRoom != -1) {
+		debugC(DEBUG_RESOURCE, "Room %d: %d resources loaded, %d loads avoided by prefetching",
+				_prefetchRoom, _prefetchPendingUses.size(), _prefetchUsedInRoom);
+
+		// Everything loaded since the last room change was needed for the
+		// room being left. That replaces what was remembered from the last
+		// visit. Rooms which are reentered right away, like after a close
+		// up, keep what they had.
+		if (_prefetchRoom != room) {
+			_prefetchRoomResources[_prefetchRoom] = _prefetchPendingUses;
+
+			Common::Array<int> &successors = _prefetchRoomSuccessors[_prefetchRoom];
+			for (uint i = 0; i < successors.size(); i++) {
+				if (successors[i] == room) {
+					successors.remove_at(i);
+					break;
+				}
+			}
+			successors.insert_at(0, room);
+			if (successors.size() > MAX_PREFETCH_ROOM_SUCCESSORS)
+				successors.resize(MAX_PREFETCH_ROOM_SUCCESSORS);
+		}
+	}
+
+	_prefetchPendingUses.clear();
+	_prefetchUsedInRoom = 0;
+	_prefetchStats.roomChanges++;
+
+	_prefetchRoom = room;
+	queuePrefetchForRoom(room);
+}
+
+void ResourceManager::queuePrefetchForRoom(int room) {
+	_prefetchQueue.clear();
+
+	if (!_prefetchRoomSuccessors.contains(room))
+		return;
+
+	// Rooms that were entered from this one most recently come first
+	const Common::Array<int> &successors = _prefetchRoomSuccessors[room];
+	for (uint i = 0; i < successors.size(); i++) {
+		if (!_prefetchRoomResources.contains(successors[i]))
+			continue;
+
+		const Common::Array<uint32> &roomResources = _prefetchRoomResources[successors[i]];
+		for (uint j = 0; j < roomResources.size(); j++) {
+			if (!getLRUResource(roomResources[j])._address) {
+				_prefetchQueue.push_back(roomResources[j]);
+				_prefetchStats.queued++;
+			}
+		}
+	}
+
+	debugC(DEBUG_RESOURCE, "Room %d: %d resources queued for prefetching", room, _prefetchQueue.size());
+}
+
+bool ResourceManager::isInOpenRoomFile(ResType type, ResId idx) const {
+	// Only the rooms of the disk file that is open already have an offset.
+	// For any other room, openRoom() would switch files, which may ask the
+	// player for another disk and sets VAR_CURRENTDISK in v8 games.
+	if (_vm->_lastLoadedRoom <= 0 || _vm->_game.heversion >= 98)
+		return false;
+
+	const int room = _vm->getResourceRoomNr(type, idx);
+	if (room <= 0 || room >= _vm->_numRooms)
+		return false;
+
+	const uint32 roomOffs = _types[rtRoom][room]._roomoffs;
+	return roomOffs != 0 && roomOffs != RES_INVALID_OFFSET;
+}
+
+bool ResourceManager::prefetchStep() {
+	while (!_prefetchQueue.empty()) {
+		// Don't push out what the current room uses
+		if (_allocatedSize >= _minHeapThreshold) {
+			_prefetchQueue.clear();
+			return false;
+		}
+
+		const uint32 id = _prefetchQueue.front();
+		_prefetchQueue.pop_front();
+
+		const ResType type = (ResType)(id >> 16);
+		const ResId idx = id & 0xFFFF;
+
+		// Skip anything that got loaded in the meantime
+		if (_types[type][idx]._address || !isInOpenRoomFile(type, idx))
+			continue;
+
+		// openRoom() only moves to the room's offset in the open file then.
+		// Move back, so that nothing sees a difference.
+		const int lastLoadedRoom = _vm->_lastLoadedRoom;
+		const uint32 fileOffset = _vm->_fileOffset;
+		_prefetching = true;
+		_vm->loadResource(type, idx);
+		_prefetching = false;
+		_vm->_lastLoadedRoom = lastLoadedRoom;
+		_vm->_fileOffset = fileOffset;
+
+		Resource &res = _types[type][idx];
+		if (!res._address)
+			continue;
+
+		debugC(DEBUG_RESOURCE, "Prefetched %s %d", nameOfResType(type), idx);
+		res._prefetched = true;
+		_prefetchStats.prefetched++;
+		return true;
+	}
+
+	return false;
+}
+
+} // End of namespace Scumm
@@ -128,8 +128,10 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 	if (VAR_ROOM_RESOURCE != 0xFF)
 		VAR(VAR_ROOM_RESOURCE) = _roomResource;
 
-	if (room != 0)
+	if (room != 0) {
+		_res->setPrefetchRoom(_roomResource);
 		ensureResourceLoaded(rtRoom, room);
+	}
 
 	clearRoomObjects();
 
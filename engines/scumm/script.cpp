@@ -21,6 +21,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/debug-channels.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -440,22 +441,45 @@ void ScummEngine::resetScriptPointer() {
 }
 
 /**
- * This method checks whether the resource that contains the active script
- * moved, and if so, updates the script pointer accordingly.
+ * Called when the resource that contains the active script moved, to update
+ * the script pointer accordingly.
  *
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
+void ScummEngine::updateScriptPointer() {
+	long oldoffs = _scriptPointer - _scriptOrgPointer;
+	getScriptBaseAddress();
+	_scriptPointer = _scriptOrgPointer + oldoffs;
 }
 
 /** Execute a script - Read opcode, and execute it from the table */
 void ScummEngine::executeScript() {
+	uint32 startTime = 0;
+	if (_executeScriptDepth++ == 0)
+		startTime = _system->getMillis();
+
+	// debugC() also prints everything at debug level 9
+	if (_showStack || _hexdumpScripts || gDebugLevel >= 9 || DebugMan.isDebugChannelEnabled(DEBUG_OPCODES)) {
+		executeScriptDebug();
+	} else {
+		uint32 opcodes = 0;
+		while (_currentScript != 0xFF) {
+			_opcode = fetchScriptByte();
+			if (_game.version > 2) // V0-V2 games didn't use the didexec flag
+				vm.slot[_currentScript].didexec = true;
+			executeOpcode(_opcode);
+			opcodes++;
+		}
+		_opcodesExecuted += opcodes;
+	}
+
+	if (--_executeScriptDepth == 0)
+		_scriptExecutionTime += _system->getMillis() - startTime;
+}
+
+/** Same as executeScript(), with the debug output for every opcode */
+void ScummEngine::executeScriptDebug() {
 	int c;
 	while (_currentScript != 0xFF) {
 
@@ -482,16 +506,12 @@ void ScummEngine::executeScript() {
 		}
 
 		executeOpcode(_opcode);
-
+		_opcodesExecuted++;
 	}
 }
 
-void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
-	else {
-		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
-	}
+void ScummEngine::invalidOpcode(byte i) {
+	error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
 }
 
 const char *ScummEngine::getOpcodeDesc(byte i) {
@@ -502,11 +522,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
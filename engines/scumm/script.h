@@ -23,14 +23,21 @@
 #ifndef SCUMM_SCRIPT_H
 #define SCUMM_SCRIPT_H
 
-#include "common/func.h"
+#include "common/noncopyable.h"
 
 namespace Scumm {
 
-typedef Common::Functor0<void> Opcode;
+class ScummEngine;
+
+/**
+ * Opcode handlers are member functions of the engine classes for the various
+ * SCUMM versions. They are stored as plain member function pointers, so that
+ * dispatching an opcode is a single indirect call.
+ */
+typedef void (ScummEngine::*OpcodeProc)();
 
 struct OpcodeEntry : Common::NonCopyable {
-	Opcode *proc;
+	OpcodeProc proc;
 #ifndef REDUCE_MEMORY_USAGE
 	const char *desc;
 #endif
@@ -40,15 +47,9 @@ struct OpcodeEntry : Common::NonCopyable {
 #else
 	OpcodeEntry() : proc(0) {}
 #endif
-	~OpcodeEntry() {
-		setProc(0, 0);
-	}
 
-	void setProc(Opcode *p, const char *d) {
-		if (proc != p) {
-			delete proc;
-			proc = p;
-		}
+	void setProc(OpcodeProc p, const char *d) {
+		proc = p;
 #ifndef REDUCE_MEMORY_USAGE
 		desc = d;
 #endif
@@ -59,9 +60,9 @@ struct OpcodeEntry : Common::NonCopyable {
 // This is to help devices with small memory (PDA, smartphones, ...)
 // to save abit of memory used by opcode names in the Scumm engine.
 #ifndef REDUCE_MEMORY_USAGE
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), #x)
+#	define _OPCODE(ver, x)	setProc(static_cast<OpcodeProc>(&ver::x), #x)
 #else
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), "")
+#	define _OPCODE(ver, x)	setProc(static_cast<OpcodeProc>(&ver::x), "")
 #endif
 
 /**
@@ -531,6 +531,14 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 
 	_hexdumpScripts = false;
 	_showStack = false;
+	_opcodesExecuted = 0;
+	_scriptExecutionTime = 0;
+	_executeScriptDepth = 0;
+	_screenUploadRects = 0;
+	_screenUploadBytes = 0;
+	_lastScreenUploadRects = 0;
+	_lastScreenUploadBytes = 0;
+	_maxScreenUploadBytes = 0;
 
 	if (_game.platform == Common::kPlatformFMTowns && _game.version == 3) {	// FM-TOWNS V3 games use 320x240
 		_screenWidth = 320;
@@ -1081,7 +1089,7 @@ Common::Error ScummEngine::init() {
 			// code in openResourceFile() (and in the Sound class, for MONSTER.SOU
 			// handling).
 			assert(_game.version >= 5 && _game.heversion == 0);
-			_fileHandle = new ScummFile();
+			_fileHandle = new ScummFile(true);
 			_containerFile = _filenamePattern.pattern;
 
 
@@ -1131,7 +1139,7 @@ Common::Error ScummEngine::init() {
 		}
 	} else {
 		// Regular access, no container file involved
-		_fileHandle = new ScummFile();
+		_fileHandle = new ScummFile(true);
 	}
 
 	// Load CJK font, if present
@@ -1299,6 +1307,7 @@ void ScummEngine::setupScumm() {
 		_bootParam = -1;
 	}
 
+	int minHeapThreshold = 400000;
 	int maxHeapThreshold = -1;
 
 	if (_game.features & GF_16BIT_COLOR) {
@@ -1312,7 +1321,15 @@ void ScummEngine::setupScumm() {
 		maxHeapThreshold = 550000;
 	}
 
-	_res->setHeapThreshold(400000, maxHeapThreshold);
+	// The thresholds can be set in bytes, for large HE and v7/v8 games on
+	// systems with little memory or for ones with plenty
+	if (ConfMan.hasKey("heap_threshold_max"))
+		maxHeapThreshold = MAX(ConfMan.getInt("heap_threshold_max"), 1);
+	if (ConfMan.hasKey("heap_threshold_min"))
+		minHeapThreshold = ConfMan.getInt("heap_threshold_min");
+	minHeapThreshold = CLIP(minHeapThreshold, 0, maxHeapThreshold);
+
+	_res->setHeapThreshold(minHeapThreshold, maxHeapThreshold);
 
 	free(_compositeBuf);
 	_compositeBuf = (byte *)malloc(_screenWidth * _textSurfaceMultiplier * _screenHeight * _textSurfaceMultiplier * _outputPixelFormat.bytesPerPixel);
@@ -2047,6 +2064,10 @@ void ScummEngine::waitForTimer(int msec_delay) {
 		_system->updateScreen();
 		if (_system->getMillis() >= start_time + msec_delay)
 			break;
+
+		// Use the time to load what the next room is likely going to need
+		if (_system->getMillis() + 10 < start_time + msec_delay && _res->prefetchStep())
+			continue;
 		_system->delayMillis(10);
 	}
 }
@@ -2437,6 +2458,7 @@ void ScummEngine_v7::scummLoop_handleSound() {
 	ScummEngine_v6::scummLoop_handleSound();
 	if (_imuseDigital) {
 		_imuseDigital->flushTracks();
+		_imuseDigital->readAhead();
 		// In CoMI and the Dig the full (non-demo) version invoke IMuseDigital::refreshScripts
 		if ((_game.id == GID_DIG || _game.id == GID_CMI) && !(_game.features & GF_DEMO))
 			_imuseDigital->refreshScripts();
@@ -644,9 +644,24 @@ protected:
 	OpcodeEntry _opcodes[256];
 
 	virtual void setupOpcodes() = 0;
-	void executeOpcode(byte i);
+	void executeOpcode(byte i) {
+		OpcodeProc proc = _opcodes[i].proc;
+		if (proc)
+			(this->*proc)();
+		else
+			invalidOpcode(i);
+	}
+	void invalidOpcode(byte i);
 	const char *getOpcodeDesc(byte i);
 
+public:
+	// Interpreter statistics, shown by the "opcodes" debugger command
+	uint32 _opcodesExecuted;
+	uint32 _scriptExecutionTime;	// in milliseconds, outside of nested scripts
+
+protected:
+	int _executeScriptDepth;
+
 	void initializeLocals(int slot, int *vars);
 	int	getScriptSlot();
 
@@ -662,6 +677,7 @@ protected:
 	void runObjectScript(int script, int entry, bool freezeResistant, bool recursive, int *vars, int slot = -1, int cycle = 0);
 	void runScriptNested(int script);
 	void executeScript();
+	void executeScriptDebug();
 	void updateScriptPtr();
 	virtual void runInventoryScript(int i);
 	void inventoryScriptIndy3Mac();
@@ -687,8 +703,20 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	/**
+	 * Checks whether the resource that contains the active script moved,
+	 * which can only happen when resources got allocated or freed since
+	 * the last check.
+	 */
+	void refreshScriptPointer() {
+		if (*_lastCodePtr != _scriptOrgPointer)
+			updateScriptPointer();
+	}
+	void updateScriptPointer();
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
 	uint fetchScriptDWord();
@@ -1036,6 +1064,11 @@ protected:
 	void ditherCGA(byte *dst, int dstPitch, int x, int y, int width, int height) const;
 
 public:
+	// Screen upload statistics, see drawStripToScreen()
+	uint32 _screenUploadRects, _screenUploadBytes;			// of the frame being drawn
+	uint32 _lastScreenUploadRects, _lastScreenUploadBytes;	// of the last frame
+	uint32 _maxScreenUploadBytes;
+
 	VirtScreen *findVirtScreen(int y);
 	byte *getMaskBuffer(int x, int y, int z);
 
@@ -24,6 +24,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 
@@ -241,6 +242,10 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_paused = false;
 	_pauseStartTime = 0;
 	_pauseTime = 0;
+	_prefetchBuffer = NULL;
+	_prefetchOffset = 0;
+	_usingPrefetch = false;
+	memset(&_stats, 0, sizeof(_stats));
 }
 
 SmushPlayer::~SmushPlayer() {
@@ -274,6 +279,8 @@ void SmushPlayer::init(int32 speed) {
 	_vm->_mixer->stopHandle(_IACTchannel);
 	_IACTpos = 0;
 	_vm->_smixer->stop();
+
+	memset(&_stats, 0, sizeof(_stats));
 }
 
 void SmushPlayer::release() {
@@ -287,6 +294,8 @@ void SmushPlayer::release() {
 	delete _strings;
 	_strings = NULL;
 
+	freePrefetchedFrame();
+
 	delete _base;
 	_base = NULL;
 
@@ -774,21 +783,39 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 }
 
 #ifdef USE_ZLIB
+byte *SmushPlayer::inflateFrameObject(const byte *chunk, int32 chunkSize, unsigned long &size) {
+	size = READ_BE_UINT32(chunk);
+	byte *fobjBuffer = (byte *)malloc(size);
+	if (!Common::uncompress(fobjBuffer, &size, chunk + 4, chunkSize - 4))
+		error("SmushPlayer::inflateFrameObject() Zlib uncompress error");
+	return fobjBuffer;
+}
+
 void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStream &b) {
 	if (_skipNext) {
 		_skipNext = false;
 		return;
 	}
 
+	// Inflated already when the frame was read ahead?
+	if (_usingPrefetch) {
+		for (uint i = 0; i < _prefetchedObjects.size(); i++) {
+			if (_prefetchedObjects[i].offset == b.pos()) {
+				const byte *ptr = _prefetchedObjects[i].data;
+				decodeFrameObject(READ_LE_UINT16(ptr), ptr + 14, READ_LE_UINT16(ptr + 2), READ_LE_UINT16(ptr + 4),
+								READ_LE_UINT16(ptr + 6), READ_LE_UINT16(ptr + 8));
+				return;
+			}
+		}
+	}
+
 	int32 chunkSize = subSize;
 	byte *chunkBuffer = (byte *)malloc(chunkSize);
 	assert(chunkBuffer);
 	b.read(chunkBuffer, chunkSize);
 
-	unsigned long decompressedSize = READ_BE_UINT32(chunkBuffer);
-	byte *fobjBuffer = (byte *)malloc(decompressedSize);
-	if (!Common::uncompress(fobjBuffer, &decompressedSize, chunkBuffer + 4, chunkSize - 4))
-		error("SmushPlayer::handleZlibFrameObject() Zlib uncompress error");
+	unsigned long decompressedSize;
+	byte *fobjBuffer = inflateFrameObject(chunkBuffer, chunkSize, decompressedSize);
 	free(chunkBuffer);
 
 	byte *ptr = fobjBuffer;
@@ -966,9 +993,74 @@ SmushFont *SmushPlayer::getFont(int font) {
 	return _sf[font];
 }
 
+void SmushPlayer::prefetchNextFrame() {
+	// Frames are read from the file in one go, and the frame objects in them
+	// are inflated, while the player waits for the current frame to be due.
+	// Decoding stays in handleFrame(): each frame is decoded on top of the
+	// previous one, and Insane hooks into the drawing.
+	if (_prefetchBuffer || !_base || _seekPos >= 0 || _endOfFile)
+		return;
+
+	const int32 pos = _base->pos();
+	if (pos + 8 >= (int32)_baseSize)
+		return;
+
+	const uint32 subType = _base->readUint32BE();
+	const int32 subSize = _base->readUint32BE();
+	if (subType != MKTAG('F','R','M','E') || subSize < 0 || pos + 8 + subSize > (int32)_baseSize) {
+		_base->seek(pos, SEEK_SET);
+		return;
+	}
+
+	// One more byte for the padding of an odd sized last sub chunk, which
+	// handleFrame() skips
+	_prefetchBuffer = (byte *)calloc(subSize + 1, 1);
+	assert(_prefetchBuffer);
+	if (_base->read(_prefetchBuffer, subSize) != (uint32)subSize) {
+		_base->seek(pos, SEEK_SET);
+		freePrefetchedFrame();
+		return;
+	}
+	_base->seek(pos, SEEK_SET);
+	_prefetchOffset = pos + 8;
+
+#ifdef USE_ZLIB
+	int32 offset = 0;
+	while (offset + 8 <= subSize) {
+		const uint32 objType = READ_BE_UINT32(_prefetchBuffer + offset);
+		const int32 objSize = READ_BE_UINT32(_prefetchBuffer + offset + 4);
+		offset += 8;
+		if (objSize < 0 || offset + objSize > subSize)
+			break;
+
+		if (objType == MKTAG('Z','F','O','B') && objSize >= 4) {
+			PrefetchedObject obj;
+			obj.offset = offset;
+			obj.data = inflateFrameObject(_prefetchBuffer + offset, objSize, obj.size);
+			_prefetchedObjects.push_back(obj);
+		}
+		offset += objSize + (objSize & 1);
+	}
+#endif
+
+	_stats.prefetched++;
+}
+
+void SmushPlayer::freePrefetchedFrame() {
+	for (uint i = 0; i < _prefetchedObjects.size(); i++)
+		free(_prefetchedObjects[i].data);
+	_prefetchedObjects.clear();
+
+	free(_prefetchBuffer);
+	_prefetchBuffer = NULL;
+	_usingPrefetch = false;
+}
+
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
+		freePrefetchedFrame();
+
 		if (_smixer)
 			_smixer->stop();
 
@@ -1030,13 +1122,24 @@ void SmushPlayer::parseNextFrame() {
 	case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
 		handleAnimHeader(subSize, *_base);
 		break;
-	case MKTAG('F','R','M','E'):
-		handleFrame(subSize, *_base);
+	case MKTAG('F','R','M','E'): {
+		const uint32 startTime = _vm->_system->getMillis();
+		if (_prefetchBuffer && _prefetchOffset == subOffset) {
+			Common::MemoryReadStream frame(_prefetchBuffer, subSize + 1);
+			_usingPrefetch = true;
+			handleFrame(subSize, frame);
+		} else {
+			handleFrame(subSize, *_base);
+		}
+		_stats.frames++;
+		_stats.decodeTime += _vm->_system->getMillis() - startTime;
 		break;
+		}
 	default:
 		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
 	}
 
+	freePrefetchedFrame();
 	_base->seek(subOffset + subSize, SEEK_SET);
 
 	if (_insanity)
@@ -1238,6 +1341,7 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 				_vm->_system->copyRectToScreen(_dst, _width, 0, 0, w, h);
 				_vm->_system->updateScreen();
 				_updateNeeded = false;
+				_stats.shown++;
 			}
 		}
 		if (_endOfFile)
@@ -1249,9 +1353,13 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			_IACTpos = 0;
 			break;
 		}
+		prefetchNextFrame();
 		_vm->_system->delayMillis(10);
 	}
 
+	if (_stats.decodeTime)
+		debugC(DEBUG_SMUSH, "Smush stats: %d frames, %d shown, %d read ahead, decoding at %d fps", _stats.frames, _stats.shown, _stats.prefetched, _stats.frames * 1000 / _stats.decodeTime);
+
 	release();
 
 	// Reset mouse state
@@ -23,6 +23,7 @@
 #if !defined(SCUMM_SMUSH_PLAYER_H) && defined(ENABLE_SCUMM_7_8)
 #define SCUMM_SMUSH_PLAYER_H
 
+#include "common/array.h"
 #include "common/util.h"
 #include "scumm/sound.h"
 
@@ -37,6 +38,14 @@ class Codec47Decoder;
 
 class SmushPlayer {
 	friend class Insane;
+public:
+	struct Stats {
+		uint32 frames;		// frames parsed and decoded
+		uint32 shown;		// frames copied to the screen
+		uint32 prefetched;	// frames read ahead while waiting
+		uint32 decodeTime;	// milliseconds spent in handleFrame()
+	};
+
 private:
 	ScummEngine_v7 *_vm;
 	int32 _nbframes;
@@ -82,6 +91,19 @@ private:
 	bool _middleAudio;
 	bool _skipPalette;
 
+	// The next frame, read and inflated ahead of time, see prefetchNextFrame()
+	struct PrefetchedObject {
+		int32 offset;
+		byte *data;
+		unsigned long size;
+	};
+	byte *_prefetchBuffer;
+	int32 _prefetchOffset;
+	Common::Array<PrefetchedObject> _prefetchedObjects;
+	bool _usingPrefetch;
+
+	Stats _stats;
+
 public:
 	SmushPlayer(ScummEngine_v7 *scumm);
 	~SmushPlayer();
@@ -93,6 +115,9 @@ public:
 	void release();
 	void warpMouse(int x, int y, int buttons);
 
+	/** Statistics of the movie played last. */
+	const Stats &getStats() const { return _stats; }
+
 protected:
 	int _width, _height;
 
@@ -111,6 +136,8 @@ protected:
 private:
 	SmushFont *getFont(int font);
 	void parseNextFrame();
+	void prefetchNextFrame();
+	void freePrefetchedFrame();
 	void init(int32 spped);
 	void setupAnim(const char *file);
 	void updateScreen();
@@ -122,6 +149,7 @@ private:
 	void handleFrame(int32 frameSize, Common::SeekableReadStream &);
 	void handleNewPalette(int32 subSize, Common::SeekableReadStream &);
 #ifdef USE_ZLIB
+	byte *inflateFrameObject(const byte *chunk, int32 chunkSize, unsigned long &size);
 	void handleZlibFrameObject(int32 subSize, Common::SeekableReadStream &b);
 #endif
 	void handleFrameObject(int32 subSize, Common::SeekableReadStream &);
@@ -42,6 +42,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/particles/part_emitter.h"
 #include "engines/wintermute/base/base_engine.h"
 
@@ -936,10 +937,12 @@ void AdActor::initLine(BasePoint startPt, BasePoint endPt) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GoTo / GoToAsync
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GoTo") == 0 || strcmp(name, "GoToAsync") == 0) {
+	case kScNameGoTo:
+	case kScNameGoToAsync: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -954,7 +957,8 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GoToObject / GoToObjectAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoToObject") == 0 || strcmp(name, "GoToObjectAsync") == 0) {
+	case kScNameGoToObject:
+	case kScNameGoToObjectAsync: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (!val->isNative()) {
@@ -984,7 +988,8 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// TurnTo / TurnToAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnTo") == 0 || strcmp(name, "TurnToAsync") == 0) {
+	case kScNameTurnTo:
+	case kScNameTurnToAsync: {
 		stack->correctParams(1);
 		int dir;
 		ScValue *val = stack->pop();
@@ -1013,7 +1018,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsWalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsWalking") == 0) {
+	case kScNameIsWalking: {
 		stack->correctParams(0);
 		stack->pushBool(_state == STATE_FOLLOWING_PATH);
 		return STATUS_OK;
@@ -1022,7 +1027,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// MergeAnims
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MergeAnims") == 0) {
+	case kScNameMergeAnims: {
 		stack->correctParams(1);
 		stack->pushBool(DID_SUCCEED(mergeAnims(stack->pop()->getString())));
 		return STATUS_OK;
@@ -1031,7 +1036,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadAnim") == 0) {
+	case kScNameUnloadAnim: {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 
@@ -1063,12 +1068,14 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// HasAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasAnim") == 0) {
+	case kScNameHasAnim: {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 		stack->pushBool(getAnimByName(animName) != NULL);
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -1078,24 +1085,25 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdActor::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direction
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Direction") {
+	case kScNameDirection: {
 		_scValue->setInt(_dir);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("actor");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TalkAnimName") {
+	case kScNameTalkAnimName: {
 		_scValue->setString(_talkAnimName);
 		return _scValue;
 	}
@@ -1103,7 +1111,7 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkAnimName") {
+	case kScNameWalkAnimName: {
 		_scValue->setString(_walkAnimName);
 		return _scValue;
 	}
@@ -1111,7 +1119,7 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IdleAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IdleAnimName") {
+	case kScNameIdleAnimName: {
 		_scValue->setString(_idleAnimName);
 		return _scValue;
 	}
@@ -1119,7 +1127,7 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnLeftAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TurnLeftAnimName") {
+	case kScNameTurnLeftAnimName: {
 		_scValue->setString(_turnLeftAnimName);
 		return _scValue;
 	}
@@ -1127,10 +1135,12 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnRightAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TurnRightAnimName") {
+	case kScNameTurnRightAnimName: {
 		_scValue->setString(_turnRightAnimName);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scGetProperty(name);
 	}
 }
@@ -1138,10 +1148,11 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdActor::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direction
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Direction") == 0) {
+	case kScNameDirection: {
 		int dir = value->getInt();
 		if (dir >= 0 && dir < NUM_DIRECTIONS) {
 			_dir = (TDirection)dir;
@@ -1152,7 +1163,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TalkAnimName") == 0) {
+	case kScNameTalkAnimName: {
 		if (value->isNULL()) {
 			_talkAnimName = "talk";
 		} else {
@@ -1164,7 +1175,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkAnimName") == 0) {
+	case kScNameWalkAnimName: {
 		if (value->isNULL()) {
 			_walkAnimName = "walk";
 		} else {
@@ -1176,7 +1187,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// IdleAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IdleAnimName") == 0) {
+	case kScNameIdleAnimName: {
 		if (value->isNULL()) {
 			_idleAnimName = "idle";
 		} else {
@@ -1188,7 +1199,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnLeftAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnLeftAnimName") == 0) {
+	case kScNameTurnLeftAnimName: {
 		if (value->isNULL()) {
 			_turnLeftAnimName = "turnleft";
 		} else {
@@ -1200,14 +1211,16 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnRightAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnRightAnimName") == 0) {
+	case kScNameTurnRightAnimName: {
 		if (value->isNULL()) {
 			_turnRightAnimName = "turnright";
 		} else {
 			_turnRightAnimName = value->getString();
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scSetProperty(name, value);
 	}
 }
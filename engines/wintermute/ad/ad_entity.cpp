@@ -47,6 +47,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/video/video_theora_player.h"
 #include "engines/wintermute/utils/utils.h"
@@ -688,10 +689,15 @@ bool AdEntity::update() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// StopSound
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "StopSound") == 0 && _subtype == ENTITY_SOUND) {
+	case kScNameStopSound: {
+		if (_subtype != ENTITY_SOUND) {
+			return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
+		}
+
 		stack->correctParams(0);
 
 		if (DID_FAIL(stopSFX(false))) {
@@ -705,7 +711,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayTheora") == 0) {
+	case kScNamePlayTheora: {
 		stack->correctParams(4);
 		const char *filename = stack->pop()->getString();
 		bool looping = stack->pop()->getBool(false);
@@ -732,7 +738,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StopTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopTheora") == 0) {
+	case kScNameStopTheora: {
 		stack->correctParams(0);
 		if (_theora) {
 			_theora->stop();
@@ -749,7 +755,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsTheoraPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsTheoraPlaying") == 0) {
+	case kScNameIsTheoraPlaying: {
 		stack->correctParams(0);
 		if (_theora && _theora->isPlaying()) {
 			stack->pushBool(true);
@@ -763,7 +769,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PauseTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseTheora") == 0) {
+	case kScNamePauseTheora: {
 		stack->correctParams(0);
 		if (_theora && _theora->isPlaying()) {
 			_theora->pause();
@@ -778,7 +784,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeTheora") == 0) {
+	case kScNameResumeTheora: {
 		stack->correctParams(0);
 		if (_theora && _theora->isPaused()) {
 			_theora->resume();
@@ -793,7 +799,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsTheoraPaused
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsTheoraPaused") == 0) {
+	case kScNameIsTheoraPaused: {
 		stack->correctParams(0);
 		if (_theora && _theora->isPaused()) {
 			stack->pushBool(true);
@@ -808,7 +814,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateRegion") == 0) {
+	case kScNameCreateRegion: {
 		stack->correctParams(0);
 		if (!_region) {
 			_region = new BaseRegion(_gameRef);
@@ -826,7 +832,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteRegion") == 0) {
+	case kScNameDeleteRegion: {
 		stack->correctParams(0);
 		if (_region) {
 			_gameRef->unregisterObject(_region);
@@ -837,7 +843,9 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -847,10 +855,11 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("entity");
 		return _scValue;
 	}
@@ -858,7 +867,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Item
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Item") {
+	case kScNameItem: {
 		if (_item) {
 			_scValue->setString(_item);
 		} else {
@@ -871,7 +880,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Subtype (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Subtype") {
+	case kScNameSubtype: {
 		if (_subtype == ENTITY_SOUND) {
 			_scValue->setString("sound");
 		} else {
@@ -884,7 +893,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkToX") {
+	case kScNameWalkToX: {
 		_scValue->setInt(_walkToX);
 		return _scValue;
 	}
@@ -892,7 +901,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkToY") {
+	case kScNameWalkToY: {
 		_scValue->setInt(_walkToY);
 		return _scValue;
 	}
@@ -900,7 +909,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToDirection
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkToDirection") {
+	case kScNameWalkToDirection: {
 		_scValue->setInt((int)_walkToDir);
 		return _scValue;
 	}
@@ -908,14 +917,16 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Region (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Region") {
+	case kScNameRegion: {
 		if (_region) {
 			_scValue->setNative(_region, true);
 		} else {
 			_scValue->setNULL();
 		}
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scGetProperty(name);
 	}
 }
@@ -924,10 +935,11 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 //////////////////////////////////////////////////////////////////////////
 bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Item
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Item") == 0) {
+	case kScNameItem: {
 		setItem(value->getString());
 		return STATUS_OK;
 	}
@@ -935,7 +947,7 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkToX") == 0) {
+	case kScNameWalkToX: {
 		_walkToX = value->getInt();
 		return STATUS_OK;
 	}
@@ -943,7 +955,7 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkToY") == 0) {
+	case kScNameWalkToY: {
 		_walkToY = value->getInt();
 		return STATUS_OK;
 	}
@@ -951,13 +963,15 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToDirection
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkToDirection") == 0) {
+	case kScNameWalkToDirection: {
 		int dir = value->getInt();
 		if (dir >= 0 && dir < NUM_DIRECTIONS) {
 			_walkToDir = (TDirection)dir;
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scSetProperty(name, value);
 	}
 }
@@ -55,6 +55,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/ui/ui_entity.h"
 #include "engines/wintermute/ui/ui_window.h"
 #include "engines/wintermute/utils/utils.h"
@@ -348,10 +349,11 @@ void AdGame::finishSentences() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// ChangeScene
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "ChangeScene") == 0) {
+	case kScNameChangeScene: {
 		stack->correctParams(3);
 		const char *filename = stack->pop()->getString();
 		ScValue *valFadeOut = stack->pop();
@@ -377,7 +379,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadActor") == 0) {
+	case kScNameLoadActor: {
 		stack->correctParams(1);
 		AdActor *act = new AdActor(_gameRef);
 		if (act && DID_SUCCEED(act->loadFile(stack->pop()->getString()))) {
@@ -394,7 +396,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadEntity") == 0) {
+	case kScNameLoadEntity: {
 		stack->correctParams(1);
 		AdEntity *ent = new AdEntity(_gameRef);
 		if (ent && DID_SUCCEED(ent->loadFile(stack->pop()->getString()))) {
@@ -411,7 +413,10 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject / UnloadActor / UnloadEntity / DeleteEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0 || strcmp(name, "UnloadActor") == 0 || strcmp(name, "UnloadEntity") == 0 || strcmp(name, "DeleteEntity") == 0) {
+	case kScNameUnloadObject:
+	case kScNameUnloadActor:
+	case kScNameUnloadEntity:
+	case kScNameDeleteEntity: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		AdObject *obj = (AdObject *)val->getNative();
@@ -427,7 +432,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEntity") == 0) {
+	case kScNameCreateEntity: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -443,7 +448,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateItem") == 0) {
+	case kScNameCreateItem: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -459,7 +464,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteItem") == 0) {
+	case kScNameDeleteItem: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -481,7 +486,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// QueryItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "QueryItem") == 0) {
+	case kScNameQueryItem: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -508,7 +513,9 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddResponse/AddResponseOnce/AddResponseOnceGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddResponse") == 0 || strcmp(name, "AddResponseOnce") == 0 || strcmp(name, "AddResponseOnceGame") == 0) {
+	case kScNameAddResponse:
+	case kScNameAddResponseOnce:
+	case kScNameAddResponseOnceGame: {
 		stack->correctParams(6);
 		int id = stack->pop()->getInt();
 		const char *text = stack->pop()->getString();
@@ -555,7 +562,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ResetResponse
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResetResponse") == 0) {
+	case kScNameResetResponse: {
 		stack->correctParams(1);
 		int id = stack->pop()->getInt(-1);
 		resetResponse(id);
@@ -566,7 +573,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ClearResponses
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearResponses") == 0) {
+	case kScNameClearResponses: {
 		stack->correctParams(0);
 		_responseBox->clearResponses();
 		_responseBox->clearButtons();
@@ -577,7 +584,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetResponse
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetResponse") == 0) {
+	case kScNameGetResponse: {
 		stack->correctParams(1);
 		bool autoSelectLast = stack->pop()->getBool();
 
@@ -613,7 +620,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNumResponses
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNumResponses") == 0) {
+	case kScNameGetNumResponses: {
 		stack->correctParams(0);
 		if (_responseBox) {
 			_responseBox->weedResponses();
@@ -629,7 +636,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// StartDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StartDlgBranch") == 0) {
+	case kScNameStartDlgBranch: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		Common::String branchName;
@@ -648,7 +655,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// EndDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EndDlgBranch") == 0) {
+	case kScNameEndDlgBranch: {
 		stack->correctParams(1);
 
 		const char *branchName = NULL;
@@ -666,7 +673,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetCurrentDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCurrentDlgBranch") == 0) {
+	case kScNameGetCurrentDlgBranch: {
 		stack->correctParams(0);
 
 		if (_dlgPendingBranches.size() > 0) {
@@ -681,35 +688,35 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// TakeItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TakeItem") == 0) {
+	case kScNameTakeItem: {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// DropItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DropItem") == 0) {
+	case kScNameDropItem: {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetItem") == 0) {
+	case kScNameGetItem: {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// HasItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasItem") == 0) {
+	case kScNameHasItem: {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// IsItemTaken
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsItemTaken") == 0) {
+	case kScNameIsItemTaken: {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -738,7 +745,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetInventoryWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInventoryWindow") == 0) {
+	case kScNameGetInventoryWindow: {
 		stack->correctParams(0);
 		if (_inventoryBox && _inventoryBox->_window) {
 			stack->pushNative(_inventoryBox->_window, true);
@@ -752,7 +759,8 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetResponsesWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetResponsesWindow") == 0 || strcmp(name, "GetResponseWindow") == 0) {
+	case kScNameGetResponsesWindow:
+	case kScNameGetResponseWindow: {
 		stack->correctParams(0);
 		if (_responseBox && _responseBox->getResponseWindow()) {
 			stack->pushNative(_responseBox->getResponseWindow(), true);
@@ -766,7 +774,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadResponseBox
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadResponseBox") == 0) {
+	case kScNameLoadResponseBox: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -786,7 +794,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadInventoryBox
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadInventoryBox") == 0) {
+	case kScNameLoadInventoryBox: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -806,7 +814,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadItems") == 0) {
+	case kScNameLoadItems: {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool merge = stack->pop()->getBool(false);
@@ -820,7 +828,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddSpeechDir
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSpeechDir") == 0) {
+	case kScNameAddSpeechDir: {
 		stack->correctParams(1);
 		const char *dir = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(addSpeechDir(dir)));
@@ -831,7 +839,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveSpeechDir
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveSpeechDir") == 0) {
+	case kScNameRemoveSpeechDir: {
 		stack->correctParams(1);
 		const char *dir = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(removeSpeechDir(dir)));
@@ -842,7 +850,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetSceneViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSceneViewport") == 0) {
+	case kScNameSetSceneViewport: {
 		stack->correctParams(4);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -868,8 +876,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		return STATUS_OK;
 	}
 
-
-	else {
+	default:
 		return BaseGame::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -879,17 +886,18 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdGame::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("game");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Scene
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scene") {
+	case kScNameScene: {
 		if (_scene) {
 			_scValue->setNative(_scene, true);
 		} else {
@@ -901,7 +909,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelectedItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SelectedItem") {
+	case kScNameSelectedItem: {
 		//if (_selectedItem) _scValue->setString(_selectedItem->_name);
 		if (_selectedItem) {
 			_scValue->setNative(_selectedItem, true);
@@ -914,14 +922,14 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumItems") {
+	case kScNameNumItems: {
 		return _invObject->scGetProperty(name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// SmartItemCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SmartItemCursor") {
+	case kScNameSmartItemCursor: {
 		_scValue->setBool(_smartItemCursor);
 		return _scValue;
 	}
@@ -929,7 +937,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryVisible
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InventoryVisible") {
+	case kScNameInventoryVisible: {
 		_scValue->setBool(_inventoryBox && _inventoryBox->_visible);
 		return _scValue;
 	}
@@ -937,7 +945,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryScrollOffset
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InventoryScrollOffset") {
+	case kScNameInventoryScrollOffset: {
 		if (_inventoryBox) {
 			_scValue->setInt(_inventoryBox->_scrollOffset);
 		} else {
@@ -950,7 +958,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ResponsesVisible (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ResponsesVisible") {
+	case kScNameResponsesVisible: {
 		_scValue->setBool(_stateEx == GAME_WAITING_RESPONSE);
 		return _scValue;
 	}
@@ -958,7 +966,8 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PrevScene / PreviousScene (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PrevScene" || name == "PreviousScene") {
+	case kScNamePrevScene:
+	case kScNamePreviousScene: {
 		if (!_prevSceneName) {
 			_scValue->setString("");
 		} else {
@@ -970,7 +979,8 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PrevSceneFilename / PreviousSceneFilename (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PrevSceneFilename" || name == "PreviousSceneFilename") {
+	case kScNamePrevSceneFilename:
+	case kScNamePreviousSceneFilename: {
 		if (!_prevSceneFilename) {
 			_scValue->setString("");
 		} else {
@@ -982,7 +992,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// LastResponse (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LastResponse") {
+	case kScNameLastResponse: {
 		if (!_responseBox || !_responseBox->getLastResponseText()) {
 			_scValue->setString("");
 		} else {
@@ -994,7 +1004,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// LastResponseOrig (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LastResponseOrig") {
+	case kScNameLastResponseOrig: {
 		if (!_responseBox || !_responseBox->getLastResponseTextOrig()) {
 			_scValue->setString("");
 		} else {
@@ -1006,7 +1016,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InventoryObject") {
+	case kScNameInventoryObject: {
 		if (_inventoryOwner == _invObject) {
 			_scValue->setNative(this, true);
 		} else {
@@ -1019,7 +1029,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TotalNumItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TotalNumItems") {
+	case kScNameTotalNumItems: {
 		_scValue->setInt(_items.size());
 		return _scValue;
 	}
@@ -1027,7 +1037,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkSkipButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TalkSkipButton") {
+	case kScNameTalkSkipButton: {
 		_scValue->setInt(_talkSkipButton);
 		return _scValue;
 	}
@@ -1035,7 +1045,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ChangingScene
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ChangingScene") {
+	case kScNameChangingScene: {
 		_scValue->setBool(_scheduledScene != NULL);
 		return _scValue;
 	}
@@ -1043,7 +1053,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// StartupScene
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "StartupScene") {
+	case kScNameStartupScene: {
 		if (!_startupScene) {
 			_scValue->setNULL();
 		} else {
@@ -1052,7 +1062,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 		return _scValue;
 	}
 
-	else {
+	default:
 		return BaseGame::scGetProperty(name);
 	}
 }
@@ -1061,10 +1071,11 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelectedItem
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SelectedItem") == 0) {
+	case kScNameSelectedItem: {
 		if (value->isNULL()) {
 			_selectedItem = NULL;
 		} else {
@@ -1088,7 +1099,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SmartItemCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SmartItemCursor") == 0) {
+	case kScNameSmartItemCursor: {
 		_smartItemCursor = value->getBool();
 		return STATUS_OK;
 	}
@@ -1096,7 +1107,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryVisible
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InventoryVisible") == 0) {
+	case kScNameInventoryVisible: {
 		if (_inventoryBox) {
 			_inventoryBox->_visible = value->getBool();
 		}
@@ -1106,7 +1117,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InventoryObject") == 0) {
+	case kScNameInventoryObject: {
 		if (_inventoryOwner && _inventoryBox) {
 			_inventoryOwner->getInventory()->_scrollOffset = _inventoryBox->_scrollOffset;
 		}
@@ -1132,7 +1143,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryScrollOffset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InventoryScrollOffset") == 0) {
+	case kScNameInventoryScrollOffset: {
 		if (_inventoryBox) {
 			_inventoryBox->_scrollOffset = value->getInt();
 		}
@@ -1142,7 +1153,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkSkipButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TalkSkipButton") == 0) {
+	case kScNameTalkSkipButton: {
 		int val = value->getInt();
 		if (val < 0) {
 			val = 0;
@@ -1157,7 +1168,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// StartupScene
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StartupScene") == 0) {
+	case kScNameStartupScene: {
 		if (value == NULL) {
 			delete[] _startupScene;
 			_startupScene = NULL;
@@ -1168,7 +1179,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 		return STATUS_OK;
 	}
 
-	else {
+	default:
 		return BaseGame::scSetProperty(name, value);
 	}
 }
@@ -39,6 +39,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
@@ -455,10 +456,11 @@ bool AdItem::display(int x, int y) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverSprite
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetHoverSprite") == 0) {
+	case kScNameSetHoverSprite: {
 		stack->correctParams(1);
 
 		bool setCurrent = false;
@@ -487,7 +489,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverSprite") == 0) {
+	case kScNameGetHoverSprite: {
 		stack->correctParams(0);
 
 		if (!_spriteHover || !_spriteHover->getFilename()) {
@@ -501,7 +503,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverSpriteObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverSpriteObject") == 0) {
+	case kScNameGetHoverSpriteObject: {
 		stack->correctParams(0);
 		if (!_spriteHover) {
 			stack->pushNULL();
@@ -514,7 +516,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetNormalCursor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetNormalCursor") == 0) {
+	case kScNameSetNormalCursor: {
 		stack->correctParams(1);
 
 		const char *filename = stack->pop()->getString();
@@ -535,7 +537,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNormalCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNormalCursor") == 0) {
+	case kScNameGetNormalCursor: {
 		stack->correctParams(0);
 
 		if (!_cursorNormal || !_cursorNormal->getFilename()) {
@@ -549,7 +551,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNormalCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNormalCursorObject") == 0) {
+	case kScNameGetNormalCursorObject: {
 		stack->correctParams(0);
 
 		if (!_cursorNormal) {
@@ -563,7 +565,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverCursor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetHoverCursor") == 0) {
+	case kScNameSetHoverCursor: {
 		stack->correctParams(1);
 
 		const char *filename = stack->pop()->getString();
@@ -584,7 +586,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverCursor") == 0) {
+	case kScNameGetHoverCursor: {
 		stack->correctParams(0);
 
 		if (!_cursorHover || !_cursorHover->getFilename()) {
@@ -598,7 +600,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverCursorObject") == 0) {
+	case kScNameGetHoverCursorObject: {
 		stack->correctParams(0);
 
 		if (!_cursorHover) {
@@ -607,7 +609,9 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 			stack->pushNative(_cursorHover, true);
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -617,10 +621,11 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdItem::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("item");
 		return _scValue;
 	}
@@ -628,7 +633,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	case kScNameName: {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -636,7 +641,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DisplayAmount") {
+	case kScNameDisplayAmount: {
 		_scValue->setBool(_displayAmount);
 		return _scValue;
 	}
@@ -644,7 +649,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Amount
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Amount") {
+	case kScNameAmount: {
 		_scValue->setInt(_amount);
 		return _scValue;
 	}
@@ -652,7 +657,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountOffsetX") {
+	case kScNameAmountOffsetX: {
 		_scValue->setInt(_amountOffsetX);
 		return _scValue;
 	}
@@ -660,7 +665,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountOffsetY") {
+	case kScNameAmountOffsetY: {
 		_scValue->setInt(_amountOffsetY);
 		return _scValue;
 	}
@@ -668,7 +673,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountAlign") {
+	case kScNameAmountAlign: {
 		_scValue->setInt(_amountAlign);
 		return _scValue;
 	}
@@ -676,7 +681,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountString
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountString") {
+	case kScNameAmountString: {
 		if (!_amountString) {
 			_scValue->setNULL();
 		} else {
@@ -688,10 +693,12 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorCombined
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorCombined") {
+	case kScNameCursorCombined: {
 		_scValue->setBool(_cursorCombined);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scGetProperty(name);
 	}
 }
@@ -699,10 +706,11 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdItem::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -710,7 +718,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisplayAmount") == 0) {
+	case kScNameDisplayAmount: {
 		_displayAmount = value->getBool();
 		return STATUS_OK;
 	}
@@ -718,7 +726,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Amount
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Amount") == 0) {
+	case kScNameAmount: {
 		_amount = value->getInt();
 		return STATUS_OK;
 	}
@@ -726,7 +734,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountOffsetX") == 0) {
+	case kScNameAmountOffsetX: {
 		_amountOffsetX = value->getInt();
 		return STATUS_OK;
 	}
@@ -734,7 +742,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountOffsetY") == 0) {
+	case kScNameAmountOffsetY: {
 		_amountOffsetY = value->getInt();
 		return STATUS_OK;
 	}
@@ -742,7 +750,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountAlign") == 0) {
+	case kScNameAmountAlign: {
 		_amountAlign = (TTextAlign)value->getInt();
 		return STATUS_OK;
 	}
@@ -750,7 +758,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountString") == 0) {
+	case kScNameAmountString: {
 		if (value->isNULL()) {
 			delete[] _amountString;
 			_amountString = NULL;
@@ -763,10 +771,12 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorCombined
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorCombined") == 0) {
+	case kScNameCursorCombined: {
 		_cursorCombined = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdTalkHolder::scSetProperty(name, value);
 	}
 }
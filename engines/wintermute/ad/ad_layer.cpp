@@ -35,6 +35,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
 
@@ -232,10 +233,11 @@ bool AdLayer::loadBuffer(byte *buffer, bool complete) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetNode
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetNode") == 0) {
+	case kScNameGetNode: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		int node = -1;
@@ -272,7 +274,8 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddRegion / AddEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddRegion") == 0 || strcmp(name, "AddEntity") == 0) {
+	case kScNameAddRegion:
+	case kScNameAddEntity: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -299,7 +302,8 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// InsertRegion / InsertEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertRegion") == 0 || strcmp(name, "InsertEntity") == 0) {
+	case kScNameInsertRegion:
+	case kScNameInsertEntity: {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		ScValue *val = stack->pop();
@@ -335,7 +339,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteNode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteNode") == 0) {
+	case kScNameDeleteNode: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -369,7 +373,9 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		}
 		stack->pushBool(true);
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -379,10 +385,11 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("layer");
 		return _scValue;
 	}
@@ -390,7 +397,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumNodes (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumNodes") {
+	case kScNameNumNodes: {
 		_scValue->setInt(_nodes.size());
 		return _scValue;
 	}
@@ -398,7 +405,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	case kScNameWidth: {
 		_scValue->setInt(_width);
 		return _scValue;
 	}
@@ -406,7 +413,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	case kScNameHeight: {
 		_scValue->setInt(_height);
 		return _scValue;
 	}
@@ -414,7 +421,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Main (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Main") {
+	case kScNameMain: {
 		_scValue->setBool(_main);
 		return _scValue;
 	}
@@ -422,7 +429,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CloseUp
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CloseUp") {
+	case kScNameCloseUp: {
 		_scValue->setBool(_closeUp);
 		return _scValue;
 	}
@@ -430,10 +437,12 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	case kScNameActive: {
 		_scValue->setBool(_active);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -441,10 +450,11 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdLayer::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -452,7 +462,7 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CloseUp
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CloseUp") == 0) {
+	case kScNameCloseUp: {
 		_closeUp = value->getBool();
 		return STATUS_OK;
 	}
@@ -460,7 +470,7 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Width") == 0) {
+	case kScNameWidth: {
 		_width = value->getInt();
 		if (_width < 0) {
 			_width = 0;
@@ -471,7 +481,7 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Height") == 0) {
+	case kScNameHeight: {
 		_height = value->getInt();
 		if (_height < 0) {
 			_height = 0;
@@ -482,7 +492,7 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Active") == 0) {
+	case kScNameActive: {
 		bool b = value->getBool();
 		if (b == false && _main) {
 			_gameRef->LOG(0, "Warning: cannot deactivate scene's main layer");
@@ -490,7 +500,9 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 			_active = b;
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -49,6 +49,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "common/str.h"
 #include "common/util.h"
@@ -195,10 +196,12 @@ bool AdObject::update() {
 //////////////////////////////////////////////////////////////////////////
 bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayAnim / PlayAnimAsync
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "PlayAnim") == 0 || strcmp(name, "PlayAnimAsync") == 0) {
+	case kScNamePlayAnim:
+	case kScNamePlayAnimAsync: {
 		stack->correctParams(1);
 		if (DID_FAIL(playAnim(stack->pop()->getString()))) {
 			stack->pushBool(false);
@@ -214,7 +217,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	case kScNameReset: {
 		stack->correctParams(0);
 		reset();
 		stack->pushNULL();
@@ -224,7 +227,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsTalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsTalking") == 0) {
+	case kScNameIsTalking: {
 		stack->correctParams(0);
 		stack->pushBool(_state == STATE_TALKING);
 		return STATUS_OK;
@@ -233,7 +236,8 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StopTalk / StopTalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopTalk") == 0 || strcmp(name, "StopTalking") == 0) {
+	case kScNameStopTalk:
+	case kScNameStopTalking: {
 		stack->correctParams(0);
 		if (_sentence) {
 			_sentence->finish();
@@ -251,7 +255,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ForceTalkAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ForceTalkAnim") == 0) {
+	case kScNameForceTalkAnim: {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 		delete[] _forcedTalkAnimName;
@@ -266,7 +270,8 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Talk / TalkAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Talk") == 0 || strcmp(name, "TalkAsync") == 0) {
+	case kScNameTalk:
+	case kScNameTalkAsync: {
 		stack->correctParams(5);
 
 		const char *text    = stack->pop()->getString();
@@ -300,7 +305,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StickToRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StickToRegion") == 0) {
+	case kScNameStickToRegion: {
 		stack->correctParams(1);
 
 		AdLayer *main = ((AdGame *)_gameRef)->_scene->_mainLayer;
@@ -343,7 +348,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFont") == 0) {
+	case kScNameSetFont: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -360,7 +365,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFont") == 0) {
+	case kScNameGetFont: {
 		stack->correctParams(0);
 		if (_font && _font->getFilename()) {
 			stack->pushString(_font->getFilename());
@@ -373,7 +378,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// TakeItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TakeItem") == 0) {
+	case kScNameTakeItem: {
 		stack->correctParams(2);
 
 		if (!_inventory) {
@@ -404,7 +409,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DropItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DropItem") == 0) {
+	case kScNameDropItem: {
 		stack->correctParams(1);
 
 		if (!_inventory) {
@@ -431,7 +436,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetItem") == 0) {
+	case kScNameGetItem: {
 		stack->correctParams(1);
 
 		if (!_inventory) {
@@ -459,7 +464,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HasItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasItem") == 0) {
+	case kScNameHasItem: {
 		stack->correctParams(1);
 
 		if (!_inventory) {
@@ -489,7 +494,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateParticleEmitter
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateParticleEmitter") == 0) {
+	case kScNameCreateParticleEmitter: {
 		stack->correctParams(3);
 		bool followParent = stack->pop()->getBool();
 		int offsetX = stack->pop()->getInt();
@@ -508,7 +513,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteParticleEmitter
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteParticleEmitter") == 0) {
+	case kScNameDeleteParticleEmitter: {
 		stack->correctParams(0);
 		if (_partEmitter) {
 			_gameRef->unregisterObject(_partEmitter);
@@ -522,7 +527,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// AddAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddAttachment") == 0) {
+	case kScNameAddAttachment: {
 		stack->correctParams(4);
 		const char *filename = stack->pop()->getString();
 		bool preDisplay = stack->pop()->getBool(true);
@@ -558,7 +563,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveAttachment") == 0) {
+	case kScNameRemoveAttachment: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		bool found = false;
@@ -607,7 +612,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetAttachment") == 0) {
+	case kScNameGetAttachment: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -652,7 +657,9 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -662,10 +669,11 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *AdObject::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("object");
 		return _scValue;
 	}
@@ -673,7 +681,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	case kScNameActive: {
 		_scValue->setBool(_active);
 		return _scValue;
 	}
@@ -681,7 +689,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IgnoreItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IgnoreItems") {
+	case kScNameIgnoreItems: {
 		_scValue->setBool(_ignoreItems);
 		return _scValue;
 	}
@@ -689,7 +697,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SceneIndependent
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SceneIndependent") {
+	case kScNameSceneIndependent: {
 		_scValue->setBool(_sceneIndependent);
 		return _scValue;
 	}
@@ -697,7 +705,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesWidth") {
+	case kScNameSubtitlesWidth: {
 		_scValue->setInt(_subtitlesWidth);
 		return _scValue;
 	}
@@ -705,7 +713,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosRelative
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosRelative") {
+	case kScNameSubtitlesPosRelative: {
 		_scValue->setBool(_subtitlesModRelative);
 		return _scValue;
 	}
@@ -713,7 +721,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosX") {
+	case kScNameSubtitlesPosX: {
 		_scValue->setInt(_subtitlesModX);
 		return _scValue;
 	}
@@ -721,7 +729,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosY") {
+	case kScNameSubtitlesPosY: {
 		_scValue->setInt(_subtitlesModY);
 		return _scValue;
 	}
@@ -729,7 +737,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosXCenter
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosXCenter") {
+	case kScNameSubtitlesPosXCenter: {
 		_scValue->setBool(_subtitlesModXCenter);
 		return _scValue;
 	}
@@ -737,7 +745,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumItems (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumItems") {
+	case kScNameNumItems: {
 		_scValue->setInt(getInventory()->_takenItems.size());
 		return _scValue;
 	}
@@ -745,7 +753,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ParticleEmitter (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ParticleEmitter") {
+	case kScNameParticleEmitter: {
 		if (_partEmitter) {
 			_scValue->setNative(_partEmitter, true);
 		} else {
@@ -758,10 +766,12 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumAttachments (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumAttachments") {
+	case kScNameNumAttachments: {
 		_scValue->setInt(_attachmentsPre.size() + _attachmentsPost.size());
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -770,10 +780,11 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 //////////////////////////////////////////////////////////////////////////
 bool AdObject::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Active") == 0) {
+	case kScNameActive: {
 		_active = value->getBool();
 		return STATUS_OK;
 	}
@@ -781,7 +792,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// IgnoreItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IgnoreItems") == 0) {
+	case kScNameIgnoreItems: {
 		_ignoreItems = value->getBool();
 		return STATUS_OK;
 	}
@@ -789,7 +800,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SceneIndependent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SceneIndependent") == 0) {
+	case kScNameSceneIndependent: {
 		_sceneIndependent = value->getBool();
 		return STATUS_OK;
 	}
@@ -797,7 +808,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesWidth") == 0) {
+	case kScNameSubtitlesWidth: {
 		_subtitlesWidth = value->getInt();
 		return STATUS_OK;
 	}
@@ -805,7 +816,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosRelative
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosRelative") == 0) {
+	case kScNameSubtitlesPosRelative: {
 		_subtitlesModRelative = value->getBool();
 		return STATUS_OK;
 	}
@@ -813,7 +824,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosX") == 0) {
+	case kScNameSubtitlesPosX: {
 		_subtitlesModX = value->getInt();
 		return STATUS_OK;
 	}
@@ -821,7 +832,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosY") == 0) {
+	case kScNameSubtitlesPosY: {
 		_subtitlesModY = value->getInt();
 		return STATUS_OK;
 	}
@@ -829,10 +840,12 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosXCenter
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosXCenter") == 0) {
+	case kScNameSubtitlesPosXCenter: {
 		_subtitlesModXCenter = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/base_parser.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -260,10 +261,11 @@ bool AdRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("ad region");
 		return _scValue;
 	}
@@ -271,7 +273,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	case kScNameName: {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -279,7 +281,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Blocked
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Blocked") {
+	case kScNameBlocked: {
 		_scValue->setBool(_blocked);
 		return _scValue;
 	}
@@ -287,7 +289,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Decoration") {
+	case kScNameDecoration: {
 		_scValue->setBool(_decoration);
 		return _scValue;
 	}
@@ -295,7 +297,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale") {
+	case kScNameScale: {
 		_scValue->setFloat(_zoom);
 		return _scValue;
 	}
@@ -303,10 +305,12 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaColor") {
+	case kScNameAlphaColor: {
 		_scValue->setInt((int)_alpha);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseRegion::scGetProperty(name);
 	}
 }
@@ -314,10 +318,11 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdRegion::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -325,7 +330,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Blocked
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Blocked") == 0) {
+	case kScNameBlocked: {
 		_blocked = value->getBool();
 		return STATUS_OK;
 	}
@@ -333,7 +338,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Decoration") == 0) {
+	case kScNameDecoration: {
 		_decoration = value->getBool();
 		return STATUS_OK;
 	}
@@ -341,7 +346,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale") == 0) {
+	case kScNameScale: {
 		_zoom = value->getFloat();
 		return STATUS_OK;
 	}
@@ -349,10 +354,12 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AlphaColor") == 0) {
+	case kScNameAlphaColor: {
 		_alpha = (uint32)value->getInt();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseRegion::scSetProperty(name, value);
 	}
 }
@@ -51,11 +51,13 @@
 #include "engines/wintermute/base/base_region.h"
 #include "engines/wintermute/base/base_scriptable.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 #include "engines/wintermute/base/base_viewport.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/ui/ui_window.h"
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/wintermute.h"
@@ -90,6 +92,11 @@ void AdScene::setDefaults() {
 	_mainLayer = NULL;
 
 	_pfPointsNum = 0;
+	_pfOpen.clear();
+	_pfOpenValid = true;
+	_pfSteps = _pfSegments = 0;
+	_walkMap.clear();
+	_walkMapValid = false;
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -203,6 +210,9 @@ bool AdScene::getPath(BasePoint source, BasePoint target, AdPath *path, BaseObje
 
 		// prepare working path
 		pfPointsStart();
+		_pfOpen.clear();
+		_pfOpenValid = true;
+		_pfSteps = _pfSegments = 0;
 
 		// first point
 		//_pfPath.add(new AdPathPoint(source.x, source.y, 0));
@@ -229,6 +239,7 @@ bool AdScene::getPath(BasePoint source, BasePoint target, AdPath *path, BaseObje
 		}
 
 		pfPointsAdd(startX, startY, 0);
+		pfOpenPush(_pfPath[_pfPointsNum - 1]);
 
 		//CorrectTargetPoint(&target.x, &target.y);
 
@@ -419,6 +430,140 @@ bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requ
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+uint32 AdScene::getWalkMapSignature() {
+	// Covers everything isBlockedAt() looks at in the regions of the main layer
+	uint32 signature = 0;
+	if (_mainLayer) {
+		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+			AdSceneNode *node = _mainLayer->_nodes[i];
+			if (node->_type != OBJECT_REGION) {
+				continue;
+			}
+			AdRegion *region = node->_region;
+			signature = signature * 31 + (uint32)(size_t)region;
+			signature = signature * 31 + (region->_active ? 1 : 0) + (region->isBlocked() ? 2 : 0) + (region->hasDecoration() ? 4 : 0);
+			signature = signature * 31 + region->_points.size();
+			for (uint32 j = 0; j < region->_points.size(); j++) {
+				signature = signature * 31 + region->_points[j]->x;
+				signature = signature * 31 + region->_points[j]->y;
+			}
+		}
+	}
+	return signature;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::updateWalkMap() {
+	uint32 signature = getWalkMapSignature();
+	if (_walkMapValid && signature == _walkMapSignature) {
+		return;
+	}
+	_walkMapSignature = signature;
+	_walkMapValid = true;
+	_walkMap.clear();
+	_walkMapRect.setEmpty();
+
+	if (!_mainLayer) {
+		return;
+	}
+
+	// Only walkable regions make points walkable, so the map covers them
+	Common::Array<AdRegion *> walkable, blocked;
+	for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+		AdSceneNode *node = _mainLayer->_nodes[i];
+		if (node->_type != OBJECT_REGION || !node->_region->_active || node->_region->hasDecoration() || node->_region->_points.size() < 3) {
+			continue;
+		}
+		if (node->_region->isBlocked()) {
+			blocked.push_back(node->_region);
+		} else {
+			const Rect32 &rect = node->_region->_rect;
+			if (walkable.empty()) {
+				_walkMapRect = rect;
+			} else {
+				_walkMapRect.left = MIN(_walkMapRect.left, rect.left);
+				_walkMapRect.top = MIN(_walkMapRect.top, rect.top);
+				_walkMapRect.right = MAX(_walkMapRect.right, rect.right);
+				_walkMapRect.bottom = MAX(_walkMapRect.bottom, rect.bottom);
+			}
+			walkable.push_back(node->_region);
+		}
+	}
+	if (walkable.empty() || _walkMapRect.width() <= 0 || _walkMapRect.height() <= 0) {
+		_walkMapRect.setEmpty();
+		return;
+	}
+
+	_walkMapPitch = (_walkMapRect.width() + 31) / 32;
+	_walkMap.resize(_walkMapPitch * _walkMapRect.height());
+	for (uint32 i = 0; i < _walkMap.size(); i++) {
+		_walkMap[i] = 0;
+	}
+
+	// Walkable is what's in a walkable region, but not in a blocked one.
+	// pointInRegion() never looks outside of the bounding rect of a region.
+	for (int pass = 0; pass < 2; pass++) {
+		Common::Array<AdRegion *> &regions = pass == 0 ? walkable : blocked;
+		for (uint32 i = 0; i < regions.size(); i++) {
+			Rect32 rect = regions[i]->_rect;
+			rect.left = MAX(rect.left, _walkMapRect.left);
+			rect.top = MAX(rect.top, _walkMapRect.top);
+			rect.right = MIN(rect.right, _walkMapRect.right);
+			rect.bottom = MIN(rect.bottom, _walkMapRect.bottom);
+
+			for (int y = rect.top; y < rect.bottom; y++) {
+				uint32 *row = &_walkMap[(y - _walkMapRect.top) * _walkMapPitch];
+				for (int x = rect.left; x < rect.right; x++) {
+					if (!regions[i]->ptInPolygon(x, y)) {
+						continue;
+					}
+					uint32 bit = x - _walkMapRect.left;
+					if (pass == 0) {
+						row[bit / 32] |= (uint32)1 << (bit % 32);
+					} else {
+						row[bit / 32] &= ~((uint32)1 << (bit % 32));
+					}
+				}
+			}
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isWalkableOnMap(int x, int y) const {
+	if (x < _walkMapRect.left || x >= _walkMapRect.right || y < _walkMapRect.top || y >= _walkMapRect.bottom) {
+		return false;
+	}
+	uint32 bit = x - _walkMapRect.left;
+	return (_walkMap[(y - _walkMapRect.top) * _walkMapPitch + bit / 32] >> (bit % 32)) & 1;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::getBlockingRegions(BaseObject *requester, const Rect32 &area, Common::Array<BaseRegion *> &regions) {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			const Rect32 &rect = _objects[i]->_currentBlockRegion->_rect;
+			if (rect.left < area.right && area.left < rect.right && rect.top < area.bottom && area.top < rect.bottom) {
+				regions.push_back(_objects[i]->_currentBlockRegion);
+			}
+		}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			const Rect32 &rect = adGame->_objects[i]->_currentBlockRegion->_rect;
+			if (rect.left < area.right && area.left < rect.right && rect.top < area.bottom && area.top < rect.bottom) {
+				regions.push_back(adGame->_objects[i]->_currentBlockRegion);
+			}
+		}
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 	double xStep, yStep, x, y;
@@ -433,6 +578,15 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 	xLength = abs(x2 - x1);
 	yLength = abs(y2 - y1);
 
+	// Same as checking isBlockedAt() with free objects for every point of
+	// the line, but the regions of the main layer come from the walk map and
+	// only free objects near the line are looked at
+	updateWalkMap();
+	_pfSegments++;
+
+	Common::Array<BaseRegion *> blockers;
+	getBlockingRegions(requester, Rect32(MIN(x1, x2) - 1, MIN(y1, y2) - 1, MAX(x1, x2) + 2, MAX(y1, y2) + 2), blockers);
+
 	if (xLength > yLength) {
 		if (x1 > x2) {
 			BaseUtils::swap(&x1, &x2);
@@ -443,9 +597,14 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
+			if (!isWalkableOnMap(xCount, (int)y)) {
 				return -1;
 			}
+			for (uint32 i = 0; i < blockers.size(); i++) {
+				if (blockers[i]->pointInRegion(xCount, (int)y)) {
+					return -1;
+				}
+			}
 			y += yStep;
 		}
 	} else {
@@ -458,9 +617,14 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
+			if (!isWalkableOnMap((int)x, yCount)) {
 				return -1;
 			}
+			for (uint32 i = 0; i < blockers.size(); i++) {
+				if (blockers[i]->pointInRegion((int)x, yCount)) {
+					return -1;
+				}
+			}
 			x += xStep;
 		}
 	}
@@ -468,20 +632,86 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+int AdScene::pfEstimate(AdPathPoint *point) const {
+	// Path lengths are measured like getPointsDist() does, so this never
+	// overestimates the rest of the way
+	return point->_distance + MAX(abs(point->x - _pfTarget->x), abs(point->y - _pfTarget->y));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenPush(AdPathPoint *point) {
+	PathFinderNode node;
+	node.estimate = pfEstimate(point);
+	node.point = point;
+
+	uint32 i = _pfOpen.size();
+	_pfOpen.push_back(node);
+	while (i > 0 && _pfOpen[(i - 1) / 2].estimate > node.estimate) {
+		_pfOpen[i] = _pfOpen[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	_pfOpen[i] = node;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+AdPathPoint *AdScene::pfOpenPop() {
+	while (!_pfOpen.empty()) {
+		PathFinderNode top = _pfOpen[0];
+
+		PathFinderNode last = _pfOpen.back();
+		_pfOpen.pop_back();
+		if (!_pfOpen.empty()) {
+			uint32 i = 0;
+			for (;;) {
+				uint32 child = 2 * i + 1;
+				if (child >= _pfOpen.size()) {
+					break;
+				}
+				if (child + 1 < _pfOpen.size() && _pfOpen[child + 1].estimate < _pfOpen[child].estimate) {
+					child++;
+				}
+				if (_pfOpen[child].estimate >= last.estimate) {
+					break;
+				}
+				_pfOpen[i] = _pfOpen[child];
+				i = child;
+			}
+			_pfOpen[i] = last;
+		}
+
+		// Points are pushed again when a shorter way to them is found,
+		// instead of updating their entry
+		if (!top.point->_marked && top.estimate == pfEstimate(top.point)) {
+			return top.point;
+		}
+	}
+	return NULL;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
 	int i;
-	// get lowest unmarked
-	int lowestDist = INT_MAX;
-	AdPathPoint *lowestPt = NULL;
 
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
+	if (!_pfOpenValid) {
+		_pfOpen.clear();
+		for (i = 0; i < _pfPointsNum; i++) {
+			if (!_pfPath[i]->_marked && _pfPath[i]->_distance != INT_MAX) {
+				pfOpenPush(_pfPath[i]);
+			}
 		}
+		_pfOpenValid = true;
+	}
+
+	// get the open point with the lowest estimate
+	AdPathPoint *lowestPt = pfOpenPop();
+	_pfSteps++;
 
 	if (lowestPt == NULL) { // no path -> terminate PathFinder
+		debugC(kWintermuteDebugGeneral, "PathFinder: no path, %d points, %d steps, %d segments tested", _pfPointsNum, _pfSteps, _pfSegments);
 		_pfReady = true;
 		_pfTargetPath->setReady(true);
 		return;
@@ -491,6 +721,7 @@ void AdScene::pathFinderStep() {
 
 	// target point marked, generate path and terminate
 	if (lowestPt->x == _pfTarget->x && lowestPt->y == _pfTarget->y) {
+		debugC(kWintermuteDebugGeneral, "PathFinder: path found, %d points, %d steps, %d segments tested", _pfPointsNum, _pfSteps, _pfSegments);
 		while (lowestPt != NULL) {
 			_pfTargetPath->_points.insert_at(0, new BasePoint(lowestPt->x, lowestPt->y));
 			lowestPt = lowestPt->_origin;
@@ -508,6 +739,7 @@ void AdScene::pathFinderStep() {
 			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
 				_pfPath[i]->_distance = lowestPt->_distance + j;
 				_pfPath[i]->_origin = lowestPt;
+				pfOpenPush(_pfPath[i]);
 			}
 		}
 }
@@ -550,6 +782,8 @@ bool AdScene::loadFile(const char *filename) {
 
 	if (DID_FAIL(ret = loadBuffer(buffer, true))) {
 		_gameRef->LOG(0, "Error parsing SCENE file '%s'", filename);
+	} else {
+		preloadSurfaces();
 	}
 
 	setFilename(filename);
@@ -560,6 +794,24 @@ bool AdScene::loadFile(const char *filename) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void AdScene::preloadSurfaces() {
+	// What's shown when entering the scene comes first
+	for (uint32 i = 0; i < _layers.size(); i++) {
+		AdLayer *layer = _layers[i];
+		for (uint32 j = 0; j < layer->_nodes.size(); j++) {
+			AdEntity *entity = layer->_nodes[j]->_entity;
+			if (layer->_nodes[j]->_type != OBJECT_ENTITY || !entity) {
+				continue;
+			}
+
+			TSurfacePriority priority = layer->_active && entity->_active ? SURFACE_PRIORITY_VISIBLE : SURFACE_PRIORITY_LOW;
+			_gameRef->_surfaceStorage->preloadSprite(entity->_sprite, priority);
+		}
+	}
+}
+
+
 TOKEN_DEF_START
 TOKEN_DEF(SCENE)
 TOKEN_DEF(TEMPLATE)
@@ -1325,10 +1577,11 @@ void AdScene::skipTo(int offsetX, int offsetY) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LoadActor") == 0) {
+	case kScNameLoadActor: {
 		stack->correctParams(1);
 		AdActor *act = new AdActor(_gameRef);
 		if (act && DID_SUCCEED(act->loadFile(stack->pop()->getString()))) {
@@ -1345,7 +1598,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadEntity") == 0) {
+	case kScNameLoadEntity: {
 		stack->correctParams(1);
 		AdEntity *ent = new AdEntity(_gameRef);
 		if (ent && DID_SUCCEED(ent->loadFile(stack->pop()->getString()))) {
@@ -1362,7 +1615,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEntity") == 0) {
+	case kScNameCreateEntity: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1378,7 +1631,11 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject / UnloadActor / UnloadEntity / UnloadActor3D / DeleteEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0 || strcmp(name, "UnloadActor") == 0 || strcmp(name, "UnloadEntity") == 0 || strcmp(name, "UnloadActor3D") == 0 || strcmp(name, "DeleteEntity") == 0) {
+	case kScNameUnloadObject:
+	case kScNameUnloadActor:
+	case kScNameUnloadEntity:
+	case kScNameUnloadActor3D:
+	case kScNameDeleteEntity: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		AdObject *obj = (AdObject *)val->getNative();
@@ -1394,7 +1651,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SkipTo") == 0) {
+	case kScNameSkipTo: {
 		stack->correctParams(2);
 		ScValue *val1 = stack->pop();
 		ScValue *val2 = stack->pop();
@@ -1410,7 +1667,8 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollTo / ScrollToAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollTo") == 0 || strcmp(name, "ScrollToAsync") == 0) {
+	case kScNameScrollTo:
+	case kScNameScrollToAsync: {
 		stack->correctParams(2);
 		ScValue *val1 = stack->pop();
 		ScValue *val2 = stack->pop();
@@ -1429,7 +1687,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLayer") == 0) {
+	case kScNameGetLayer: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->isInt()) {
@@ -1459,7 +1717,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaypointGroup
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaypointGroup") == 0) {
+	case kScNameGetWaypointGroup: {
 		stack->correctParams(1);
 		int group = stack->pop()->getInt();
 		if (group < 0 || group >= (int32)_waypointGroups.size()) {
@@ -1473,7 +1731,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNode") == 0) {
+	case kScNameGetNode: {
 		stack->correctParams(1);
 		const char *nodeName = stack->pop()->getString();
 
@@ -1490,7 +1748,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetFreeNode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFreeNode") == 0) {
+	case kScNameGetFreeNode: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1521,7 +1779,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetRegionAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetRegionAt") == 0) {
+	case kScNameGetRegionAt: {
 		stack->correctParams(3);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1552,7 +1810,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsBlockedAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsBlockedAt") == 0) {
+	case kScNameIsBlockedAt: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1564,7 +1822,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsWalkableAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsWalkableAt") == 0) {
+	case kScNameIsWalkableAt: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1576,7 +1834,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetScaleAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetScaleAt") == 0) {
+	case kScNameGetScaleAt: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1588,7 +1846,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetRotationAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetRotationAt") == 0) {
+	case kScNameGetRotationAt: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1600,7 +1858,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsScrolling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsScrolling") == 0) {
+	case kScNameIsScrolling: {
 		stack->correctParams(0);
 		bool ret = false;
 		if (_autoScroll) {
@@ -1616,7 +1874,8 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOut / FadeOutAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOut") == 0 || strcmp(name, "FadeOutAsync") == 0) {
+	case kScNameFadeOut:
+	case kScNameFadeOutAsync: {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1636,7 +1895,8 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// FadeIn / FadeInAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeIn") == 0 || strcmp(name, "FadeInAsync") == 0) {
+	case kScNameFadeIn:
+	case kScNameFadeInAsync: {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1656,7 +1916,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetFadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFadeColor") == 0) {
+	case kScNameGetFadeColor: {
 		stack->correctParams(0);
 		stack->pushInt(_fader->getCurrentColor());
 		return STATUS_OK;
@@ -1665,7 +1925,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsPointInViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsPointInViewport") == 0) {
+	case kScNameIsPointInViewport: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1676,7 +1936,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetViewport") == 0) {
+	case kScNameSetViewport: {
 		stack->correctParams(4);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1705,7 +1965,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddLayer") == 0) {
+	case kScNameAddLayer: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1727,7 +1987,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// InsertLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertLayer") == 0) {
+	case kScNameInsertLayer: {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		ScValue *val = stack->pop();
@@ -1758,7 +2018,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteLayer") == 0) {
+	case kScNameDeleteLayer: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1797,7 +2057,9 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		}
 		stack->pushBool(true);
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -1807,10 +2069,11 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdScene::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("scene");
 		return _scValue;
 	}
@@ -1818,7 +2081,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumLayers (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumLayers") {
+	case kScNameNumLayers: {
 		_scValue->setInt(_layers.size());
 		return _scValue;
 	}
@@ -1826,7 +2089,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumWaypointGroups (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumWaypointGroups") {
+	case kScNameNumWaypointGroups: {
 		_scValue->setInt(_waypointGroups.size());
 		return _scValue;
 	}
@@ -1834,7 +2097,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MainLayer (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MainLayer") {
+	case kScNameMainLayer: {
 		if (_mainLayer) {
 			_scValue->setNative(_mainLayer, true);
 		} else {
@@ -1847,7 +2110,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumFreeNodes (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumFreeNodes") {
+	case kScNameNumFreeNodes: {
 		_scValue->setInt(_objects.size());
 		return _scValue;
 	}
@@ -1855,7 +2118,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseX (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseX") {
+	case kScNameMouseX: {
 		int viewportX;
 		getViewportOffset(&viewportX);
 
@@ -1866,7 +2129,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseY (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseY") {
+	case kScNameMouseY: {
 		int viewportY;
 		getViewportOffset(NULL, &viewportY);
 
@@ -1877,7 +2140,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoScroll
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutoScroll") {
+	case kScNameAutoScroll: {
 		_scValue->setBool(_autoScroll);
 		return _scValue;
 	}
@@ -1885,7 +2148,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentState
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PersistentState") {
+	case kScNamePersistentState: {
 		_scValue->setBool(_persistentState);
 		return _scValue;
 	}
@@ -1893,7 +2156,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentStateSprites
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PersistentStateSprites") {
+	case kScNamePersistentStateSprites: {
 		_scValue->setBool(_persistentStateSprites);
 		return _scValue;
 	}
@@ -1901,7 +2164,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollPixelsX") {
+	case kScNameScrollPixelsX: {
 		_scValue->setInt(_scrollPixelsH);
 		return _scValue;
 	}
@@ -1909,7 +2172,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollPixelsY") {
+	case kScNameScrollPixelsY: {
 		_scValue->setInt(_scrollPixelsV);
 		return _scValue;
 	}
@@ -1918,7 +2181,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollSpeedX") {
+	case kScNameScrollSpeedX: {
 		_scValue->setInt(_scrollTimeH);
 		return _scValue;
 	}
@@ -1926,7 +2189,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollSpeedY") {
+	case kScNameScrollSpeedY: {
 		_scValue->setInt(_scrollTimeV);
 		return _scValue;
 	}
@@ -1934,7 +2197,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "OffsetX") {
+	case kScNameOffsetX: {
 		_scValue->setInt(_offsetLeft);
 		return _scValue;
 	}
@@ -1942,7 +2205,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "OffsetY") {
+	case kScNameOffsetY: {
 		_scValue->setInt(_offsetTop);
 		return _scValue;
 	}
@@ -1950,7 +2213,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	case kScNameWidth: {
 		if (_mainLayer) {
 			_scValue->setInt(_mainLayer->_width);
 		} else {
@@ -1962,14 +2225,16 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	case kScNameHeight: {
 		if (_mainLayer) {
 			_scValue->setInt(_mainLayer->_height);
 		} else {
 			_scValue->setInt(0);
 		}
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -1977,10 +2242,11 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -1988,7 +2254,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoScroll
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutoScroll") == 0) {
+	case kScNameAutoScroll: {
 		_autoScroll = value->getBool();
 		return STATUS_OK;
 	}
@@ -1996,7 +2262,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentState
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PersistentState") == 0) {
+	case kScNamePersistentState: {
 		_persistentState = value->getBool();
 		return STATUS_OK;
 	}
@@ -2004,7 +2270,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentStateSprites
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PersistentStateSprites") == 0) {
+	case kScNamePersistentStateSprites: {
 		_persistentStateSprites = value->getBool();
 		return STATUS_OK;
 	}
@@ -2012,7 +2278,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollPixelsX") == 0) {
+	case kScNameScrollPixelsX: {
 		_scrollPixelsH = value->getInt();
 		return STATUS_OK;
 	}
@@ -2020,7 +2286,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollPixelsY") == 0) {
+	case kScNameScrollPixelsY: {
 		_scrollPixelsV = value->getInt();
 		return STATUS_OK;
 	}
@@ -2028,7 +2294,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollSpeedX") == 0) {
+	case kScNameScrollSpeedX: {
 		_scrollTimeH = value->getInt();
 		return STATUS_OK;
 	}
@@ -2036,7 +2302,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollSpeedY") == 0) {
+	case kScNameScrollSpeedY: {
 		_scrollTimeV = value->getInt();
 		return STATUS_OK;
 	}
@@ -2044,7 +2310,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OffsetX") == 0) {
+	case kScNameOffsetX: {
 		_offsetLeft = value->getInt();
 
 		int viewportWidth, viewportHeight;
@@ -2060,7 +2326,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OffsetY") == 0) {
+	case kScNameOffsetY: {
 		_offsetTop = value->getInt();
 
 		int viewportWidth, viewportHeight;
@@ -2071,7 +2337,9 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 		_targetOffsetTop = _offsetTop;
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -2329,6 +2597,9 @@ bool AdScene::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transfer(TMEMBER(_pfRequester));
 	persistMgr->transfer(TMEMBER(_pfTarget));
 	persistMgr->transfer(TMEMBER(_pfTargetPath));
+	if (!persistMgr->getIsSaving()) {
+		_pfOpenValid = false;
+	}
 	_rotLevels.persist(persistMgr);
 	_scaleLevels.persist(persistMgr);
 	persistMgr->transfer(TMEMBER(_scrollPixelsH));
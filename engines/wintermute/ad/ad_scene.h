@@ -30,6 +30,8 @@
 #define WINTERMUTE_ADSCENE_H
 
 #include "engines/wintermute/base/base_fader.h"
+#include "engines/wintermute/math/rect32.h"
+#include "common/array.h"
 
 namespace Wintermute {
 
@@ -44,6 +46,7 @@ class AdPath;
 class AdScaleLevel;
 class AdRotLevel;
 class AdPathPoint;
+class BaseRegion;
 class AdScene : public BaseObject {
 public:
 
@@ -125,6 +128,7 @@ public:
 	BaseArray<AdWaypointGroup *> _waypointGroups;
 	bool loadFile(const char *filename);
 	bool loadBuffer(byte *buffer, bool complete = true);
+	void preloadSurfaces();
 	int _width;
 	int _height;
 	bool addObject(AdObject *Object);
@@ -171,6 +175,33 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	// The path finder is an A* search over _pfPath. The open points are kept
+	// in a binary heap by the estimated length of a path through them.
+	struct PathFinderNode {
+		int estimate;
+		AdPathPoint *point;
+	};
+	Common::Array<PathFinderNode> _pfOpen;
+	bool _pfOpenValid; // not saved, rebuilt from _pfPath after loading
+	int pfEstimate(AdPathPoint *point) const;
+	void pfOpenPush(AdPathPoint *point);
+	AdPathPoint *pfOpenPop();
+	uint32 _pfSteps;
+	uint32 _pfSegments;
+
+	// Whether points are walkable as far as the regions of the main layer are
+	// concerned, one bit per pixel of _walkMapRect. It's rebuilt when the
+	// regions change, which is detected by comparing their signature.
+	Common::Array<uint32> _walkMap;
+	Rect32 _walkMapRect;
+	uint32 _walkMapPitch;
+	uint32 _walkMapSignature;
+	bool _walkMapValid;
+	uint32 getWalkMapSignature();
+	void updateWalkMap();
+	bool isWalkableOnMap(int x, int y) const;
+	void getBlockingRegions(BaseObject *requester, const Rect32 &area, Common::Array<BaseRegion *> &regions);
+
 	int _offsetTop;
 	int _offsetLeft;
 
@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_parser.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 
 namespace Wintermute {
 
@@ -240,6 +241,11 @@ bool AdSpriteSet::loadBuffer(byte *buffer, bool complete, int lifeTime, TSpriteC
 		return STATUS_FAILED;
 	}
 
+	// Any direction may be needed once the owner moves
+	for (int i = 0; i < NUM_DIRECTIONS; i++) {
+		_gameRef->_surfaceStorage->preloadSprite(_sprites[i], SURFACE_PRIORITY_NORMAL);
+	}
+
 	return STATUS_OK;
 }
 
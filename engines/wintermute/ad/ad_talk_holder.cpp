@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
 
@@ -124,10 +125,11 @@ BaseSprite *AdTalkHolder::getTalkStance(const char *stance) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetSprite
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetSprite") == 0) {
+	case kScNameSetSprite: {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -166,7 +168,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// GetSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSprite") == 0) {
+	case kScNameGetSprite: {
 		stack->correctParams(0);
 
 		if (!_sprite || !_sprite->getFilename()) {
@@ -180,7 +182,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// GetSpriteObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSpriteObject") == 0) {
+	case kScNameGetSpriteObject: {
 		stack->correctParams(0);
 
 		if (!_sprite) {
@@ -194,7 +196,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// AddTalkSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddTalkSprite") == 0) {
+	case kScNameAddTalkSprite: {
 		stack->correctParams(2);
 
 		const char *filename = stack->pop()->getString();
@@ -218,7 +220,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveTalkSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveTalkSprite") == 0) {
+	case kScNameRemoveTalkSprite: {
 		stack->correctParams(2);
 
 		const char *filename = stack->pop()->getString();
@@ -272,7 +274,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// SetTalkSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetTalkSprite") == 0) {
+	case kScNameSetTalkSprite: {
 		stack->correctParams(2);
 
 		const char *filename = stack->pop()->getString();
@@ -327,7 +329,9 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 			}
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return AdObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -337,13 +341,16 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 ScValue *AdTalkHolder::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("talk-holder");
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return AdObject::scGetProperty(name);
 	}
 }
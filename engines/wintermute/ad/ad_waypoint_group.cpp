@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/base_parser.h"
 #include "engines/wintermute/base/base_region.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include <limits.h>
 
 namespace Wintermute {
@@ -209,10 +210,11 @@ bool AdWaypointGroup::persist(BasePersistenceManager *persistMgr) {
 ScValue *AdWaypointGroup::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("waypoint-group");
 		return _scValue;
 	}
@@ -220,10 +222,12 @@ ScValue *AdWaypointGroup::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	case kScNameActive: {
 		_scValue->setBool(_active);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -231,15 +235,16 @@ ScValue *AdWaypointGroup::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdWaypointGroup::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Active") == 0) {
+	case kScNameActive: {
 		_active = value->getBool();
 		return STATUS_OK;
 	}
 
-	else {
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -37,6 +37,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "common/str.h"
 
 namespace Wintermute {
@@ -431,10 +432,11 @@ bool BaseFrame::persist(BasePersistenceManager *persistMgr) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetSound
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetSound") == 0) {
+	case kScNameGetSound: {
 		stack->correctParams(0);
 
 		if (_sound && _sound->getFilename()) {
@@ -448,7 +450,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// SetSound
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetSound") == 0) {
+	case kScNameSetSound: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		delete _sound;
@@ -472,7 +474,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// GetSubframe
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetSubframe") == 0) {
+	case kScNameGetSubframe: {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt(-1);
 		if (index < 0 || index >= (int32)_subframes.size()) {
@@ -488,7 +490,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteSubframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteSubframe") == 0) {
+	case kScNameDeleteSubframe: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->isInt()) {
@@ -513,7 +515,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// AddSubframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSubframe") == 0) {
+	case kScNameAddSubframe: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		const char *filename = NULL;
@@ -535,7 +537,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// InsertSubframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertSubframe") == 0) {
+	case kScNameInsertSubframe: {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		if (index < 0) {
@@ -566,7 +568,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// GetEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSubframe") == 0) {
+	case kScNameGetEvent: {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt(-1);
 		if (index < 0 || index >= (int32)_applyEvent.size()) {
@@ -581,7 +583,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// AddEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddEvent") == 0) {
+	case kScNameAddEvent: {
 		stack->correctParams(1);
 		const char *event = stack->pop()->getString();
 		for (uint32 i = 0; i < _applyEvent.size(); i++) {
@@ -598,7 +600,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteEvent") == 0) {
+	case kScNameDeleteEvent: {
 		stack->correctParams(1);
 		const char *event = stack->pop()->getString();
 		for (uint32 i = 0; i < _applyEvent.size(); i++) {
@@ -612,8 +614,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 		return STATUS_OK;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
 		if (_subframes.size() == 1) {
 			return _subframes[0]->scCallMethod(script, stack, thisStack, name);
 		} else {
@@ -630,10 +631,11 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	}
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("frame");
 		return _scValue;
 	}
@@ -641,7 +643,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Delay
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Delay") {
+	case kScNameDelay: {
 		_scValue->setInt(_delay);
 		return _scValue;
 	}
@@ -649,7 +651,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Keyframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Keyframe") {
+	case kScNameKeyframe: {
 		_scValue->setBool(_keyframe);
 		return _scValue;
 	}
@@ -657,7 +659,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// KillSounds
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "KillSounds") {
+	case kScNameKillSounds: {
 		_scValue->setBool(_killSound);
 		return _scValue;
 	}
@@ -665,7 +667,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MoveX") {
+	case kScNameMoveX: {
 		_scValue->setInt(_moveX);
 		return _scValue;
 	}
@@ -673,7 +675,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MoveY") {
+	case kScNameMoveY: {
 		_scValue->setInt(_moveY);
 		return _scValue;
 	}
@@ -681,7 +683,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumSubframes (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumSubframes") {
+	case kScNameNumSubframes: {
 		_scValue->setInt(_subframes.size());
 		return _scValue;
 	}
@@ -689,13 +691,12 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumEvents (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumEvents") {
+	case kScNameNumEvents: {
 		_scValue->setInt(_applyEvent.size());
 		return _scValue;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
 		if (_subframes.size() == 1) {
 			return _subframes[0]->scGetProperty(name);
 		} else {
@@ -707,10 +708,11 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Delay
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Delay") == 0) {
+	case kScNameDelay: {
 		_delay = MAX(0, value->getInt());
 		return STATUS_OK;
 	}
@@ -718,7 +720,7 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Keyframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Keyframe") == 0) {
+	case kScNameKeyframe: {
 		_keyframe = value->getBool();
 		return STATUS_OK;
 	}
@@ -726,7 +728,7 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// KillSounds
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "KillSounds") == 0) {
+	case kScNameKillSounds: {
 		_killSound = value->getBool();
 		return STATUS_OK;
 	}
@@ -734,7 +736,7 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveX") == 0) {
+	case kScNameMoveX: {
 		_moveX = value->getInt();
 		return STATUS_OK;
 	}
@@ -742,13 +744,12 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveY") == 0) {
+	case kScNameMoveY: {
 		_moveY = value->getInt();
 		return STATUS_OK;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
 		if (_subframes.size() == 1) {
 			return _subframes[0]->scSetProperty(name, value);
 		} else {
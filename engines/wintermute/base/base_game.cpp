@@ -53,6 +53,7 @@
 #include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/video/video_player.h"
 #include "engines/wintermute/video/video_theora_player.h"
@@ -934,10 +935,11 @@ bool BaseGame::loadBuffer(byte *buffer, bool complete) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// LOG
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LOG") == 0) {
+	case kScNameLOG: {
 		stack->correctParams(1);
 		LOG(0, stack->pop()->getString());
 		stack->pushNULL();
@@ -947,7 +949,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Caption") == 0) {
+	case kScNameCaption: {
 		bool res = BaseObject::scCallMethod(script, stack, thisStack, name);
 		setWindowTitle();
 		return res;
@@ -956,7 +958,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Msg
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Msg") == 0) {
+	case kScNameMsg: {
 		stack->correctParams(1);
 		quickMessage(stack->pop()->getString());
 		stack->pushNULL();
@@ -966,7 +968,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RunScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RunScript") == 0) {
+	case kScNameRunScript: {
 		_gameRef->LOG(0, "**Warning** The 'RunScript' method is now obsolete. Use 'AttachScript' instead (same syntax)");
 		stack->correctParams(1);
 		if (DID_FAIL(addScript(stack->pop()->getString()))) {
@@ -981,7 +983,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadStringTable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadStringTable") == 0) {
+	case kScNameLoadStringTable: {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		ScValue *val = stack->pop();
@@ -1005,7 +1007,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ValidObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ValidObject") == 0) {
+	case kScNameValidObject: {
 		stack->correctParams(1);
 		BaseScriptable *obj = stack->pop()->getNative();
 		if (validObject((BaseObject *) obj)) {
@@ -1020,7 +1022,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	case kScNameReset: {
 		stack->correctParams(0);
 		resetContent();
 		stack->pushNULL();
@@ -1032,7 +1034,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0) {
+	case kScNameUnloadObject: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		BaseObject *obj = (BaseObject *)val->getNative();
@@ -1048,7 +1050,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadWindow") == 0) {
+	case kScNameLoadWindow: {
 		stack->correctParams(1);
 		UIWindow *win = new UIWindow(_gameRef);
 		if (win && DID_SUCCEED(win->loadFile(stack->pop()->getString()))) {
@@ -1066,7 +1068,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ExpandString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ExpandString") == 0) {
+	case kScNameExpandString: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		char *str = new char[strlen(val->getString()) + 1];
@@ -1077,14 +1079,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		return STATUS_OK;
 	}
 
-	else if (_musicSystem->scCallMethod(script, stack, thisStack, name) == STATUS_OK) {
-		return STATUS_OK;
-	}
-
 	//////////////////////////////////////////////////////////////////////////
 	// SetMousePos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMousePos") == 0) {
+	case kScNameSetMousePos: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1105,7 +1103,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LockMouseRect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LockMouseRect") == 0) {
+	case kScNameLockMouseRect: {
 		stack->correctParams(4);
 		int left = stack->pop()->getInt();
 		int top = stack->pop()->getInt();
@@ -1128,7 +1126,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayVideo
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayVideo") == 0) {
+	case kScNamePlayVideo: {
 		_gameRef->LOG(0, "Warning: Game.PlayVideo() is now deprecated. Use Game.PlayTheora() instead.");
 
 		stack->correctParams(6);
@@ -1170,7 +1168,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayTheora") == 0) {
+	case kScNamePlayTheora: {
 		stack->correctParams(7);
 		const char *filename = stack->pop()->getString();
 		ScValue *valType = stack->pop();
@@ -1215,7 +1213,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// QuitGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "QuitGame") == 0) {
+	case kScNameQuitGame: {
 		stack->correctParams(0);
 		stack->pushNULL();
 		_quitting = true;
@@ -1225,7 +1223,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegWriteNumber
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegWriteNumber") == 0) {
+	case kScNameRegWriteNumber: {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		int val = stack->pop()->getInt();
@@ -1238,7 +1236,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegReadNumber
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegReadNumber") == 0) {
+	case kScNameRegReadNumber: {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		int initVal = stack->pop()->getInt();
@@ -1254,7 +1252,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegWriteString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegWriteString") == 0) {
+	case kScNameRegWriteString: {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		const char *val = stack->pop()->getString();
@@ -1268,7 +1266,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegReadString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegReadString") == 0) {
+	case kScNameRegReadString: {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		const char *initVal = stack->pop()->getString();
@@ -1284,7 +1282,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SaveGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SaveGame") == 0) {
+	case kScNameSaveGame: {
 		stack->correctParams(3);
 		int slot = stack->pop()->getInt();
 		const char *xdesc = stack->pop()->getString();
@@ -1304,7 +1302,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadGame") == 0) {
+	case kScNameLoadGame: {
 		stack->correctParams(1);
 		_scheduledLoadSlot = stack->pop()->getInt();
 		_loading = true;
@@ -1316,7 +1314,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsSaveSlotUsed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsSaveSlotUsed") == 0) {
+	case kScNameIsSaveSlotUsed: {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		stack->pushBool(SaveLoad::isSaveSlotUsed(slot));
@@ -1326,7 +1324,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetSaveSlotDescription
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSaveSlotDescription") == 0) {
+	case kScNameGetSaveSlotDescription: {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		char desc[512];
@@ -1339,7 +1337,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// EmptySaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EmptySaveSlot") == 0) {
+	case kScNameEmptySaveSlot: {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		SaveLoad::emptySaveSlot(slot);
@@ -1350,7 +1348,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalSFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalSFXVolume") == 0) {
+	case kScNameSetGlobalSFXVolume: {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSFXSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1360,7 +1358,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalSpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalSpeechVolume") == 0) {
+	case kScNameSetGlobalSpeechVolume: {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSpeechSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1370,7 +1368,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalMusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalMusicVolume") == 0) {
+	case kScNameSetGlobalMusicVolume: {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kMusicSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1380,7 +1378,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalMasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalMasterVolume") == 0) {
+	case kScNameSetGlobalMasterVolume: {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setMasterVolumePercent((byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1390,7 +1388,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalSFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalSFXVolume") == 0) {
+	case kScNameGetGlobalSFXVolume: {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kSFXSoundType));
 		return STATUS_OK;
@@ -1399,7 +1397,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalSpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalSpeechVolume") == 0) {
+	case kScNameGetGlobalSpeechVolume: {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kSpeechSoundType));
 		return STATUS_OK;
@@ -1408,7 +1406,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalMusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalMusicVolume") == 0) {
+	case kScNameGetGlobalMusicVolume: {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kMusicSoundType));
 		return STATUS_OK;
@@ -1417,7 +1415,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalMasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalMasterVolume") == 0) {
+	case kScNameGetGlobalMasterVolume: {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getMasterVolumePercent());
 		return STATUS_OK;
@@ -1426,7 +1424,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetActiveCursor") == 0) {
+	case kScNameSetActiveCursor: {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setActiveCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -1440,7 +1438,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetActiveCursor") == 0) {
+	case kScNameGetActiveCursor: {
 		stack->correctParams(0);
 		if (!_activeCursor || !_activeCursor->getFilename()) {
 			stack->pushNULL();
@@ -1454,7 +1452,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetActiveCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetActiveCursorObject") == 0) {
+	case kScNameGetActiveCursorObject: {
 		stack->correctParams(0);
 		if (!_activeCursor) {
 			stack->pushNULL();
@@ -1468,7 +1466,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveActiveCursor") == 0) {
+	case kScNameRemoveActiveCursor: {
 		stack->correctParams(0);
 		delete _activeCursor;
 		_activeCursor = NULL;
@@ -1480,7 +1478,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HasActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasActiveCursor") == 0) {
+	case kScNameHasActiveCursor: {
 		stack->correctParams(0);
 
 		if (_activeCursor) {
@@ -1495,7 +1493,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FileExists
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FileExists") == 0) {
+	case kScNameFileExists: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -1507,7 +1505,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOut / FadeOutAsync / SystemFadeOut / SystemFadeOutAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOut") == 0 || strcmp(name, "FadeOutAsync") == 0 || strcmp(name, "SystemFadeOut") == 0 || strcmp(name, "SystemFadeOutAsync") == 0) {
+	case kScNameFadeOut:
+	case kScNameFadeOutAsync:
+	case kScNameSystemFadeOut:
+	case kScNameSystemFadeOutAsync: {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1529,7 +1530,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FadeIn / FadeInAsync / SystemFadeIn / SystemFadeInAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeIn") == 0 || strcmp(name, "FadeInAsync") == 0 || strcmp(name, "SystemFadeIn") == 0 || strcmp(name, "SystemFadeInAsync") == 0) {
+	case kScNameFadeIn:
+	case kScNameFadeInAsync:
+	case kScNameSystemFadeIn:
+	case kScNameSystemFadeInAsync: {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1551,7 +1555,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFadeColor") == 0) {
+	case kScNameGetFadeColor: {
 		stack->correctParams(0);
 		stack->pushInt(_fader->getCurrentColor());
 		return STATUS_OK;
@@ -1560,7 +1564,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Screenshot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Screenshot") == 0) {
+	case kScNameScreenshot: {
 		stack->correctParams(1);
 		char filename[MAX_PATH_LENGTH];
 
@@ -1593,7 +1597,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenshotEx
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScreenshotEx") == 0) {
+	case kScNameScreenshotEx: {
 		stack->correctParams(3);
 		const char *filename = stack->pop()->getString();
 		int sizeX = stack->pop()->getInt(_renderer->_width);
@@ -1618,7 +1622,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateWindow") == 0) {
+	case kScNameCreateWindow: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1635,7 +1639,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteWindow") == 0) {
+	case kScNameDeleteWindow: {
 		stack->correctParams(1);
 		BaseObject *obj = (BaseObject *)stack->pop()->getNative();
 		for (uint32 i = 0; i < _windows.size(); i++) {
@@ -1652,7 +1656,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// OpenDocument
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OpenDocument") == 0) {
+	case kScNameOpenDocument: {
 		stack->correctParams(0);
 		stack->pushNULL();
 		return STATUS_OK;
@@ -1661,7 +1665,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DEBUG_DumpClassRegistry
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DEBUG_DumpClassRegistry") == 0) {
+	case kScNameDEBUG_DumpClassRegistry: {
 		stack->correctParams(0);
 		DEBUG_DumpClassRegistry();
 		stack->pushNULL();
@@ -1671,7 +1675,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetLoadingScreen
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetLoadingScreen") == 0) {
+	case kScNameSetLoadingScreen: {
 		stack->correctParams(3);
 		ScValue *val = stack->pop();
 		int loadImageX = stack->pop()->getInt();
@@ -1689,7 +1693,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetSavingScreen
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSavingScreen") == 0) {
+	case kScNameSetSavingScreen: {
 		stack->correctParams(3);
 		ScValue *val = stack->pop();
 		int saveImageX = stack->pop()->getInt();
@@ -1707,7 +1711,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetWaitCursor") == 0) {
+	case kScNameSetWaitCursor: {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setWaitCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -1721,7 +1725,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveWaitCursor") == 0) {
+	case kScNameRemoveWaitCursor: {
 		stack->correctParams(0);
 		delete _cursorNoninteractive;
 		_cursorNoninteractive = NULL;
@@ -1734,7 +1738,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaitCursor") == 0) {
+	case kScNameGetWaitCursor: {
 		stack->correctParams(0);
 		if (!_cursorNoninteractive || !_cursorNoninteractive->getFilename()) {
 			stack->pushNULL();
@@ -1748,7 +1752,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaitCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaitCursorObject") == 0) {
+	case kScNameGetWaitCursorObject: {
 		stack->correctParams(0);
 		if (!_cursorNoninteractive) {
 			stack->pushNULL();
@@ -1762,7 +1766,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ClearScriptCache
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearScriptCache") == 0) {
+	case kScNameClearScriptCache: {
 		stack->correctParams(0);
 		stack->pushBool(DID_SUCCEED(_scEngine->emptyScriptCache()));
 		return STATUS_OK;
@@ -1771,7 +1775,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayLoadingIcon
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisplayLoadingIcon") == 0) {
+	case kScNameDisplayLoadingIcon: {
 		stack->correctParams(4);
 
 		const char *filename = stack->pop()->getString();
@@ -1797,7 +1801,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HideLoadingIcon
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HideLoadingIcon") == 0) {
+	case kScNameHideLoadingIcon: {
 		stack->correctParams(0);
 		delete _loadingIcon;
 		_loadingIcon = NULL;
@@ -1808,7 +1812,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DumpTextureStats
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DumpTextureStats") == 0) {
+	case kScNameDumpTextureStats: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -1821,7 +1825,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// AccOutputText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AccOutputText") == 0) {
+	case kScNameAccOutputText: {
 		stack->correctParams(2);
 		/* const char *str = */	stack->pop()->getString();
 		/* int type = */ stack->pop()->getInt();
@@ -1834,7 +1838,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StoreSaveThumbnail
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StoreSaveThumbnail") == 0) {
+	case kScNameStoreSaveThumbnail: {
 		stack->correctParams(0);
 		delete _cachedThumbnail;
 		_cachedThumbnail = new BaseSaveThumbHelper(this);
@@ -1852,7 +1856,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteSaveThumbnail
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteSaveThumbnail") == 0) {
+	case kScNameDeleteSaveThumbnail: {
 		stack->correctParams(0);
 		delete _cachedThumbnail;
 		_cachedThumbnail = NULL;
@@ -1864,7 +1868,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFileChecksum
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFileChecksum") == 0) {
+	case kScNameGetFileChecksum: {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool asHex = stack->pop()->getBool(false);
@@ -1905,7 +1909,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// EnableScriptProfiling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableScriptProfiling") == 0) {
+	case kScNameEnableScriptProfiling: {
 		stack->correctParams(0);
 		_scEngine->enableProfiling();
 		stack->pushNULL();
@@ -1916,7 +1920,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DisableScriptProfiling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableScriptProfiling") == 0) {
+	case kScNameDisableScriptProfiling: {
 		stack->correctParams(0);
 		_scEngine->disableProfiling();
 		stack->pushNULL();
@@ -1927,7 +1931,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ShowStatusLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ShowStatusLine") == 0) {
+	case kScNameShowStatusLine: {
 		stack->correctParams(0);
 		// Block kept to show intention of opcode.
 		/*#ifdef __IPHONEOS__
@@ -1941,7 +1945,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HideStatusLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HideStatusLine") == 0) {
+	case kScNameHideStatusLine: {
 		stack->correctParams(0);
 		// Block kept to show intention of opcode.
 		/*#ifdef __IPHONEOS__
@@ -1950,7 +1954,13 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		stack->pushNULL();
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
+		// None of the names above is handled by the music system
+		if (_musicSystem->scCallMethod(script, stack, thisStack, name) == STATUS_OK) {
+			return STATUS_OK;
+		}
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -1960,24 +1970,25 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("game");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	case kScNameName: {
 		_scValue->setString(getName());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Hwnd (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Hwnd") {
+	case kScNameHwnd: {
 		_scValue->setInt((int)_renderer->_window);
 		return _scValue;
 	}
@@ -1985,7 +1996,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentTime (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CurrentTime") {
+	case kScNameCurrentTime: {
 		_scValue->setInt((int)_timer);
 		return _scValue;
 	}
@@ -1993,7 +2004,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WindowsTime (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WindowsTime") {
+	case kScNameWindowsTime: {
 		_scValue->setInt((int)g_system->getMillis());
 		return _scValue;
 	}
@@ -2001,7 +2012,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WindowedMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WindowedMode") {
+	case kScNameWindowedMode: {
 		_scValue->setBool(_renderer->_windowed);
 		return _scValue;
 	}
@@ -2009,7 +2020,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseX") {
+	case kScNameMouseX: {
 		_scValue->setInt(_mousePos.x);
 		return _scValue;
 	}
@@ -2017,7 +2028,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseY") {
+	case kScNameMouseY: {
 		_scValue->setInt(_mousePos.y);
 		return _scValue;
 	}
@@ -2025,7 +2036,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MainObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MainObject") {
+	case kScNameMainObject: {
 		_scValue->setNative(_mainObject, true);
 		return _scValue;
 	}
@@ -2033,7 +2044,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ActiveObject (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ActiveObject") {
+	case kScNameActiveObject: {
 		_scValue->setNative(_activeObject, true);
 		return _scValue;
 	}
@@ -2041,7 +2052,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenWidth (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScreenWidth") {
+	case kScNameScreenWidth: {
 		_scValue->setInt(_renderer->_width);
 		return _scValue;
 	}
@@ -2049,7 +2060,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenHeight (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScreenHeight") {
+	case kScNameScreenHeight: {
 		_scValue->setInt(_renderer->_height);
 		return _scValue;
 	}
@@ -2057,7 +2068,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Interactive") {
+	case kScNameInteractive: {
 		_scValue->setBool(_interactive);
 		return _scValue;
 	}
@@ -2065,7 +2076,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DebugMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DebugMode") {
+	case kScNameDebugMode: {
 		_scValue->setBool(_debugDebugMode);
 		return _scValue;
 	}
@@ -2073,7 +2084,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundAvailable (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SoundAvailable") {
+	case kScNameSoundAvailable: {
 		_scValue->setBool(_soundMgr->_soundAvailable);
 		return _scValue;
 	}
@@ -2081,7 +2092,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SFXVolume") {
+	case kScNameSFXVolume: {
 		_gameRef->LOG(0, "**Warning** The SFXVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getVolumePercent(Audio::Mixer::kSFXSoundType));
 		return _scValue;
@@ -2090,7 +2101,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SpeechVolume") {
+	case kScNameSpeechVolume: {
 		_gameRef->LOG(0, "**Warning** The SpeechVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getVolumePercent(Audio::Mixer::kSpeechSoundType));
 		return _scValue;
@@ -2099,7 +2110,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MusicVolume") {
+	case kScNameMusicVolume: {
 		_gameRef->LOG(0, "**Warning** The MusicVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getVolumePercent(Audio::Mixer::kMusicSoundType));
 		return _scValue;
@@ -2108,7 +2119,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MasterVolume") {
+	case kScNameMasterVolume: {
 		_gameRef->LOG(0, "**Warning** The MasterVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getMasterVolumePercent());
 		return _scValue;
@@ -2117,7 +2128,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Keyboard (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Keyboard") {
+	case kScNameKeyboard: {
 		if (_keyboardState) {
 			_scValue->setNative(_keyboardState, true);
 		} else {
@@ -2130,7 +2141,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Subtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Subtitles") {
+	case kScNameSubtitles: {
 		_scValue->setBool(_subtitles);
 		return _scValue;
 	}
@@ -2138,14 +2149,14 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesSpeed
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesSpeed") {
+	case kScNameSubtitlesSpeed: {
 		_scValue->setInt(_subtitlesSpeed);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// VideoSubtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VideoSubtitles") {
+	case kScNameVideoSubtitles: {
 		_scValue->setBool(_videoSubtitles);
 		return _scValue;
 	}
@@ -2153,7 +2164,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FPS (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FPS") {
+	case kScNameFPS: {
 		_scValue->setInt(_fps);
 		return _scValue;
 	}
@@ -2161,7 +2172,8 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AcceleratedMode / Accelerated (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AcceleratedMode" || name == "Accelerated") {
+	case kScNameAcceleratedMode:
+	case kScNameAccelerated: {
 		_scValue->setBool(_useD3D);
 		return _scValue;
 	}
@@ -2169,7 +2181,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextEncoding
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextEncoding") {
+	case kScNameTextEncoding: {
 		_scValue->setInt(_textEncoding);
 		return _scValue;
 	}
@@ -2177,7 +2189,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextRTL
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextRTL") {
+	case kScNameTextRTL: {
 		_scValue->setBool(_textRTL);
 		return _scValue;
 	}
@@ -2185,7 +2197,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundBufferSize
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SoundBufferSize") {
+	case kScNameSoundBufferSize: {
 		_scValue->setInt(_soundBufferSizeSec);
 		return _scValue;
 	}
@@ -2193,7 +2205,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuspendedRendering
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SuspendedRendering") {
+	case kScNameSuspendedRendering: {
 		_scValue->setBool(_suspendedRendering);
 		return _scValue;
 	}
@@ -2201,7 +2213,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuppressScriptErrors
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SuppressScriptErrors") {
+	case kScNameSuppressScriptErrors: {
 		_scValue->setBool(_suppressScriptErrors);
 		return _scValue;
 	}
@@ -2210,7 +2222,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Frozen
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Frozen") {
+	case kScNameFrozen: {
 		_scValue->setBool(_state == GAME_FROZEN);
 		return _scValue;
 	}
@@ -2218,7 +2230,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSEnabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSEnabled") {
+	case kScNameAccTTSEnabled: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2226,7 +2238,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSTalk
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSTalk") {
+	case kScNameAccTTSTalk: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2234,7 +2246,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSCaptions
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSCaptions") {
+	case kScNameAccTTSCaptions: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2242,7 +2254,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSKeypress
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSKeypress") {
+	case kScNameAccTTSKeypress: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2250,7 +2262,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccKeyboardEnabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccKeyboardEnabled") {
+	case kScNameAccKeyboardEnabled: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2258,7 +2270,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccKeyboardCursorSkip
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccKeyboardCursorSkip") {
+	case kScNameAccKeyboardCursorSkip: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2266,7 +2278,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccKeyboardPause
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccKeyboardPause") {
+	case kScNameAccKeyboardPause: {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2274,7 +2286,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutorunDisabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutorunDisabled") {
+	case kScNameAutorunDisabled: {
 		_scValue->setBool(_autorunDisabled);
 		return _scValue;
 	}
@@ -2282,7 +2294,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SaveDirectory (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SaveDirectory") {
+	case kScNameSaveDirectory: {
 		AnsiString dataDir = "saves/";	// TODO: This is just to avoid telling the engine actual paths.
 		_scValue->setString(dataDir.c_str());
 		return _scValue;
@@ -2291,7 +2303,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveOnExit
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutoSaveOnExit") {
+	case kScNameAutoSaveOnExit: {
 		_scValue->setBool(_autoSaveOnExit);
 		return _scValue;
 	}
@@ -2299,7 +2311,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutoSaveSlot") {
+	case kScNameAutoSaveSlot: {
 		_scValue->setInt(_autoSaveSlot);
 		return _scValue;
 	}
@@ -2307,7 +2319,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorHidden
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorHidden") {
+	case kScNameCursorHidden: {
 		_scValue->setBool(_cursorHidden);
 		return _scValue;
 	}
@@ -2315,7 +2327,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Platform (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Platform") {
+	case kScNamePlatform: {
 		_scValue->setString(BasePlatform::getPlatformName().c_str());
 		return _scValue;
 	}
@@ -2323,7 +2335,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DeviceType (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DeviceType") {
+	case kScNameDeviceType: {
 		_scValue->setString(getDeviceType().c_str());
 		return _scValue;
 	}
@@ -2331,7 +2343,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MostRecentSaveSlot (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MostRecentSaveSlot") {
+	case kScNameMostRecentSaveSlot: {
 		if (!ConfMan.hasKey("most_recent_saveslot")) {
 			_scValue->setInt(-1);
 		} else {
@@ -2343,12 +2355,14 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Store (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Store") {
+	case kScNameStore: {
 		_scValue->setNULL();
 		error("Request for a SXStore-object, which is not supported by ScummVM");
 
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -2356,10 +2370,11 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 
 		return STATUS_OK;
@@ -2368,7 +2383,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MouseX") == 0) {
+	case kScNameMouseX: {
 		_mousePos.x = value->getInt();
 		resetMousePos();
 		return STATUS_OK;
@@ -2377,7 +2392,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MouseY") == 0) {
+	case kScNameMouseY: {
 		_mousePos.y = value->getInt();
 		resetMousePos();
 		return STATUS_OK;
@@ -2386,7 +2401,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Name") == 0) {
+	case kScNameCaption: {
 		bool res = BaseObject::scSetProperty(name, value);
 		setWindowTitle();
 		return res;
@@ -2395,7 +2410,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MainObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MainObject") == 0) {
+	case kScNameMainObject: {
 		BaseScriptable *obj = value->getNative();
 		if (obj == NULL || validObject((BaseObject *)obj)) {
 			_mainObject = (BaseObject *)obj;
@@ -2406,7 +2421,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Interactive") == 0) {
+	case kScNameInteractive: {
 		setInteractive(value->getBool());
 		return STATUS_OK;
 	}
@@ -2414,7 +2429,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SFXVolume") == 0) {
+	case kScNameSFXVolume: {
 		_gameRef->LOG(0, "**Warning** The SFXVolume attribute is obsolete");
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSFXSoundType, (byte)value->getInt());
 		return STATUS_OK;
@@ -2423,7 +2438,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SpeechVolume") == 0) {
+	case kScNameSpeechVolume: {
 		_gameRef->LOG(0, "**Warning** The SpeechVolume attribute is obsolete");
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSpeechSoundType, (byte)value->getInt());
 		return STATUS_OK;
@@ -2432,7 +2447,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MusicVolume") == 0) {
+	case kScNameMusicVolume: {
 		_gameRef->LOG(0, "**Warning** The MusicVolume attribute is obsolete");
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kMusicSoundType, (byte)value->getInt());
 		return STATUS_OK;
@@ -2441,7 +2456,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MasterVolume") == 0) {
+	case kScNameMasterVolume: {
 		_gameRef->LOG(0, "**Warning** The MasterVolume attribute is obsolete");
 		_gameRef->_soundMgr->setMasterVolumePercent((byte)value->getInt());
 		return STATUS_OK;
@@ -2450,7 +2465,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Subtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Subtitles") == 0) {
+	case kScNameSubtitles: {
 		_subtitles = value->getBool();
 		return STATUS_OK;
 	}
@@ -2458,7 +2473,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesSpeed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesSpeed") == 0) {
+	case kScNameSubtitlesSpeed: {
 		_subtitlesSpeed = value->getInt();
 		return STATUS_OK;
 	}
@@ -2466,7 +2481,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// VideoSubtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "VideoSubtitles") == 0) {
+	case kScNameVideoSubtitles: {
 		_videoSubtitles = value->getBool();
 		return STATUS_OK;
 	}
@@ -2474,7 +2489,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextEncoding
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TextEncoding") == 0) {
+	case kScNameTextEncoding: {
 		int enc = value->getInt();
 		if (enc < 0) {
 			enc = 0;
@@ -2489,7 +2504,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextRTL
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TextRTL") == 0) {
+	case kScNameTextRTL: {
 		_textRTL = value->getBool();
 		return STATUS_OK;
 	}
@@ -2497,7 +2512,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundBufferSize
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundBufferSize") == 0) {
+	case kScNameSoundBufferSize: {
 		_soundBufferSizeSec = value->getInt();
 		_soundBufferSizeSec = MAX(3, _soundBufferSizeSec);
 		return STATUS_OK;
@@ -2506,7 +2521,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuspendedRendering
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SuspendedRendering") == 0) {
+	case kScNameSuspendedRendering: {
 		_suspendedRendering = value->getBool();
 		return STATUS_OK;
 	}
@@ -2514,7 +2529,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuppressScriptErrors
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SuppressScriptErrors") == 0) {
+	case kScNameSuppressScriptErrors: {
 		_suppressScriptErrors = value->getBool();
 		return STATUS_OK;
 	}
@@ -2522,7 +2537,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutorunDisabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutorunDisabled") == 0) {
+	case kScNameAutorunDisabled: {
 		_autorunDisabled = value->getBool();
 		return STATUS_OK;
 	}
@@ -2530,7 +2545,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveOnExit
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutoSaveOnExit") == 0) {
+	case kScNameAutoSaveOnExit: {
 		_autoSaveOnExit = value->getBool();
 		return STATUS_OK;
 	}
@@ -2538,7 +2553,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutoSaveSlot") == 0) {
+	case kScNameAutoSaveSlot: {
 		_autoSaveSlot = value->getInt();
 		return STATUS_OK;
 	}
@@ -2546,10 +2561,12 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorHidden
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorHidden") == 0) {
+	case kScNameCursorHidden: {
 		_cursorHidden = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -3882,6 +3899,7 @@ bool BaseGame::displayDebugInfo() {
 	if (_debugShowFPS) {
 		sprintf(str, "FPS: %d", _gameRef->_fps);
 		_systemFont->drawText((byte *)str, 0, 0, 100, TAL_LEFT);
+		_renderer->displayFrameStats();
 	}
 
 	if (_gameRef->_debugDebugMode) {
@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 
 namespace Wintermute {
@@ -231,10 +232,12 @@ bool BaseGameMusic::persistCrossfadeSettings(BasePersistenceManager *persistMgr)
 }
 
 bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayMusic / PlayMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "PlayMusic") == 0 || strcmp(name, "PlayMusicChannel") == 0) {
+	case kScNamePlayMusic:
+	case kScNamePlayMusicChannel: {
 		int channel = 0;
 		if (strcmp(name, "PlayMusic") == 0) {
 			stack->correctParams(3);
@@ -262,7 +265,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// StopMusic / StopMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopMusic") == 0 || strcmp(name, "StopMusicChannel") == 0) {
+	case kScNameStopMusic:
+	case kScNameStopMusicChannel: {
 		int channel = 0;
 		
 		if (strcmp(name, "StopMusic") == 0) {
@@ -283,7 +287,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// PauseMusic / PauseMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseMusic") == 0 || strcmp(name, "PauseMusicChannel") == 0) {
+	case kScNamePauseMusic:
+	case kScNamePauseMusicChannel: {
 		int channel = 0;
 		
 		if (strcmp(name, "PauseMusic") == 0) {
@@ -304,7 +309,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeMusic / ResumeMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeMusic") == 0 || strcmp(name, "ResumeMusicChannel") == 0) {
+	case kScNameResumeMusic:
+	case kScNameResumeMusicChannel: {
 		int channel = 0;
 		if (strcmp(name, "ResumeMusic") == 0) {
 			stack->correctParams(0);
@@ -324,7 +330,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetMusic / GetMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMusic") == 0 || strcmp(name, "GetMusicChannel") == 0) {
+	case kScNameGetMusic:
+	case kScNameGetMusicChannel: {
 		int channel = 0;
 		if (strcmp(name, "GetMusic") == 0) {
 			stack->correctParams(0);
@@ -347,7 +354,9 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// SetMusicPosition / SetMusicChannelPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMusicPosition") == 0 || strcmp(name, "SetMusicChannelPosition") == 0 || strcmp(name, "SetMusicPositionChannel") == 0) {
+	case kScNameSetMusicPosition:
+	case kScNameSetMusicChannelPosition:
+	case kScNameSetMusicPositionChannel: {
 		int channel = 0;
 		if (strcmp(name, "SetMusicPosition") == 0) {
 			stack->correctParams(1);
@@ -370,7 +379,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetMusicPosition / GetMusicChannelPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMusicPosition") == 0 || strcmp(name, "GetMusicChannelPosition") == 0) {
+	case kScNameGetMusicPosition:
+	case kScNameGetMusicChannelPosition: {
 		int channel = 0;
 		if (strcmp(name, "GetMusicPosition") == 0) {
 			stack->correctParams(0);
@@ -390,7 +400,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// IsMusicPlaying / IsMusicChannelPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsMusicPlaying") == 0 || strcmp(name, "IsMusicChannelPlaying") == 0) {
+	case kScNameIsMusicPlaying:
+	case kScNameIsMusicChannelPlaying: {
 		int channel = 0;
 		if (strcmp(name, "IsMusicPlaying") == 0) {
 			stack->correctParams(0);
@@ -410,7 +421,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// SetMusicVolume / SetMusicChannelVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMusicVolume") == 0 || strcmp(name, "SetMusicChannelVolume") == 0) {
+	case kScNameSetMusicVolume:
+	case kScNameSetMusicChannelVolume: {
 		int channel = 0;
 		if (strcmp(name, "SetMusicVolume") == 0) {
 			stack->correctParams(1);
@@ -435,7 +447,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetMusicVolume / GetMusicChannelVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMusicVolume") == 0 || strcmp(name, "GetMusicChannelVolume") == 0) {
+	case kScNameGetMusicVolume:
+	case kScNameGetMusicChannelVolume: {
 		int channel = 0;
 		if (strcmp(name, "GetMusicVolume") == 0) {
 			stack->correctParams(0);
@@ -456,7 +469,7 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// MusicCrossfade
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MusicCrossfade") == 0) {
+	case kScNameMusicCrossfade: {
 		stack->correctParams(4);
 		int channel1 = stack->pop()->getInt(0);
 		int channel2 = stack->pop()->getInt(0);
@@ -484,7 +497,7 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundLength
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundLength") == 0) {
+	case kScNameGetSoundLength: {
 		stack->correctParams(1);
 		
 		int length = 0;
@@ -498,7 +511,9 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 		}
 		stack->pushInt(length);
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
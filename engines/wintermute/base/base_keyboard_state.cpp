@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/base_keyboard_state.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "common/system.h"
 #include "common/keyboard.h"
 
@@ -73,10 +74,11 @@ void BaseKeyboardState::handleKeyRelease(Common::Event *event) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseKeyboardState::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsKeyDown
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "IsKeyDown") == 0) {
+	case kScNameIsKeyDown: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		int vKey;
@@ -96,7 +98,9 @@ bool BaseKeyboardState::scCallMethod(ScScript *script, ScStack *stack, ScStack *
 
 		stack->pushBool(isDown);
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -106,10 +110,11 @@ bool BaseKeyboardState::scCallMethod(ScScript *script, ScStack *stack, ScStack *
 ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("keyboard");
 		return _scValue;
 	}
@@ -117,7 +122,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Key
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Key") {
+	case kScNameKey: {
 		if (_currentPrintable) {
 			char key[2];
 			key[0] = (char)_currentCharCode;
@@ -133,7 +138,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Printable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Printable") {
+	case kScNamePrintable: {
 		_scValue->setBool(_currentPrintable);
 		return _scValue;
 	}
@@ -141,7 +146,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// KeyCode
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "KeyCode") {
+	case kScNameKeyCode: {
 		_scValue->setInt(_currentCharCode);
 		return _scValue;
 	}
@@ -149,7 +154,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsShift
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IsShift") {
+	case kScNameIsShift: {
 		_scValue->setBool(_currentShift);
 		return _scValue;
 	}
@@ -157,7 +162,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsAlt
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IsAlt") {
+	case kScNameIsAlt: {
 		_scValue->setBool(_currentAlt);
 		return _scValue;
 	}
@@ -165,10 +170,12 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsControl
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IsControl") {
+	case kScNameIsControl: {
 		_scValue->setBool(_currentControl);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scGetProperty(name);
 	}
 }
@@ -30,6 +30,7 @@
 #include "engines/wintermute/base/base_parser.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/base/sound/base_sound_manager.h"
 #include "engines/wintermute/base/base_game.h"
@@ -179,10 +180,11 @@ bool BaseObject::listen(BaseScriptHolder *param1, uint32 param2) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SkipTo") == 0) {
+	case kScNameSkipTo: {
 		stack->correctParams(2);
 		_posX = stack->pop()->getInt();
 		_posY = stack->pop()->getInt();
@@ -195,7 +197,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Caption") == 0) {
+	case kScNameCaption: {
 		stack->correctParams(1);
 		stack->pushString(getCaption(stack->pop()->getInt()));
 
@@ -205,7 +207,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCursor") == 0) {
+	case kScNameSetCursor: {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -219,7 +221,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveCursor") == 0) {
+	case kScNameRemoveCursor: {
 		stack->correctParams(0);
 		if (!_sharedCursors) {
 			delete _cursor;
@@ -236,7 +238,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCursor") == 0) {
+	case kScNameGetCursor: {
 		stack->correctParams(0);
 		if (!_cursor || !_cursor->getFilename()) {
 			stack->pushNULL();
@@ -250,7 +252,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCursorObject") == 0) {
+	case kScNameGetCursorObject: {
 		stack->correctParams(0);
 		if (!_cursor) {
 			stack->pushNULL();
@@ -264,7 +266,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// HasCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasCursor") == 0) {
+	case kScNameHasCursor: {
 		stack->correctParams(0);
 
 		if (_cursor) {
@@ -279,7 +281,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCaption") == 0) {
+	case kScNameSetCaption: {
 		stack->correctParams(2);
 		setCaption(stack->pop()->getString(), stack->pop()->getInt());
 		stack->pushNULL();
@@ -290,7 +292,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// LoadSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadSound") == 0) {
+	case kScNameLoadSound: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		if (DID_SUCCEED(playSFX(filename, false, false))) {
@@ -305,7 +307,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlaySound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlaySound") == 0) {
+	case kScNamePlaySound: {
 		stack->correctParams(3);
 
 		const char *filename;
@@ -341,7 +343,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlaySoundEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlaySoundEvent") == 0) {
+	case kScNamePlaySoundEvent: {
 		stack->correctParams(2);
 
 		const char *filename;
@@ -369,7 +371,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// StopSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopSound") == 0) {
+	case kScNameStopSound: {
 		stack->correctParams(0);
 
 		if (DID_FAIL(stopSFX())) {
@@ -383,7 +385,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PauseSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseSound") == 0) {
+	case kScNamePauseSound: {
 		stack->correctParams(0);
 
 		if (DID_FAIL(pauseSFX())) {
@@ -397,7 +399,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeSound") == 0) {
+	case kScNameResumeSound: {
 		stack->correctParams(0);
 
 		if (DID_FAIL(resumeSFX())) {
@@ -411,7 +413,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsSoundPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsSoundPlaying") == 0) {
+	case kScNameIsSoundPlaying: {
 		stack->correctParams(0);
 
 		if (_sFX && _sFX->isPlaying()) {
@@ -425,7 +427,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetSoundPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSoundPosition") == 0) {
+	case kScNameSetSoundPosition: {
 		stack->correctParams(1);
 
 		uint32 time = stack->pop()->getInt();
@@ -440,7 +442,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundPosition") == 0) {
+	case kScNameGetSoundPosition: {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -454,7 +456,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetSoundVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSoundVolume") == 0) {
+	case kScNameSetSoundVolume: {
 		stack->correctParams(1);
 
 		int volume = stack->pop()->getInt();
@@ -469,7 +471,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundVolume") == 0) {
+	case kScNameGetSoundVolume: {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -484,7 +486,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXNone
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXNone") == 0) {
+	case kScNameSoundFXNone: {
 		stack->correctParams(0);
 		_sFXType = SFX_NONE;
 		_sFXParam1 = 0;
@@ -499,7 +501,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXEcho
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXEcho") == 0) {
+	case kScNameSoundFXEcho: {
 		stack->correctParams(4);
 		_sFXType = SFX_ECHO;
 		_sFXParam1 = (float)stack->pop()->getFloat(0); // Wet/Dry Mix [%] (0-100)
@@ -514,7 +516,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXReverb
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXReverb") == 0) {
+	case kScNameSoundFXReverb: {
 		stack->correctParams(4);
 		_sFXType = SFX_REVERB;
 		_sFXParam1 = (float)stack->pop()->getFloat(0); // In Gain [dB] (-96 - 0)
@@ -524,7 +526,9 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		stack->pushNULL();
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptHolder::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -534,10 +538,11 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("object");
 		return _scValue;
 	}
@@ -545,7 +550,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Caption") {
+	case kScNameCaption: {
 		_scValue->setString(getCaption(1));
 		return _scValue;
 	}
@@ -553,7 +558,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "X") {
+	case kScNameX: {
 		_scValue->setInt(_posX);
 		return _scValue;
 	}
@@ -561,7 +566,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Y") {
+	case kScNameY: {
 		_scValue->setInt(_posY);
 		return _scValue;
 	}
@@ -569,7 +574,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	case kScNameHeight: {
 		_scValue->setInt(getHeight());
 		return _scValue;
 	}
@@ -577,7 +582,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Ready (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Ready") {
+	case kScNameReady: {
 		_scValue->setBool(_ready);
 		return _scValue;
 	}
@@ -585,7 +590,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Movable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Movable") {
+	case kScNameMovable: {
 		_scValue->setBool(_movable);
 		return _scValue;
 	}
@@ -593,7 +598,8 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Registrable/Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Registrable" || name == "Interactive") {
+	case kScNameRegistrable:
+	case kScNameInteractive: {
 		_scValue->setBool(_registrable);
 		return _scValue;
 	}
@@ -601,21 +607,22 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Zoomable/Scalable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Zoomable" || name == "Scalable") {
+	case kScNameZoomable:
+	case kScNameScalable: {
 		_scValue->setBool(_zoomable);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Rotatable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotatable") {
+	case kScNameRotatable: {
 		_scValue->setBool(_rotatable);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaColor") {
+	case kScNameAlphaColor: {
 		_scValue->setInt((int)_alphaColor);
 		return _scValue;
 	}
@@ -623,7 +630,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// BlendMode
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "BlendMode") {
+	case kScNameBlendMode: {
 		_scValue->setInt((int)_blendMode);
 		return _scValue;
 	}
@@ -631,7 +638,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale") {
+	case kScNameScale: {
 		if (_scale < 0) {
 			_scValue->setNULL();
 		} else {
@@ -643,7 +650,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScaleX") {
+	case kScNameScaleX: {
 		if (_scaleX < 0) {
 			_scValue->setNULL();
 		} else {
@@ -655,7 +662,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScaleY") {
+	case kScNameScaleY: {
 		if (_scaleY < 0) {
 			_scValue->setNULL();
 		} else {
@@ -667,7 +674,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeScale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "RelativeScale") {
+	case kScNameRelativeScale: {
 		_scValue->setFloat((double)_relativeScale);
 		return _scValue;
 	}
@@ -675,7 +682,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotate") {
+	case kScNameRotate: {
 		if (!_rotateValid) {
 			_scValue->setNULL();
 		} else {
@@ -687,7 +694,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeRotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "RelativeRotate") {
+	case kScNameRelativeRotate: {
 		_scValue->setFloat((double)_relativeRotate);
 		return _scValue;
 	}
@@ -695,14 +702,14 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Colorable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Colorable") {
+	case kScNameColorable: {
 		_scValue->setBool(_shadowable);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// SoundPanning
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SoundPanning") {
+	case kScNameSoundPanning: {
 		_scValue->setBool(_autoSoundPanning);
 		return _scValue;
 	}
@@ -710,7 +717,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SaveState
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SaveState") {
+	case kScNameSaveState: {
 		_scValue->setBool(_saveState);
 		return _scValue;
 	}
@@ -718,7 +725,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NonIntMouseEvents
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NonIntMouseEvents") {
+	case kScNameNonIntMouseEvents: {
 		_scValue->setBool(_nonIntMouseEvents);
 		return _scValue;
 	}
@@ -726,10 +733,12 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccCaption") {
+	case kScNameAccCaption: {
 		_scValue->setNULL();
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptHolder::scGetProperty(name);
 	}
 }
@@ -737,10 +746,11 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseObject::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Caption") == 0) {
+	case kScNameCaption: {
 		setCaption(value->getString());
 		return STATUS_OK;
 	}
@@ -748,7 +758,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "X") == 0) {
+	case kScNameX: {
 		_posX = value->getInt();
 		afterMove();
 		return STATUS_OK;
@@ -757,7 +767,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Y") == 0) {
+	case kScNameY: {
 		_posY = value->getInt();
 		afterMove();
 		return STATUS_OK;
@@ -766,7 +776,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Movable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Movable") == 0) {
+	case kScNameMovable: {
 		_movable = value->getBool();
 		return STATUS_OK;
 	}
@@ -774,7 +784,8 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Registrable/Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Registrable") == 0 || strcmp(name, "Interactive") == 0) {
+	case kScNameRegistrable:
+	case kScNameInteractive: {
 		_registrable = value->getBool();
 		return STATUS_OK;
 	}
@@ -782,7 +793,8 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Zoomable/Scalable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Zoomable") == 0 || strcmp(name, "Scalable") == 0) {
+	case kScNameZoomable:
+	case kScNameScalable: {
 		_zoomable = value->getBool();
 		return STATUS_OK;
 	}
@@ -790,7 +802,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotatable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotatable") == 0) {
+	case kScNameRotatable: {
 		_rotatable = value->getBool();
 		return STATUS_OK;
 	}
@@ -798,7 +810,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AlphaColor") == 0) {
+	case kScNameAlphaColor: {
 		_alphaColor = (uint32)value->getInt();
 		return STATUS_OK;
 	}
@@ -806,7 +818,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// BlendMode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "BlendMode") == 0) {
+	case kScNameBlendMode: {
 		int i = value->getInt();
 		if (i < BLEND_NORMAL || i >= NUM_BLEND_MODES) {
 			i = BLEND_NORMAL;
@@ -818,7 +830,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale") == 0) {
+	case kScNameScale: {
 		if (value->isNULL()) {
 			_scale = -1;
 		} else {
@@ -830,7 +842,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScaleX") == 0) {
+	case kScNameScaleX: {
 		if (value->isNULL()) {
 			_scaleX = -1;
 		} else {
@@ -842,7 +854,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScaleY") == 0) {
+	case kScNameScaleY: {
 		if (value->isNULL()) {
 			_scaleY = -1;
 		} else {
@@ -854,7 +866,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeScale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RelativeScale") == 0) {
+	case kScNameRelativeScale: {
 		_relativeScale = (float)value->getFloat();
 		return STATUS_OK;
 	}
@@ -862,7 +874,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotate") == 0) {
+	case kScNameRotate: {
 		if (value->isNULL()) {
 			_rotate = 0.0f;
 			_rotateValid = false;
@@ -876,7 +888,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeRotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RelativeRotate") == 0) {
+	case kScNameRelativeRotate: {
 		_relativeRotate = (float)value->getFloat();
 		return STATUS_OK;
 	}
@@ -884,7 +896,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Colorable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Colorable") == 0) {
+	case kScNameColorable: {
 		_shadowable = value->getBool();
 		return STATUS_OK;
 	}
@@ -892,7 +904,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundPanning
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundPanning") == 0) {
+	case kScNameSoundPanning: {
 		_autoSoundPanning = value->getBool();
 		if (!_autoSoundPanning) {
 			resetSoundPan();
@@ -903,7 +915,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SaveState
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SaveState") == 0) {
+	case kScNameSaveState: {
 		_saveState = value->getBool();
 		return STATUS_OK;
 	}
@@ -911,7 +923,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// NonIntMouseEvents
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "NonIntMouseEvents") == 0) {
+	case kScNameNonIntMouseEvents: {
 		_nonIntMouseEvents = value->getBool();
 		return STATUS_OK;
 	}
@@ -919,9 +931,11 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AccCaption") == 0) {
+	case kScNameAccCaption: {
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptHolder::scSetProperty(name, value);
 	}
 }
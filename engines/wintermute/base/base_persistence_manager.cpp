@@ -53,6 +53,31 @@ namespace Wintermute {
 #define SAVE_MAGIC      0x45564153
 #define SAVE_MAGIC_2    0x32564153
 
+/**
+ * Passes the savegame on to the save file as it is produced, counting its
+ * size for the save statistics.
+ */
+class SaveFileWriteStream : public Common::WriteStream {
+public:
+	SaveFileWriteStream(Common::OutSaveFile *file) : _file(file), _size(0) {}
+	~SaveFileWriteStream() { delete _file; }
+
+	uint32 write(const void *dataPtr, uint32 dataSize) {
+		uint32 written = _file->write(dataPtr, dataSize);
+		_size += written;
+		return written;
+	}
+	bool flush() { return _file->flush(); }
+	void finalize() { _file->finalize(); }
+	bool err() const { return _file->err(); }
+	void clearErr() { _file->clearErr(); }
+
+	uint32 size() const { return _size; }
+private:
+	Common::OutSaveFile *_file;
+	uint32 _size;
+};
+
 //////////////////////////////////////////////////////////////////////////
 BasePersistenceManager::BasePersistenceManager(const char *savePrefix, bool deleteSingleton) {
 	_saving = false;
@@ -78,6 +103,8 @@ BasePersistenceManager::BasePersistenceManager(const char *savePrefix, bool dele
 
 	_thumbnailDataSize = 0;
 	_thumbnailData = NULL;
+	_saveStartTime = 0;
+	_saveHeaderTime = 0;
 	if (savePrefix) {
 		_savePrefix = savePrefix;
 	} else if (_gameRef) {
@@ -124,9 +151,14 @@ void BasePersistenceManager::cleanup() {
 	}
 
 	delete _loadStream;
-	delete _saveStream;
 	_loadStream = NULL;
-	_saveStream = NULL;
+
+	// A save that wasn't finished, don't leave a truncated file behind
+	if (_saveStream) {
+		delete _saveStream;
+		_saveStream = NULL;
+		((WintermuteEngine *)g_engine)->getSaveFileMan()->removeSavefile(_saveFilename);
+	}
 }
 
 Common::String BasePersistenceManager::getFilenameForSlot(int slot) const {
@@ -192,15 +224,28 @@ bool BasePersistenceManager::getSaveExists(int slot) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-bool BasePersistenceManager::initSave(const char *desc) {
+bool BasePersistenceManager::initSave(const Common::String &filename, const char *desc) {
 	if (!desc) {
 		return STATUS_FAILED;
 	}
 
 	cleanup();
 	_saving = true;
+	_saveStartTime = g_system->getMillis();
 
-	_saveStream = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES);
+	// The save file compresses and writes the savegame while it's being
+	// serialized, it's never kept in memory as a whole. Backends only
+	// rename savefiles by copying them, which would decompress the whole
+	// savegame again, so it goes straight into the slot's file. That
+	// replaces the slot's previous savegame even if the save fails.
+	Common::SaveFileManager *saveMan = ((WintermuteEngine *)g_engine)->getSaveFileMan();
+	Common::OutSaveFile *file = saveMan->openForSaving(filename);
+	if (!file) {
+		debugC(kWintermuteDebugSaveGame, "ERROR: Can't open '%s' for saving", filename.c_str());
+		return STATUS_FAILED;
+	}
+	_saveStream = new SaveFileWriteStream(file);
+	_saveFilename = filename;
 
 	if (_saveStream) {
 		// get thumbnails
@@ -267,7 +312,9 @@ bool BasePersistenceManager::initSave(const char *desc) {
 		_savedPlayTime = g_system->getMillis();
 		_saveStream->writeUint32LE(_savedPlayTime);
 	}
-	return STATUS_OK;
+	_saveHeaderTime = g_system->getMillis() - _saveStartTime;
+
+	return _saveStream->err() ? STATUS_FAILED : STATUS_OK;
 }
 
 bool BasePersistenceManager::readHeader(const Common::String &filename) {
@@ -371,20 +418,28 @@ bool BasePersistenceManager::initLoad(const Common::String &filename) {
 
 
 //////////////////////////////////////////////////////////////////////////
-bool BasePersistenceManager::saveFile(const Common::String &filename) {
-	byte *prefixBuffer = _richBuffer;
-	uint32 prefixSize = _richBufferSize;
-	byte *buffer = ((Common::MemoryWriteStreamDynamic *)_saveStream)->getData();
-	uint32 bufferSize = ((Common::MemoryWriteStreamDynamic *)_saveStream)->size();
+bool BasePersistenceManager::finishSave() {
+	if (!_saveStream) {
+		return STATUS_FAILED;
+	}
 
-	Common::SaveFileManager *saveMan = ((WintermuteEngine *)g_engine)->getSaveFileMan();
-	Common::OutSaveFile *file = saveMan->openForSaving(filename);
-	file->write(prefixBuffer, prefixSize);
-	file->write(buffer, bufferSize);
-	bool retVal = !file->err();
-	file->finalize();
-	delete file;
-	return retVal;
+	_saveStream->finalize();
+	bool retVal = !_saveStream->err();
+	uint32 size = ((SaveFileWriteStream *)_saveStream)->size();
+	delete _saveStream;
+	_saveStream = NULL;
+
+	if (!retVal) {
+		debugC(kWintermuteDebugSaveGame, "ERROR: Writing '%s' failed", _saveFilename.c_str());
+		((WintermuteEngine *)g_engine)->getSaveFileMan()->removeSavefile(_saveFilename);
+		return STATUS_FAILED;
+	}
+
+	uint32 totalTime = g_system->getMillis() - _saveStartTime;
+	debugC(kWintermuteDebugSaveGame, "Saved '%s': %d bytes before compression, %d ms (header and thumbnail %d ms, game state %d ms)",
+	       _saveFilename.c_str(), size, totalTime, _saveHeaderTime, totalTime - _saveHeaderTime);
+
+	return STATUS_OK;
 }
 
 
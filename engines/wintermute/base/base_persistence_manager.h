@@ -47,7 +47,7 @@ public:
 	char *_savedDescription;
 	Common::String _savePrefix;
 	Common::String _savedName;
-	bool saveFile(const Common::String &filename);
+	bool finishSave();
 	uint32 getDWORD();
 	void putDWORD(uint32 val);
 	char *getString();
@@ -63,7 +63,7 @@ public:
 	uint32 getMaxUsedSlot();
 	bool getSaveExists(int slot);
 	bool initLoad(const Common::String &filename);
-	bool initSave(const char *desc);
+	bool initSave(const Common::String &filename, const char *desc);
 	bool getBytes(byte *buffer, uint32 size);
 	bool putBytes(byte *buffer, uint32 size);
 	uint32 _offset;
@@ -100,6 +100,9 @@ private:
 	TimeDate getTimeDate();
 	bool putTimeDate(const TimeDate &t);
 	Common::WriteStream *_saveStream;
+	Common::String _saveFilename;
+	uint32 _saveStartTime;
+	uint32 _saveHeaderTime;
 	Common::SeekableReadStream *_loadStream;
 	TimeDate _savedTimestamp;
 	uint32 _savedPlayTime;
@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
 #include <limits.h>
@@ -221,10 +222,11 @@ bool BaseRegion::loadBuffer(byte *buffer, bool complete) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// AddPoint
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "AddPoint") == 0) {
+	case kScNameAddPoint: {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -240,7 +242,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// InsertPoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertPoint") == 0) {
+	case kScNameInsertPoint: {
 		stack->correctParams(3);
 		int index = stack->pop()->getInt();
 		int x = stack->pop()->getInt();
@@ -261,7 +263,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetPoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPoint") == 0) {
+	case kScNameSetPoint: {
 		stack->correctParams(3);
 		int index = stack->pop()->getInt();
 		int x = stack->pop()->getInt();
@@ -283,7 +285,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemovePoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemovePoint") == 0) {
+	case kScNameRemovePoint: {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt();
 
@@ -305,7 +307,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetPoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPoint") == 0) {
+	case kScNameGetPoint: {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt();
 
@@ -320,7 +322,9 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -330,10 +334,11 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("region");
 		return _scValue;
 	}
@@ -341,7 +346,7 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	case kScNameName: {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -349,7 +354,7 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	case kScNameActive: {
 		_scValue->setBool(_active);
 		return _scValue;
 	}
@@ -357,10 +362,12 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumPoints
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumPoints") {
+	case kScNameNumPoints: {
 		_scValue->setInt(_points.size());
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -368,10 +375,11 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseRegion::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -379,10 +387,12 @@ bool BaseRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Active") == 0) {
+	case kScNameActive: {
 		_active = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
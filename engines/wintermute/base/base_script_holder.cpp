@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -116,10 +117,11 @@ bool BaseScriptHolder::listen(BaseScriptHolder *param1, uint32 param2) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// DEBUG_CrashMe
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "DEBUG_CrashMe") == 0) {
+	case kScNameDEBUG_CrashMe: {
 		stack->correctParams(0);
 		byte *p = 0;
 		*p = 10;
@@ -131,7 +133,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// ApplyEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ApplyEvent") == 0) {
+	case kScNameApplyEvent: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		bool ret;
@@ -149,7 +151,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// CanHandleEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CanHandleEvent") == 0) {
+	case kScNameCanHandleEvent: {
 		stack->correctParams(1);
 		stack->pushBool(canHandleEvent(stack->pop()->getString()));
 
@@ -159,7 +161,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// CanHandleMethod
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CanHandleMethod") == 0) {
+	case kScNameCanHandleMethod: {
 		stack->correctParams(1);
 		stack->pushBool(canHandleMethod(stack->pop()->getString()));
 
@@ -169,7 +171,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// AttachScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AttachScript") == 0) {
+	case kScNameAttachScript: {
 		stack->correctParams(1);
 		stack->pushBool(DID_SUCCEED(addScript(stack->pop()->getString())));
 
@@ -179,7 +181,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// DetachScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DetachScript") == 0) {
+	case kScNameDetachScript: {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool killThreads = stack->pop()->getBool(false);
@@ -199,7 +201,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// IsScriptRunning
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsScriptRunning") == 0) {
+	case kScNameIsScriptRunning: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		bool ret = false;
@@ -212,7 +214,9 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 		stack->pushBool(ret);
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -222,10 +226,11 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("script_holder");
 		return _scValue;
 	}
@@ -233,7 +238,7 @@ ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	case kScNameName: {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -241,10 +246,12 @@ ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Filename (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Filename") {
+	case kScNameFilename: {
 		_scValue->setString(_filename);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scGetProperty(name);
 	}
 }
@@ -252,13 +259,16 @@ ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseScriptHolder::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scSetProperty(name, value);
 	}
 }
@@ -40,6 +40,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -552,10 +553,11 @@ bool BaseSprite::persist(BasePersistenceManager *persistMgr) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetFrame
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetFrame") == 0) {
+	case kScNameGetFrame: {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt(-1);
 		if (index < 0 || index >= (int32)_frames.size()) {
@@ -570,7 +572,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteFrame") == 0) {
+	case kScNameDeleteFrame: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->isInt()) {
@@ -598,7 +600,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	case kScNameReset: {
 		stack->correctParams(0);
 		reset();
 		stack->pushNULL();
@@ -608,7 +610,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// AddFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddFrame") == 0) {
+	case kScNameAddFrame: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		const char *filename = NULL;
@@ -635,7 +637,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// InsertFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertFrame") == 0) {
+	case kScNameInsertFrame: {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		if (index < 0) {
@@ -671,7 +673,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Pause
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pause") == 0) {
+	case kScNamePause: {
 		stack->correctParams(0);
 		_paused = true;
 		stack->pushNULL();
@@ -681,12 +683,14 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Play
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Play") == 0) {
+	case kScNamePlay: {
 		stack->correctParams(0);
 		_paused = false;
 		stack->pushNULL();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptHolder::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -696,10 +700,11 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("sprite");
 		return _scValue;
 	}
@@ -707,7 +712,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumFrames (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumFrames") {
+	case kScNameNumFrames: {
 		_scValue->setInt(_frames.size());
 		return _scValue;
 	}
@@ -715,7 +720,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CurrentFrame") {
+	case kScNameCurrentFrame: {
 		_scValue->setInt(_currentFrame);
 		return _scValue;
 	}
@@ -723,7 +728,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PixelPerfect") {
+	case kScNamePixelPerfect: {
 		_scValue->setBool(_precise);
 		return _scValue;
 	}
@@ -731,7 +736,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Looping
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Looping") {
+	case kScNameLooping: {
 		_scValue->setBool(_looping);
 		return _scValue;
 	}
@@ -739,7 +744,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Owner (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Owner") {
+	case kScNameOwner: {
 		if (_owner == NULL) {
 			_scValue->setNULL();
 		} else {
@@ -751,7 +756,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Finished (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Finished") {
+	case kScNameFinished: {
 		_scValue->setBool(_finished);
 		return _scValue;
 	}
@@ -759,10 +764,12 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Paused (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Paused") {
+	case kScNamePaused: {
 		_scValue->setBool(_paused);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptHolder::scGetProperty(name);
 	}
 }
@@ -770,10 +777,11 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSprite::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentFrame
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "CurrentFrame") == 0) {
+	case kScNameCurrentFrame: {
 		_currentFrame = value->getInt(0);
 		if (_currentFrame >= (int32)_frames.size() || _currentFrame < 0) {
 			_currentFrame = -1;
@@ -785,7 +793,7 @@ bool BaseSprite::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PixelPerfect") == 0) {
+	case kScNamePixelPerfect: {
 		_precise = value->getBool();
 		return STATUS_OK;
 	}
@@ -793,10 +801,12 @@ bool BaseSprite::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Looping
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Looping") == 0) {
+	case kScNameLooping: {
 		_looping = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptHolder::scSetProperty(name, value);
 	}
 }
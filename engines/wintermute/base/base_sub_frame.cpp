@@ -37,6 +37,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -400,10 +401,11 @@ bool BaseSubFrame::persist(BasePersistenceManager *persistMgr) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetImage
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetImage") == 0) {
+	case kScNameGetImage: {
 		stack->correctParams(0);
 
 		if (!_surfaceFilename) {
@@ -417,7 +419,7 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// SetImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetImage") == 0) {
+	case kScNameSetImage: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -439,7 +441,9 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -452,10 +456,11 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	}
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("subframe");
 		return _scValue;
 	}
@@ -463,7 +468,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaColor") {
+	case kScNameAlphaColor: {
 
 		_scValue->setInt((int)_alpha);
 		return _scValue;
@@ -472,7 +477,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TransparentColor (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TransparentColor") {
+	case kScNameTransparentColor: {
 		_scValue->setInt((int)_transparent);
 		return _scValue;
 	}
@@ -480,7 +485,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is2DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Is2DOnly") {
+	case kScNameIs2DOnly: {
 		_scValue->setBool(_2DOnly);
 		return _scValue;
 	}
@@ -488,7 +493,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is3DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Is3DOnly") {
+	case kScNameIs3DOnly: {
 		_scValue->setBool(_3DOnly);
 		return _scValue;
 	}
@@ -496,7 +501,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MirrorX") {
+	case kScNameMirrorX: {
 		_scValue->setBool(_mirrorX);
 		return _scValue;
 	}
@@ -504,7 +509,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MirrorY") {
+	case kScNameMirrorY: {
 		_scValue->setBool(_mirrorY);
 		return _scValue;
 	}
@@ -512,7 +517,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Decoration") {
+	case kScNameDecoration: {
 		_scValue->setBool(_decoration);
 		return _scValue;
 	}
@@ -520,7 +525,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HotspotX") {
+	case kScNameHotspotX: {
 		_scValue->setInt(_hotspotX);
 		return _scValue;
 	}
@@ -528,10 +533,12 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HotspotY") {
+	case kScNameHotspotY: {
 		_scValue->setInt(_hotspotY);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scGetProperty(name);
 	}
 }
@@ -539,10 +546,11 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "AlphaColor") == 0) {
+	case kScNameAlphaColor: {
 		_alpha = (uint32)value->getInt();
 		return STATUS_OK;
 	}
@@ -550,7 +558,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is2DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Is2DOnly") == 0) {
+	case kScNameIs2DOnly: {
 		_2DOnly = value->getBool();
 		return STATUS_OK;
 	}
@@ -558,7 +566,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is3DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Is3DOnly") == 0) {
+	case kScNameIs3DOnly: {
 		_3DOnly = value->getBool();
 		return STATUS_OK;
 	}
@@ -566,7 +574,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MirrorX") == 0) {
+	case kScNameMirrorX: {
 		_mirrorX = value->getBool();
 		return STATUS_OK;
 	}
@@ -574,7 +582,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MirrorY") == 0) {
+	case kScNameMirrorY: {
 		_mirrorY = value->getBool();
 		return STATUS_OK;
 	}
@@ -582,7 +590,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Decoration") == 0) {
+	case kScNameDecoration: {
 		_decoration = value->getBool();
 		return STATUS_OK;
 	}
@@ -590,7 +598,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HotspotX") == 0) {
+	case kScNameHotspotX: {
 		_hotspotX = value->getInt();
 		return STATUS_OK;
 	}
@@ -598,10 +606,12 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HotspotY") == 0) {
+	case kScNameHotspotY: {
 		_hotspotY = value->getInt();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scSetProperty(name, value);
 	}
 }
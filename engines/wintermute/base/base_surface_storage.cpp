@@ -31,8 +31,13 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_frame.h"
+#include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/base/base_sub_frame.h"
 #include "engines/wintermute/platform_osystem.h"
+#include "engines/wintermute/wintermute.h"
 #include "common/str.h"
+#include "common/system.h"
 
 namespace Wintermute {
 
@@ -41,6 +46,9 @@ namespace Wintermute {
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::BaseSurfaceStorage(BaseGame *inGame) : BaseClass(inGame) {
 	_lastCleanupTime = 0;
+	_preloading = false;
+	_numPreloaded = _preloadTime = 0;
+	_numLoadedOnDemand = _onDemandTime = 0;
 }
 
 
@@ -60,6 +68,10 @@ bool BaseSurfaceStorage::cleanup(bool warn) {
 	}
 	_surfaces.clear();
 
+	for (int i = 0; i < NUM_SURFACE_PRIORITIES; i++) {
+		_preloadQueue[i].clear();
+	}
+
 	return STATUS_OK;
 }
 
@@ -90,6 +102,9 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 		if (_surfaces[i] == surface) {
 			_surfaces[i]->_referenceCount--;
 			if (_surfaces[i]->_referenceCount <= 0) {
+				for (int j = 0; j < NUM_SURFACE_PRIORITIES; j++) {
+					_preloadQueue[j].remove(surface);
+				}
 				delete _surfaces[i];
 				_surfaces.remove_at(i);
 			}
@@ -138,6 +153,82 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 }
 
 
+//////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::preloadSurface(BaseSurface *surface, TSurfacePriority priority) {
+	if (!surface || surface->isLoaded()) {
+		return STATUS_OK;
+	}
+
+	_preloadQueue[priority].push_back(surface);
+	return STATUS_OK;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::preloadSprite(BaseSprite *sprite, TSurfacePriority priority) {
+	if (!sprite) {
+		return STATUS_OK;
+	}
+
+	// Streamed sprites get their frames unloaded soon after drawing them,
+	// loading them in advance would only waste memory
+	uint32 numFrames = sprite->isStreamed() ? MIN<uint32>(sprite->_frames.size(), 1) : sprite->_frames.size();
+	for (uint32 i = 0; i < numFrames; i++) {
+		BaseFrame *frame = sprite->_frames[i];
+		for (uint32 j = 0; j < frame->_subframes.size(); j++) {
+			preloadSurface(frame->_subframes[j]->_surface, priority);
+		}
+	}
+	return STATUS_OK;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::preloadSurfaces(uint32 timeBudget) {
+	uint32 startTime = g_system->getMillis();
+	bool preloaded = false;
+
+	for (int priority = NUM_SURFACE_PRIORITIES - 1; priority >= 0; priority--) {
+		Common::List<BaseSurface *> &queue = _preloadQueue[priority];
+		while (!queue.empty()) {
+			if (preloaded && g_system->getMillis() - startTime >= timeBudget) {
+				return;
+			}
+
+			BaseSurface *surface = queue.front();
+			queue.pop_front();
+			if (surface->isLoaded()) {
+				continue;
+			}
+
+			_preloading = true;
+			surface->preload();
+			_preloading = false;
+			preloaded = true;
+		}
+	}
+
+	if (preloaded) {
+		debugC(kWintermuteDebugGeneral, "Preloaded %d surfaces in %d ms, %d surfaces loaded on demand in %d ms",
+		       _numPreloaded, _preloadTime, _numLoadedOnDemand, _onDemandTime);
+		_numPreloaded = _preloadTime = 0;
+		_numLoadedOnDemand = _onDemandTime = 0;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::addLoadTime(uint32 time) {
+	if (_preloading) {
+		_numPreloaded++;
+		_preloadTime += time;
+	} else {
+		_numLoadedOnDemand++;
+		_onDemandTime += time;
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::restoreAll() {
 	bool ret;
@@ -30,10 +30,13 @@
 #define WINTERMUTE_BASE_SURFACE_STORAGE_H
 
 #include "engines/wintermute/base/base.h"
+#include "engines/wintermute/dctypes.h"
 #include "common/array.h"
+#include "common/list.h"
 
 namespace Wintermute {
 class BaseSurface;
+class BaseSprite;
 class BaseSurfaceStorage : public BaseClass {
 public:
 	uint32 _lastCleanupTime;
@@ -49,7 +52,24 @@ public:
 	BaseSurfaceStorage(BaseGame *inGame);
 	virtual ~BaseSurfaceStorage();
 
+	// Surfaces load their images when they are first drawn. Queued surfaces
+	// get loaded before that, while the game waits for the next frame.
+	bool preloadSurface(BaseSurface *surface, TSurfacePriority priority);
+	bool preloadSprite(BaseSprite *sprite, TSurfacePriority priority);
+	void preloadSurfaces(uint32 timeBudget);
+	void addLoadTime(uint32 time);
+
 	Common::Array<BaseSurface *> _surfaces;
+
+private:
+	Common::List<BaseSurface *> _preloadQueue[NUM_SURFACE_PRIORITIES];
+	bool _preloading;
+
+	// Since the queue was last empty
+	uint32 _numPreloaded;
+	uint32 _preloadTime;
+	uint32 _numLoadedOnDemand;
+	uint32 _onDemandTime;
 };
 
 } // end of namespace Wintermute
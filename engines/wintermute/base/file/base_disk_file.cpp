@@ -31,6 +31,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "common/stream.h"
 #include "common/memstream.h"
+#include "common/substream.h"
 #include "common/file.h"
 #include "common/zlib.h"
 #include "common/archive.h"
@@ -153,33 +154,17 @@ Common::SeekableReadStream *openDiskFile(const Common::String &filename) {
 			compSize = file->readUint32LE();
 			uncompSize = file->readUint32LE();
 
-			byte *compBuffer = new byte[compSize];
-			if (!compBuffer) {
-				error("Error allocating memory for compressed file '%s'", filename.c_str());
-				delete file;
-				return NULL;
-			}
-
-			byte *data = new byte[uncompSize];
-			if (!data) {
-				error("Error allocating buffer for file '%s'", filename.c_str());
-				delete[] compBuffer;
-				delete file;
-				return NULL;
-			}
-			file->seek(dataOffset + prefixSize, SEEK_SET);
-			file->read(compBuffer, compSize);
-
-			if (Common::uncompress(data, (unsigned long *)&uncompSize, compBuffer, compSize) != true) {
+			// Inflate the data as it's read, instead of all of it up front.
+			// Sounds and sprites get seeked around in.
+			dataOffset += prefixSize;
+			Common::SeekableReadStream *data = new Common::SeekableSubReadStream(file, dataOffset, dataOffset + compSize, DisposeAfterUse::YES);
+			Common::SeekableReadStream *inflated = Common::wrapCompressedReadStream(data, uncompSize);
+			if (inflated == data) {
 				error("Error uncompressing file '%s'", filename.c_str());
-				delete[] compBuffer;
-				delete file;
+				delete data;
 				return NULL;
 			}
-
-			delete[] compBuffer;
-			delete file;
-			return new Common::MemoryReadStream(data, uncompSize, DisposeAfterUse::YES);
+			return inflated;
 		} else {
 			file->seek(0, SEEK_SET);
 			return file;
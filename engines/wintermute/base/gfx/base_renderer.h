@@ -128,6 +128,10 @@ public:
 	virtual bool displayDebugInfo() {
 		return STATUS_FAILED;
 	};
+	/** Shows statistics about drawing the last frames next to the FPS. */
+	virtual bool displayFrameStats() {
+		return STATUS_FAILED;
+	}
 	virtual bool drawShaderQuad() {
 		return STATUS_FAILED;
 	}
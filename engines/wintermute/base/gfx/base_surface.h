@@ -69,6 +69,15 @@ public:
 	virtual bool isTransparentAtLite(int x, int y);
 	void setSize(int width, int height);
 
+	// Surfaces which load their image when first used can be made to load it
+	// earlier, see BaseSurfaceStorage::preloadSurfaces()
+	virtual bool isLoaded() {
+		return true;
+	}
+	virtual bool preload() {
+		return STATUS_OK;
+	}
+
 	int _referenceCount;
 
 	virtual int getWidth() {
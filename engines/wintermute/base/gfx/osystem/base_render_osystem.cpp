@@ -34,6 +34,8 @@
 #include "engines/wintermute/math/math_util.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/base/font/base_font.h"
+#include "engines/wintermute/wintermute.h"
 #include "common/system.h"
 #include "engines/wintermute/graphics/transparent_surface.h"
 #include "common/queue.h"
@@ -58,11 +60,19 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_ratioX = _ratioY = 1.0f;
 	setAlphaMod(255);
 	setColorMod(255, 255, 255);
-	_dirtyRect = NULL;
+	_dirtyTilesWidth = _dirtyTilesHeight = 0;
+	_hasDirtyTiles = false;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
 	}
+	_useAlphaSpans = true;
+	if (ConfMan.hasKey("alpha_spans")) {
+		_useAlphaSpans = ConfMan.getBool("alpha_spans");
+	}
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	memset(&_lastFrameStats, 0, sizeof(_lastFrameStats));
+	_frameStatsStart = g_system->getMillis();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -71,7 +81,6 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 	delete _renderSurface;
 	_blankSurface->free();
 	delete _blankSurface;
-	TransparentSurface::destroyLookup();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -131,6 +140,11 @@ bool BaseRenderOSystem::initRenderer(int width, int height, bool windowed) {
 	_blankSurface->fillRect(Common::Rect(0, 0, _blankSurface->h, _blankSurface->w), _blankSurface->format.ARGBToColor(255, 0, 0, 0));
 	_active = true;
 
+	_dirtyTilesWidth = (_renderSurface->w + kDirtyTileSize - 1) / kDirtyTileSize;
+	_dirtyTilesHeight = (_renderSurface->h + kDirtyTileSize - 1) / kDirtyTileSize;
+	_dirtyTiles.resize(_dirtyTilesWidth * _dirtyTilesHeight);
+	clearDirtyTiles();
+
 	_clearColor = _renderSurface->format.ARGBToColor(255, 0, 0, 0);
 
 	return STATUS_OK;
@@ -155,29 +169,41 @@ bool BaseRenderOSystem::indicatorFlip() {
 }
 
 bool BaseRenderOSystem::flip() {
+	uint32 blitStart = g_system->getMillis();
 	if (!_disableDirtyRects) {
 		drawTickets();
 	} else {
 		// Clear the scale-buffered tickets that wasn't reused.
-		RenderQueueIterator it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			if ((*it)->_wantsDraw == false) {
-				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
-				delete ticket;
+		uint j = 0;
+		for (uint i = 0; i < _renderQueue.size(); i++) {
+			RenderTicket *ticket = _renderQueue[i];
+			if (ticket->_wantsDraw == false) {
+				deleteTicket(ticket);
 			} else {
-				(*it)->_wantsDraw = false;
-				++it;
+				ticket->_wantsDraw = false;
+				_renderQueue[j++] = ticket;
 			}
 		}
+		_renderQueue.resize(j);
 	}
+
+	uint32 now = g_system->getMillis();
+	_frameStats.blitTime += now - blitStart;
+	_frameStats.frames++;
+	if (now - _frameStatsStart >= 1000) {
+		_lastFrameStats = _frameStats;
+		debugC(kWintermuteDebugGeneral, "%d frames: %d ms blitting, %d tickets reused, %d created, %d dirty rects",
+		       _frameStats.frames, _frameStats.blitTime, _frameStats.ticketsReused, _frameStats.ticketsCreated, _frameStats.dirtyRects);
+		memset(&_frameStats, 0, sizeof(_frameStats));
+		_frameStatsStart = now;
+	}
+
 	if (_needsFlip || _disableDirtyRects) {
 		if (_disableDirtyRects) {
 			g_system->copyRectToScreen((byte *)_renderSurface->pixels, _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
 		//  g_system->copyRectToScreen((byte *)_renderSurface->pixels, _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = NULL;
+		clearDirtyTiles();
 		g_system->updateScreen();
 		_needsFlip = false;
 	}
@@ -186,6 +212,26 @@ bool BaseRenderOSystem::flip() {
 	return STATUS_OK;
 }
 
+bool BaseRenderOSystem::displayFrameStats() {
+	const FrameStats &stats = _lastFrameStats;
+	if (stats.frames == 0) {
+		return STATUS_FAILED;
+	}
+
+	// Per frame averages, with one decimal
+	char str[100];
+	sprintf(str, "Tickets: %d, reused: %d.%d, new: %d.%d, dirty rects: %d.%d", _renderQueue.size(),
+	        stats.ticketsReused / stats.frames, stats.ticketsReused * 10 / stats.frames % 10,
+	        stats.ticketsCreated / stats.frames, stats.ticketsCreated * 10 / stats.frames % 10,
+	        stats.dirtyRects / stats.frames, stats.dirtyRects * 10 / stats.frames % 10);
+	_gameRef->_systemFont->drawText((byte *)str, 0, 20, _width, TAL_LEFT);
+
+	sprintf(str, "Blit: %d.%d ms (alpha spans %s)",
+	        stats.blitTime / stats.frames, stats.blitTime * 10 / stats.frames % 10, _useAlphaSpans ? "on" : "off");
+	_gameRef->_systemFont->drawText((byte *)str, 0, 40, _width, TAL_LEFT);
+	return STATUS_OK;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool BaseRenderOSystem::fill(byte r, byte g, byte b, Common::Rect *rect) {
 	_clearColor = _renderSurface->format.ARGBToColor(0xFF, r, g, b);
@@ -260,49 +306,80 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	if ((dstRect->left < 0 && dstRect->right < 0) || (dstRect->top < 0 && dstRect->bottom < 0)) {
 		return;
 	}
-	// Start searching from the beginning for the first and second items (since it's empty the first time around
-	// then keep incrementing the start-position, to avoid comparing against already used tickets.
-	if (_drawNum == 0 || _drawNum == 1) {
-		_lastAddedTicket = _renderQueue.begin();
-	}
-
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, NULL, srcRect, dstRect, mirrorX, mirrorY, disableAlpha);
 		compare._batchNum = _batchNum;
 		if (_spriteBatch)
 			_batchNum++;
 		compare._colorMod = _colorMod;
-		RenderQueueIterator it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = NULL;
-		for (it = _lastAddedTicket; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				compareTicket->_colorMod = _colorMod;
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromTicket(compareTicket);
-					_lastAddedTicket++;
-				}
-				return;
+		RenderTicket *compareTicket = findTicket(compare);
+		if (compareTicket) {
+			_frameStats.ticketsReused++;
+			if (_disableDirtyRects) {
+				drawFromSurface(compareTicket);
+			} else {
+				drawFromTicket(compareTicket);
 			}
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, mirrorX, mirrorY, disableAlpha);
 	ticket->_colorMod = _colorMod;
+	if (owner) {
+		_ticketIndex[ticket->getHash()].push_back(ticket);
+	}
+	_frameStats.ticketsCreated++;
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
 		drawFromSurface(ticket);
-		_lastAddedTicket++;
 	} else {
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
 	}
 }
 
+RenderTicket *BaseRenderOSystem::findTicket(RenderTicket &compare) {
+	RenderTicketIndex::iterator bucket = _ticketIndex.find(compare.getHash());
+	if (bucket == _ticketIndex.end()) {
+		return NULL;
+	}
+
+	// With dirty rects, tickets before _drawNum have been drawn this frame
+	// already. Of the others, the first one in the queue is taken.
+	RenderTicket *found = NULL;
+	for (uint i = 0; i < bucket->_value.size(); i++) {
+		RenderTicket *ticket = bucket->_value[i];
+		if (!ticket->_isValid || !(*ticket == compare)) {
+			continue;
+		}
+		if (_disableDirtyRects) {
+			return ticket;
+		}
+		if (ticket->_drawNum >= _drawNum && (!found || ticket->_drawNum < found->_drawNum)) {
+			found = ticket;
+		}
+	}
+	return found;
+}
+
+void BaseRenderOSystem::deleteTicket(RenderTicket *ticket) {
+	if (ticket->_owner) {
+		RenderTicketIndex::iterator bucket = _ticketIndex.find(ticket->getHash());
+		if (bucket != _ticketIndex.end()) {
+			for (uint i = 0; i < bucket->_value.size(); i++) {
+				if (bucket->_value[i] == ticket) {
+					bucket->_value.remove_at(i);
+					break;
+				}
+			}
+			if (bucket->_value.empty()) {
+				_ticketIndex.erase(bucket);
+			}
+		}
+	}
+	delete ticket;
+}
+
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
@@ -310,10 +387,9 @@ void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
-	RenderQueueIterator it;
-	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		if ((*it)->_owner == surf) {
-			invalidateTicket(*it);
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		if (_renderQueue[i]->_owner == surf) {
+			invalidateTicket(_renderQueue[i]);
 		}
 	}
 }
@@ -328,20 +404,15 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 			_renderQueue.push_back(renderTicket);
 			addDirtyRect(renderTicket->_dstRect);
 		} else {
-			// Before something
-			Common::List<RenderTicket *>::iterator pos;
-			for (pos = _renderQueue.begin(); pos != _renderQueue.end(); pos++) {
-				if ((*pos)->_drawNum >= _drawNum) {
-					break;
-				}
-			}
-			_renderQueue.insert(pos, renderTicket);
-			Common::List<RenderTicket *>::iterator it;
+			// Before something, the ticket at _drawNum is the first one not drawn yet
+			uint pos = _drawNum - 1;
+			assert(_renderQueue[pos]->_drawNum == _drawNum);
+			_renderQueue.insert_at(pos, renderTicket);
 			renderTicket->_drawNum = _drawNum++;
 			// Increment the following tickets, so they still are in line
-			for (it = pos; it != _renderQueue.end(); ++it) {
-				(*it)->_drawNum++;
-				(*it)->_wantsDraw = false;
+			for (uint i = pos + 1; i < _renderQueue.size(); i++) {
+				_renderQueue[i]->_drawNum++;
+				_renderQueue[i]->_wantsDraw = false;
 			}
 			addDirtyRect(renderTicket->_dstRect);
 		}
@@ -350,21 +421,13 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 		if (_drawNum == renderTicket->_drawNum) {
 			_drawNum++;
 		} else {
-			// Remove the ticket from the list
-			RenderQueueIterator it = _renderQueue.begin();
-			while (it != _renderQueue.end()) {
-				if ((*it) == renderTicket) {
-					it = _renderQueue.erase(it);
-					break;
-				} else {
-					++it;
-				}
-			}
-			if (it != _renderQueue.end()) {
-				// Decreement the following tickets.
-				for (; it != _renderQueue.end(); ++it) {
-					(*it)->_drawNum--;
-				}
+			// Remove the ticket from the queue
+			uint pos = renderTicket->_drawNum - 1;
+			assert(_renderQueue[pos] == renderTicket);
+			_renderQueue.remove_at(pos);
+			// Decrement the following tickets.
+			for (uint i = pos; i < _renderQueue.size(); i++) {
+				_renderQueue[i]->_drawNum--;
 			}
 			// Is not in order, so readd it as if it was a new ticket
 			renderTicket->_drawNum = 0;
@@ -374,57 +437,122 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirtyRect(rect);
+	dirtyRect.clip(_renderRect);
+	dirtyRect.clip(Common::Rect(_dirtyTilesWidth * kDirtyTileSize, _dirtyTilesHeight * kDirtyTileSize));
+	if (dirtyRect.isEmpty()) {
+		return;
 	}
-	_dirtyRect->clip(_renderRect);
+
+	for (int y = dirtyRect.top / kDirtyTileSize; y <= (dirtyRect.bottom - 1) / kDirtyTileSize; y++) {
+		for (int x = dirtyRect.left / kDirtyTileSize; x <= (dirtyRect.right - 1) / kDirtyTileSize; x++) {
+			_dirtyTiles[y * _dirtyTilesWidth + x] = true;
+		}
+	}
+	_hasDirtyTiles = true;
+}
+
+void BaseRenderOSystem::getDirtyRects(Common::Array<Common::Rect> &rects) const {
+	// Every run of dirty tiles in a row starts a rect, which grows downwards
+	// for as long as the rows below have a run of the same tiles
+	Common::Array<Common::Rect> open, next;
+	for (int y = 0; y < _dirtyTilesHeight; y++) {
+		int x = 0;
+		while (x < _dirtyTilesWidth) {
+			if (!_dirtyTiles[y * _dirtyTilesWidth + x]) {
+				x++;
+				continue;
+			}
+			int start = x;
+			while (x < _dirtyTilesWidth && _dirtyTiles[y * _dirtyTilesWidth + x]) {
+				x++;
+			}
+
+			Common::Rect run(start * kDirtyTileSize, y * kDirtyTileSize, x * kDirtyTileSize, (y + 1) * kDirtyTileSize);
+			for (uint i = 0; i < open.size(); i++) {
+				if (open[i].left == run.left && open[i].right == run.right) {
+					run.top = open[i].top;
+					open.remove_at(i);
+					break;
+				}
+			}
+			next.push_back(run);
+		}
+
+		// What wasn't continued is complete
+		rects.push_back(open);
+		open = next;
+		next.clear();
+	}
+	rects.push_back(open);
+
+	// The tiles at the right and bottom edges may reach outside
+	Common::Rect bounds(_renderRect);
+	bounds.clip(Common::Rect(_renderSurface->w, _renderSurface->h));
+	for (uint i = 0; i < rects.size(); i++) {
+		rects[i].clip(bounds);
+	}
+}
+
+void BaseRenderOSystem::clearDirtyTiles() {
+	for (uint i = 0; i < _dirtyTiles.size(); i++) {
+		_dirtyTiles[i] = false;
+	}
+	_hasDirtyTiles = false;
 }
 
 void BaseRenderOSystem::drawTickets() {
-	RenderQueueIterator it = _renderQueue.begin();
 	// Clean out the old tickets
 	// Note: We draw invalid tickets too, otherwise we wouldn't be honouring
 	// the draw request they obviously made BEFORE becoming invalid, either way
 	// we have a copy of their data, so their invalidness won't affect us.
 	uint32 decrement = 0;
-	while (it != _renderQueue.end()) {
-		if ((*it)->_wantsDraw == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
+	uint j = 0;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (ticket->_wantsDraw == false) {
+			addDirtyRect(ticket->_dstRect);
+			deleteTicket(ticket);
 			decrement++;
 		} else {
-			(*it)->_drawNum -= decrement;
-			++it;
+			ticket->_drawNum -= decrement;
+			_renderQueue[j++] = ticket;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
-		it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			RenderTicket *ticket = *it;
-			ticket->_wantsDraw = false;
-			++it;
+	_renderQueue.resize(j);
+
+	Common::Array<Common::Rect> dirtyRects;
+	if (_hasDirtyTiles) {
+		getDirtyRects(dirtyRects);
+	}
+	if (dirtyRects.empty()) {
+		for (uint i = 0; i < _renderQueue.size(); i++) {
+			_renderQueue[i]->_wantsDraw = false;
 		}
 		return;
 	}
+	_frameStats.dirtyRects += dirtyRects.size();
+
 	// The color-mods are stored in the RenderTickets on add, since we set that state again during
 	// draw, we need to keep track of what it was prior to draw.
 	uint32 oldColorMod = _colorMod;
 
-	// Apply the clear-color to the dirty rect.
-	_renderSurface->fillRect(*_dirtyRect, _clearColor);
+	// Apply the clear-color to the dirty rects.
+	for (uint i = 0; i < dirtyRects.size(); i++) {
+		_renderSurface->fillRect(dirtyRects[i], _clearColor);
+	}
 	_drawNum = 1;
-	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
 		assert(ticket->_drawNum == _drawNum++);
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+		for (uint k = 0; k < dirtyRects.size(); k++) {
+			if (!ticket->_dstRect.intersects(dirtyRects[k])) {
+				continue;
+			}
 			// dstClip is the area we want redrawn.
 			Common::Rect dstClip(ticket->_dstRect);
 			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
+			dstClip.clip(dirtyRects[k]);
 			// we need to keep track of the position to redraw the dirty rect
 			Common::Rect pos(dstClip);
 			int16 offsetX = ticket->_dstRect.left;
@@ -439,27 +567,29 @@ void BaseRenderOSystem::drawTickets() {
 		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
 		ticket->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
+	for (uint i = 0; i < dirtyRects.size(); i++) {
+		const Common::Rect &rect = dirtyRects[i];
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(rect.left, rect.top), _renderSurface->pitch, rect.left, rect.top, rect.width(), rect.height());
+	}
 
 	// Revert the colorMod-state.
 	_colorMod = oldColorMod;
-	
-	it = _renderQueue.begin();
+
 	// Clean out the old tickets
 	decrement = 0;
-	while (it != _renderQueue.end()) {
-		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
+	j = 0;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (ticket->_isValid == false) {
+			addDirtyRect(ticket->_dstRect);
+			deleteTicket(ticket);
 			decrement++;
 		} else {
-			(*it)->_drawNum -= decrement;
-			++it;
+			ticket->_drawNum -= decrement;
+			_renderQueue[j++] = ticket;
 		}
 	}
-
+	_renderQueue.resize(j);
 }
 
 // Replacement for SDL2's SDL_RenderCopy
@@ -577,12 +707,11 @@ void BaseRenderOSystem::endSaveLoad() {
 	BaseRenderer::endSaveLoad();
 
 	// Clear the scale-buffered tickets as we just loaded.
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		delete _renderQueue[i];
 	}
+	_renderQueue.clear();
+	_ticketIndex.clear();
 	_drawNum = 1;
 }
 
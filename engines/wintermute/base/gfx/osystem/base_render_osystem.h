@@ -32,7 +32,8 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
-#include "common/list.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 
 namespace Wintermute {
 class BaseSurfaceOSystem;
@@ -82,17 +83,40 @@ public:
 	void endSaveLoad();
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, bool mirrorX, bool mirrorY, bool disableAlpha = false);
 	BaseSurface *createSurface();
+
+	bool displayFrameStats();
+	/** Whether surfaces should be blitted by their alpha spans, see AlphaSpans. */
+	bool useAlphaSpans() const {
+		return _useAlphaSpans;
+	}
 private:
 	void addDirtyRect(const Common::Rect &rect);
+	void getDirtyRects(Common::Array<Common::Rect> &rects) const;
+	void clearDirtyTiles();
 	void drawTickets();
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	typedef Common::List<RenderTicket *>::iterator RenderQueueIterator;
-	Common::Rect *_dirtyRect;
-	Common::List<RenderTicket *> _renderQueue;
-	RenderQueueIterator _lastAddedTicket;
+	RenderTicket *findTicket(RenderTicket &compare);
+	void deleteTicket(RenderTicket *ticket);
+
+	// All tickets in the order they are drawn. With dirty rects, the ticket
+	// at index i has a _drawNum of i + 1.
+	Common::Array<RenderTicket *> _renderQueue;
+	// The owned tickets in the render queue by RenderTicket::getHash(), so
+	// that a draw doesn't need to search the whole queue for a ticket to reuse
+	typedef Common::HashMap<uint32, Common::Array<RenderTicket *> > RenderTicketIndex;
+	RenderTicketIndex _ticketIndex;
+
+	// The areas to redraw, as a grid of tiles covering the render surface
+	enum {
+		kDirtyTileSize = 32
+	};
+	Common::Array<bool> _dirtyTiles;
+	int _dirtyTilesWidth;
+	int _dirtyTilesHeight;
+	bool _hasDirtyTiles;
 
 	bool _needsFlip;
 	uint32 _drawNum;
@@ -112,6 +136,20 @@ private:
 	float _ratioY;
 	uint32 _colorMod;
 	uint32 _clearColor;
+
+	bool _useAlphaSpans;
+
+	// Statistics for the FPS display, summed up over a second
+	struct FrameStats {
+		uint32 frames;
+		uint32 blitTime;
+		uint32 ticketsReused;
+		uint32 ticketsCreated;
+		uint32 dirtyRects;
+	};
+	FrameStats _frameStats;
+	FrameStats _lastFrameStats;
+	uint32 _frameStatsStart;
 };
 
 } // end of namespace Wintermute
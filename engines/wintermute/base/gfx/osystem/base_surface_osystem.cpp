@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 #include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
 #include "engines/wintermute/base/gfx/base_image.h"
@@ -70,22 +71,24 @@ BaseSurfaceOSystem::~BaseSurfaceOSystem() {
 	renderer->invalidateTicketsFromSurface(this);
 }
 
-bool hasTransparency(Graphics::Surface *surf) {
-	if (surf->format.bytesPerPixel != 4) {
-		warning("hasTransparency:: non 32 bpp surface passed as argument");
+bool BaseSurfaceOSystem::classifyAlpha() {
+	_alphaSpans.reset();
+	if (_surface->format.bytesPerPixel != 4) {
+		warning("BaseSurfaceOSystem::classifyAlpha - non 32 bpp surface");
 		return false;
 	}
-	uint8 r, g, b, a;
-	for (int i = 0; i < surf->h; i++) {
-		for (int j = 0; j < surf->w; j++) {
-			uint32 pix = *(uint32 *)surf->getBasePtr(j, i);
-			surf->format.colorToARGB(pix, a, r, g, b);
-			if (a != 255) {
-				return true;
-			}
-		}
+
+	AlphaSpans *spans = new AlphaSpans();
+	spans->build(*_surface);
+	bool hasTransparency = spans->hasTransparency();
+
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+	if (hasTransparency && renderer->useAlphaSpans()) {
+		_alphaSpans = Common::SharedPtr<AlphaSpans>(spans);
+	} else {
+		delete spans;
 	}
-	return false;
+	return hasTransparency;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -117,7 +120,18 @@ bool BaseSurfaceOSystem::create(const Common::String &filename, bool defaultCK,
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceOSystem::preload() {
+	if (!_loaded) {
+		return finishLoad();
+	}
+	return STATUS_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceOSystem::finishLoad() {
+	uint32 startTime = g_system->getMillis();
+
 	BaseImage *image = new BaseImage();
 	if (!image->loadFile(_filename)) {
 		return false;
@@ -159,7 +173,7 @@ bool BaseSurfaceOSystem::finishLoad() {
 		_surface->copyFrom(*image->getSurface());
 	}
 
-	_hasAlpha = hasTransparency(_surface);
+	_hasAlpha = classifyAlpha();
 	_valid = true;
 
 	_gameRef->addMem(_width * _height * 4);
@@ -168,6 +182,10 @@ bool BaseSurfaceOSystem::finishLoad() {
 
 	_loaded = true;
 
+	if (_gameRef->_surfaceStorage) {
+		_gameRef->_surfaceStorage->addLoadTime(g_system->getMillis() - startTime);
+	}
+
 	return true;
 }
 
@@ -419,6 +437,10 @@ bool BaseSurfaceOSystem::putSurface(const Graphics::Surface &surface, bool hasAl
 	_surface->free();
 	_surface->copyFrom(surface);
 	_hasAlpha = hasAlpha;
+	_alphaSpans.reset();
+	if (_hasAlpha) {
+		classifyAlpha();
+	}
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
 
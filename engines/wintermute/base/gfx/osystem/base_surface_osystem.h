@@ -32,8 +32,10 @@
 #include "graphics/surface.h"
 #include "engines/wintermute/base/gfx/base_surface.h"
 #include "common/list.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
+struct AlphaSpans;
 struct TransparentSurface;
 class BaseImage;
 class BaseSurfaceOSystem : public BaseSurface {
@@ -58,6 +60,10 @@ public:
 	bool displayZoom(int x, int y, Rect32 rect, float zoomX, float zoomY, uint32 alpha = 0xFFFFFFFF, bool transparent = false, TSpriteBlendMode blendMode = BLEND_NORMAL, bool mirrorX = false, bool mirrorY = false);
 	bool displayTransform(int x, int y, int hotX, int hotY, Rect32 Rect, float zoomX, float zoomY, uint32 alpha, float rotate, TSpriteBlendMode blendMode = BLEND_NORMAL, bool mirrorX = false, bool mirrorY = false);
 	virtual bool putSurface(const Graphics::Surface &surface, bool hasAlpha = false);
+	virtual bool isLoaded() {
+		return _loaded;
+	}
+	virtual bool preload();
 	/*  static unsigned DLL_CALLCONV ReadProc(void *buffer, unsigned size, unsigned count, fi_handle handle);
 	    static int DLL_CALLCONV SeekProc(fi_handle handle, long offset, int origin);
 	    static long DLL_CALLCONV TellProc(fi_handle handle);*/
@@ -80,6 +86,11 @@ public:
 		return _height;
 	}
 
+	/** The alpha spans of the surface, or none if it's opaque. */
+	const Common::SharedPtr<AlphaSpans> &getAlphaSpans() const {
+		return _alphaSpans;
+	}
+
 private:
 	Graphics::Surface *_surface;
 	bool _loaded;
@@ -87,11 +98,14 @@ private:
 	bool drawSprite(int x, int y, Rect32 *rect, float zoomX, float zoomY, uint32 alpha, bool alphaDisable, TSpriteBlendMode blendMode, bool mirrorX, bool mirrorY, int offsetX = 0, int offsetY = 0);
 	void genAlphaMask(Graphics::Surface *surface);
 	uint32 getPixelAt(Graphics::Surface *surface, int x, int y);
+	bool classifyAlpha();
 
 	bool _hasAlpha;
 	void *_lockPixels;
 	int _lockPitch;
 	byte *_alphaMask;
+	// Shared with the render tickets, which may outlive the surface
+	Common::SharedPtr<AlphaSpans> _alphaSpans;
 };
 
 } // end of namespace Wintermute
@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/graphics/transparent_surface.h"
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
+#include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 
 namespace Wintermute {
 
@@ -57,6 +58,8 @@ _srcRect(*srcRect), _dstRect(*dstRect), _drawNum(0), _isValid(true), _wantsDraw(
 			_surface->free();
 			delete _surface;
 			_surface = temp;
+		} else if (owner && _hasAlpha) {
+			_alphaSpans = owner->getAlphaSpans();
 		}
 	} else {
 		_surface = NULL;
@@ -83,6 +86,22 @@ bool RenderTicket::operator==(RenderTicket &t) {
 	return true;
 }
 
+uint32 RenderTicket::getHash() const {
+	uint32 hash = (uint32)(size_t)_owner;
+	hash = hash * 31 + (uint16)_srcRect.left;
+	hash = hash * 31 + (uint16)_srcRect.top;
+	hash = hash * 31 + (uint16)_srcRect.right;
+	hash = hash * 31 + (uint16)_srcRect.bottom;
+	hash = hash * 31 + (uint16)_dstRect.left;
+	hash = hash * 31 + (uint16)_dstRect.top;
+	hash = hash * 31 + (uint16)_dstRect.right;
+	hash = hash * 31 + (uint16)_dstRect.bottom;
+	hash = hash * 31 + _mirror;
+	hash = hash * 31 + _hasAlpha;
+	hash = hash * 31 + _colorMod;
+	return hash;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) {
 	TransparentSurface src(*getSurface(), false);
@@ -92,6 +111,8 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) {
 	clipRect.setHeight(getSurface()->h);
 
 	src._enableAlphaBlit = _hasAlpha;
+	src._alphaSpans = _alphaSpans.get();
+	src._alphaSpansOrigin = Common::Point(_srcRect.left, _srcRect.top);
 	src.blit(*_targetSurface, _dstRect.left, _dstRect.top, _mirror, &clipRect, _colorMod, clipRect.width(), clipRect.height());
 }
 
@@ -106,6 +127,8 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect
 	}
 
 	src._enableAlphaBlit = _hasAlpha;
+	src._alphaSpans = _alphaSpans.get();
+	src._alphaSpansOrigin = Common::Point(_srcRect.left, _srcRect.top);
 	src.blit(*_targetSurface, dstRect->left, dstRect->top, _mirror, clipRect, _colorMod, clipRect->width(), clipRect->height());
 	if (doDelete) {
 		delete clipRect;
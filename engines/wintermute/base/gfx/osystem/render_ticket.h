@@ -31,9 +31,11 @@
 
 #include "graphics/surface.h"
 #include "common/rect.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
 
+struct AlphaSpans;
 class BaseSurfaceOSystem;
 class RenderTicket {
 public:
@@ -56,11 +58,15 @@ public:
 
 	BaseSurfaceOSystem *_owner;
 	bool operator==(RenderTicket &a);
+	/** A hash of everything operator== compares, for looking up tickets to reuse. */
+	uint32 getHash() const;
 private:
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
 	bool _hasAlpha;
 	uint32 _mirror;
+	// The owner's alpha spans, as long as the surface isn't scaled
+	Common::SharedPtr<AlphaSpans> _alphaSpans;
 };
 
 } // end of namespace Wintermute
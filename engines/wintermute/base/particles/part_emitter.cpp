@@ -27,11 +27,11 @@
  */
 
 #include "engines/wintermute/base/particles/part_emitter.h"
-#include "engines/wintermute/base/particles/part_particle.h"
 #include "engines/wintermute/math/vector2.h"
 #include "engines/wintermute/math/matrix4.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_region.h"
 #include "engines/wintermute/base/base_file_manager.h"
@@ -40,6 +40,8 @@
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
 #include "common/math.h"
+#include "common/debug.h"
+#include "common/system.h"
 
 namespace Wintermute {
 
@@ -95,11 +97,6 @@ PartEmitter::PartEmitter(BaseGame *inGame, BaseScriptHolder *owner) : BaseObject
 
 //////////////////////////////////////////////////////////////////////////
 PartEmitter::~PartEmitter(void) {
-	for (uint32 i = 0; i < _particles.size(); i++) {
-		delete _particles[i];
-	}
-	_particles.clear();
-
 	for (uint32 i = 0; i < _forces.size(); i++) {
 		delete _forces[i];
 	}
@@ -157,10 +154,7 @@ bool PartEmitter::removeSprite(const char *filename) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint32 timerDelta) {
-	if (!particle) {
-		return STATUS_FAILED;
-	}
+bool PartEmitter::initParticle(uint32 currentTime, uint32 timerDelta) {
 	if (_sprites.size() == 0) {
 		return STATUS_FAILED;
 	}
@@ -197,20 +191,24 @@ bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint3
 	float angVelocity = BaseUtils::randomFloat(_angVelocity1, _angVelocity2);
 	float growthRate = BaseUtils::randomFloat(_growthRate1, _growthRate2);
 
-	if (!BasePlatform::isRectEmpty(&_border)) {
+	uint32 slot = _particles.allocate();
+
+	if (BasePlatform::isRectEmpty(&_border)) {
+		BasePlatform::setRectEmpty(&_particles._border[slot]);
+	} else {
 		int thicknessLeft   = (int)(_borderThicknessLeft   - (float)_borderThicknessLeft   * posZ / 100.0f);
 		int thicknessRight  = (int)(_borderThicknessRight  - (float)_borderThicknessRight  * posZ / 100.0f);
 		int thicknessTop    = (int)(_borderThicknessTop    - (float)_borderThicknessTop    * posZ / 100.0f);
 		int thicknessBottom = (int)(_borderThicknessBottom - (float)_borderThicknessBottom * posZ / 100.0f);
 
-		particle->_border = _border;
-		particle->_border.left += thicknessLeft;
-		particle->_border.right -= thicknessRight;
-		particle->_border.top += thicknessTop;
-		particle->_border.bottom -= thicknessBottom;
+		Rect32 &border = _particles._border[slot];
+		border = _border;
+		border.left += thicknessLeft;
+		border.right -= thicknessRight;
+		border.top += thicknessTop;
+		border.bottom -= thicknessBottom;
 	}
 
-	Vector2 vecPos((float)posX, (float)posY);
 	Vector2 vecVel(0, velocity);
 
 	Matrix4 matRot;
@@ -218,29 +216,30 @@ bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint3
 	matRot.transformVector2(vecVel);
 
 	if (_alphaTimeBased) {
-		particle->_alpha1 = _alpha1;
-		particle->_alpha2 = _alpha2;
+		_particles._alpha1[slot] = _alpha1;
+		_particles._alpha2[slot] = _alpha2;
 	} else {
 		int alpha = BaseUtils::randomInt(_alpha1, _alpha2);
-		particle->_alpha1 = alpha;
-		particle->_alpha2 = alpha;
-	}
-
-	particle->_creationTime = currentTime;
-	particle->_pos = vecPos;
-	particle->_posZ = posZ;
-	particle->_velocity = vecVel;
-	particle->_scale = scale;
-	particle->_lifeTime = lifeTime;
-	particle->_rotation = rotation;
-	particle->_angVelocity = angVelocity;
-	particle->_growthRate = growthRate;
-	particle->_exponentialGrowth = _exponentialGrowth;
-	particle->_isDead = DID_FAIL(particle->setSprite(_sprites[spriteIndex]));
-	particle->fadeIn(currentTime, _fadeInTime);
-
-
-	if (particle->_isDead) {
+		_particles._alpha1[slot] = alpha;
+		_particles._alpha2[slot] = alpha;
+	}
+
+	_particles._creationTime[slot] = currentTime;
+	_particles._posX[slot] = (float)posX;
+	_particles._posY[slot] = (float)posY;
+	_particles._posZ[slot] = posZ;
+	_particles._velX[slot] = vecVel.x;
+	_particles._velY[slot] = vecVel.y;
+	_particles._scale[slot] = scale;
+	_particles._lifeTime[slot] = lifeTime;
+	_particles._rotation[slot] = rotation;
+	_particles._angVelocity[slot] = angVelocity;
+	_particles._growthRate[slot] = growthRate;
+	_particles._exponentialGrowth[slot] = _exponentialGrowth;
+	_particles.fadeIn(slot, currentTime, _fadeInTime);
+
+	if (DID_FAIL(_particles.setSprite(_gameRef, slot, _sprites[spriteIndex]))) {
+		_particles.kill(slot);
 		return STATUS_FAILED;
 	} else {
 		return STATUS_OK;
@@ -258,16 +257,8 @@ bool PartEmitter::update() {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
-	int numLive = 0;
-
-	for (uint32 i = 0; i < _particles.size(); i++) {
-		_particles[i]->update(this, currentTime, timerDelta);
-
-		if (!_particles[i]->_isDead) {
-			numLive++;
-		}
-	}
-
+	_particles.update(this, currentTime, timerDelta);
+	int numLive = _particles.getNumLive();
 
 	// we're understaffed
 	if (numLive < _maxParticles) {
@@ -282,22 +273,7 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 
 			int toGen = MIN(_genAmount, _maxParticles - numLive);
 			while (toGen > 0) {
-				int firstDeadIndex = -1;
-				for (uint32 i = 0; i < _particles.size(); i++) {
-					if (_particles[i]->_isDead) {
-						firstDeadIndex = i;
-						break;
-					}
-				}
-
-				PartParticle *particle;
-				if (firstDeadIndex >= 0) {
-					particle = _particles[firstDeadIndex];
-				} else {
-					particle = new PartParticle(_gameRef);
-					_particles.add(particle);
-				}
-				initParticle(particle, currentTime, timerDelta);
+				initParticle(currentTime, timerDelta);
 				needsSort = true;
 
 				toGen--;
@@ -324,15 +300,7 @@ bool PartEmitter::display(BaseRegion *region) {
 		_gameRef->_renderer->startSpriteBatch();
 	}
 
-	for (uint32 i = 0; i < _particles.size(); i++) {
-		if (region != NULL && _useRegion) {
-			if (!region->pointInRegion((int)_particles[i]->_pos.x, (int)_particles[i]->_pos.y)) {
-				continue;
-			}
-		}
-
-		_particles[i]->display(this);
-	}
+	_particles.display(this, _useRegion ? region : NULL);
 
 	if (_sprites.size() <= 1) {
 		_gameRef->_renderer->endSpriteBatch();
@@ -343,9 +311,7 @@ bool PartEmitter::display(BaseRegion *region) {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::start() {
-	for (uint32 i = 0; i < _particles.size(); i++) {
-		_particles[i]->_isDead = true;
-	}
+	_particles.killAll();
 	_running = true;
 	_batchesGenerated = 0;
 
@@ -367,22 +333,10 @@ bool PartEmitter::start() {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::sortParticlesByZ() {
-	// sort particles by _posY
-	Common::sort(_particles.begin(), _particles.end(), PartEmitter::compareZ);
+	_particles.sortByZ();
 	return STATUS_OK;
 }
 
-//////////////////////////////////////////////////////////////////////////
-bool PartEmitter::compareZ(const PartParticle *p1, const PartParticle *p2) {
-	if (p1->_posZ < p2->_posZ) {
-		return true;
-	} else if (p1->_posZ > p2->_posZ) {
-		return false;
-	} else {
-		return false;
-	}
-}
-
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::setBorder(int x, int y, int width, int height) {
 	BasePlatform::setRect(&_border, x, y, x + width, y + height);
@@ -452,14 +406,70 @@ bool PartEmitter::removeForce(const Common::String &name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+bool PartEmitter::benchmark(BaseGame *game, const Common::String &spriteFilename, uint32 &liveParticles, uint32 &updatesPerMs) {
+	PartEmitter *emitter = new PartEmitter(game, game);
+	if (DID_FAIL(emitter->addSprite(spriteFilename.c_str()))) {
+		delete emitter;
+		return false;
+	}
+
+	// Snow falling over the whole screen, blown sideways and towards the center
+	const int width = game->_renderer->_width;
+	const int height = game->_renderer->_height;
+	emitter->_width = width;
+	emitter->_maxParticles = 5000;
+	emitter->_genAmount = 100;
+	emitter->_lifeTime1 = 2000;
+	emitter->_lifeTime2 = 6000;
+	emitter->_velocity1 = 50.0f;
+	emitter->_velocity2 = 150.0f;
+	emitter->_angle1 = 160;
+	emitter->_angle2 = 200;
+	emitter->_angVelocity1 = -90.0f;
+	emitter->_angVelocity2 = 90.0f;
+	emitter->_fadeInTime = emitter->_fadeOutTime = 250;
+	emitter->_alpha2 = 0;
+	emitter->_alphaTimeBased = true;
+	emitter->setBorder(0, 0, width, height);
+	emitter->addForce("wind", PartForce::FORCE_GLOBAL, 0, 0, 90.0f, 20.0f);
+	emitter->addForce("center", PartForce::FORCE_POINT, width / 2, height / 2, 0.0f, 50.0f);
+	emitter->_running = true;
+
+	const uint32 frameTime = 20;
+	const uint32 numFrames = 2000;
+	uint32 currentTime = 0;
+
+	// Let the particles fill the screen first
+	for (uint32 i = 0; i < 200; i++) {
+		currentTime += frameTime;
+		emitter->updateInternal(currentTime, frameTime);
+	}
+
+	uint32 numUpdates = 0;
+	uint32 startTime = g_system->getMillis();
+	for (uint32 i = 0; i < numFrames; i++) {
+		currentTime += frameTime;
+		numUpdates += emitter->_particles.getNumLive();
+		emitter->updateInternal(currentTime, frameTime);
+	}
+	uint32 time = MAX<uint32>(g_system->getMillis() - startTime, 1);
+
+	liveParticles = numUpdates / numFrames;
+	updatesPerMs = numUpdates / time;
+	delete emitter;
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetBorder
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetBorder") == 0) {
+	case kScNameSetBorder: {
 		stack->correctParams(4);
 		int borderX      = stack->pop()->getInt();
 		int borderY      = stack->pop()->getInt();
@@ -473,7 +483,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetBorderThickness
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetBorderThickness") == 0) {
+	case kScNameSetBorderThickness: {
 		stack->correctParams(4);
 		int left   = stack->pop()->getInt();
 		int right  = stack->pop()->getInt();
@@ -487,7 +497,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// AddSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSprite") == 0) {
+	case kScNameAddSprite: {
 		stack->correctParams(1);
 		const char *spriteFile = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(addSprite(spriteFile)));
@@ -497,7 +507,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveSprite") == 0) {
+	case kScNameRemoveSprite: {
 		stack->correctParams(1);
 		const char *spriteFile = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(removeSprite(spriteFile)));
@@ -508,7 +518,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Start
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Start") == 0) {
+	case kScNameStart: {
 		stack->correctParams(1);
 		_overheadTime = stack->pop()->getInt();
 		stack->pushBool(DID_SUCCEED(start()));
@@ -519,12 +529,9 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Stop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Stop") == 0) {
+	case kScNameStop: {
 		stack->correctParams(0);
 
-		for (uint32 i = 0; i < _particles.size(); i++) {
-			delete _particles[i];
-		}
 		_particles.clear();
 
 		_running = false;
@@ -536,7 +543,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Pause
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pause") == 0) {
+	case kScNamePause: {
 		stack->correctParams(0);
 		_running = false;
 		stack->pushBool(true);
@@ -547,7 +554,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Resume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Resume") == 0) {
+	case kScNameResume: {
 		stack->correctParams(0);
 		_running = true;
 		stack->pushBool(true);
@@ -558,7 +565,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// AddGlobalForce
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddGlobalForce") == 0) {
+	case kScNameAddGlobalForce: {
 		stack->correctParams(3);
 		const char *forceName = stack->pop()->getString();
 		float angle = stack->pop()->getFloat();
@@ -572,7 +579,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// AddPointForce
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddPointForce") == 0) {
+	case kScNameAddPointForce: {
 		stack->correctParams(5);
 		const char *forceName = stack->pop()->getString();
 		int posX = stack->pop()->getInt();
@@ -588,14 +595,16 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveForce
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveForce") == 0) {
+	case kScNameRemoveForce: {
 		stack->correctParams(1);
 		const char *forceName = stack->pop()->getString();
 
 		stack->pushBool(DID_SUCCEED(removeForce(forceName)));
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -604,38 +613,39 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("particle-emitter");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "X") {
+	case kScNameX: {
 		_scValue->setInt(_posX);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Y") {
+	case kScNameY: {
 		_scValue->setInt(_posY);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	case kScNameWidth: {
 		_scValue->setInt(_width);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	case kScNameHeight: {
 		_scValue->setInt(_height);
 		return _scValue;
 	}
@@ -643,21 +653,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale1") {
+	case kScNameScale1: {
 		_scValue->setFloat(_scale1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Scale2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale2") {
+	case kScNameScale2: {
 		_scValue->setFloat(_scale2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScaleZBased") {
+	case kScNameScaleZBased: {
 		_scValue->setBool(_scaleZBased);
 		return _scValue;
 	}
@@ -665,21 +675,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Velocity1") {
+	case kScNameVelocity1: {
 		_scValue->setFloat(_velocity1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Velocity2") {
+	case kScNameVelocity2: {
 		_scValue->setFloat(_velocity2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// VelocityZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VelocityZBased") {
+	case kScNameVelocityZBased: {
 		_scValue->setBool(_velocityZBased);
 		return _scValue;
 	}
@@ -687,21 +697,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LifeTime1") {
+	case kScNameLifeTime1: {
 		_scValue->setInt(_lifeTime1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LifeTime2") {
+	case kScNameLifeTime2: {
 		_scValue->setInt(_lifeTime2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTimeZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LifeTimeZBased") {
+	case kScNameLifeTimeZBased: {
 		_scValue->setBool(_lifeTimeZBased);
 		return _scValue;
 	}
@@ -709,14 +719,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Angle1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Angle1") {
+	case kScNameAngle1: {
 		_scValue->setInt(_angle1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Angle2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Angle2") {
+	case kScNameAngle2: {
 		_scValue->setInt(_angle2);
 		return _scValue;
 	}
@@ -724,14 +734,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AngVelocity1") {
+	case kScNameAngVelocity1: {
 		_scValue->setFloat(_angVelocity1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AngVelocity2") {
+	case kScNameAngVelocity2: {
 		_scValue->setFloat(_angVelocity2);
 		return _scValue;
 	}
@@ -739,14 +749,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotation1") {
+	case kScNameRotation1: {
 		_scValue->setFloat(_rotation1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotation2") {
+	case kScNameRotation2: {
 		_scValue->setFloat(_rotation2);
 		return _scValue;
 	}
@@ -754,21 +764,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Alpha1") {
+	case kScNameAlpha1: {
 		_scValue->setInt(_alpha1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Alpha2") {
+	case kScNameAlpha2: {
 		_scValue->setInt(_alpha2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaTimeBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaTimeBased") {
+	case kScNameAlphaTimeBased: {
 		_scValue->setBool(_alphaTimeBased);
 		return _scValue;
 	}
@@ -776,42 +786,36 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxParticles
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxParticles") {
+	case kScNameMaxParticles: {
 		_scValue->setInt(_maxParticles);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// NumLiveParticles (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumLiveParticles") {
-		int numAlive = 0;
-		for (uint32 i = 0; i < _particles.size(); i++) {
-			if (_particles[i] && !_particles[i]->_isDead) {
-				numAlive++;
-			}
-		}
-		_scValue->setInt(numAlive);
+	case kScNameNumLiveParticles: {
+		_scValue->setInt(_particles.getNumLive());
 		return _scValue;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationInterval
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GenerationInterval") {
+	case kScNameGenerationInterval: {
 		_scValue->setInt(_genInterval);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GenerationAmount") {
+	case kScNameGenerationAmount: {
 		_scValue->setInt(_genAmount);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// MaxBatches
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxBatches") {
+	case kScNameMaxBatches: {
 		_scValue->setInt(_maxBatches);
 		return _scValue;
 	}
@@ -819,14 +823,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeInTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FadeInTime") {
+	case kScNameFadeInTime: {
 		_scValue->setInt(_fadeInTime);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOutTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FadeOutTime") {
+	case kScNameFadeOutTime: {
 		_scValue->setInt(_fadeOutTime);
 		return _scValue;
 	}
@@ -834,21 +838,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GrowthRate1") {
+	case kScNameGrowthRate1: {
 		_scValue->setFloat(_growthRate1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GrowthRate2") {
+	case kScNameGrowthRate2: {
 		_scValue->setFloat(_growthRate2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ExponentialGrowth
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ExponentialGrowth") {
+	case kScNameExponentialGrowth: {
 		_scValue->setBool(_exponentialGrowth);
 		return _scValue;
 	}
@@ -856,7 +860,7 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// UseRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "UseRegion") {
+	case kScNameUseRegion: {
 		_scValue->setBool(_useRegion);
 		return _scValue;
 	}
@@ -864,14 +868,16 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// EmitEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "EmitEvent") {
+	case kScNameEmitEvent: {
 		if (!_emitEvent) {
 			_scValue->setNULL();
 		} else {
 			_scValue->setString(_emitEvent);
 		}
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -879,31 +885,32 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "X") == 0) {
+	case kScNameX: {
 		_posX = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Y") == 0) {
+	case kScNameY: {
 		_posY = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Width") == 0) {
+	case kScNameWidth: {
 		_width = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Height") == 0) {
+	case kScNameHeight: {
 		_height = value->getInt();
 		return STATUS_OK;
 	}
@@ -911,21 +918,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale1") == 0) {
+	case kScNameScale1: {
 		_scale1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Scale2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale2") == 0) {
+	case kScNameScale2: {
 		_scale2 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScaleZBased") == 0) {
+	case kScNameScaleZBased: {
 		_scaleZBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -933,21 +940,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Velocity1") == 0) {
+	case kScNameVelocity1: {
 		_velocity1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Velocity2") == 0) {
+	case kScNameVelocity2: {
 		_velocity2 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// VelocityZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "VelocityZBased") == 0) {
+	case kScNameVelocityZBased: {
 		_velocityZBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -955,21 +962,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LifeTime1") == 0) {
+	case kScNameLifeTime1: {
 		_lifeTime1 = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LifeTime2") == 0) {
+	case kScNameLifeTime2: {
 		_lifeTime2 = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTimeZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LifeTimeZBased") == 0) {
+	case kScNameLifeTimeZBased: {
 		_lifeTimeZBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -977,14 +984,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Angle1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Angle1") == 0) {
+	case kScNameAngle1: {
 		_angle1 = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Angle2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Angle2") == 0) {
+	case kScNameAngle2: {
 		_angle2 = value->getInt();
 		return STATUS_OK;
 	}
@@ -992,14 +999,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AngVelocity1") == 0) {
+	case kScNameAngVelocity1: {
 		_angVelocity1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AngVelocity2") == 0) {
+	case kScNameAngVelocity2: {
 		_angVelocity2 = value->getFloat();
 		return STATUS_OK;
 	}
@@ -1007,14 +1014,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotation1") == 0) {
+	case kScNameRotation1: {
 		_rotation1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotation2") == 0) {
+	case kScNameRotation2: {
 		_rotation2 = value->getFloat();
 		return STATUS_OK;
 	}
@@ -1022,7 +1029,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Alpha1") == 0) {
+	case kScNameAlpha1: {
 		_alpha1 = value->getInt();
 		if (_alpha1 < 0) {
 			_alpha1 = 0;
@@ -1035,7 +1042,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Alpha2") == 0) {
+	case kScNameAlpha2: {
 		_alpha2 = value->getInt();
 		if (_alpha2 < 0) {
 			_alpha2 = 0;
@@ -1048,7 +1055,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaTimeBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AlphaTimeBased") == 0) {
+	case kScNameAlphaTimeBased: {
 		_alphaTimeBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -1056,7 +1063,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxParticles
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxParticles") == 0) {
+	case kScNameMaxParticles: {
 		_maxParticles = value->getInt();
 		return STATUS_OK;
 	}
@@ -1064,21 +1071,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationInterval
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GenerationInterval") == 0) {
+	case kScNameGenerationInterval: {
 		_genInterval = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GenerationAmount") == 0) {
+	case kScNameGenerationAmount: {
 		_genAmount = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// MaxBatches
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxBatches") == 0) {
+	case kScNameMaxBatches: {
 		_maxBatches = value->getInt();
 		return STATUS_OK;
 	}
@@ -1086,14 +1093,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeInTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeInTime") == 0) {
+	case kScNameFadeInTime: {
 		_fadeInTime = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOutTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOutTime") == 0) {
+	case kScNameFadeOutTime: {
 		_fadeOutTime = value->getInt();
 		return STATUS_OK;
 	}
@@ -1101,21 +1108,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GrowthRate1") == 0) {
+	case kScNameGrowthRate1: {
 		_growthRate1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GrowthRate2") == 0) {
+	case kScNameGrowthRate2: {
 		_growthRate2 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ExponentialGrowth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ExponentialGrowth") == 0) {
+	case kScNameExponentialGrowth: {
 		_exponentialGrowth = value->getBool();
 		return STATUS_OK;
 	}
@@ -1123,7 +1130,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// UseRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UseRegion") == 0) {
+	case kScNameUseRegion: {
 		_useRegion = value->getBool();
 		return STATUS_OK;
 	}
@@ -1131,14 +1138,16 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// EmitEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EmitEvent") == 0) {
+	case kScNameEmitEvent: {
 		delete[] _emitEvent;
 		_emitEvent = NULL;
 		if (!value->isNULL()) {
 			BaseUtils::setString(&_emitEvent, value->getString());
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -1232,21 +1241,7 @@ bool PartEmitter::persist(BasePersistenceManager *persistMgr) {
 		}
 	}
 
-	uint32 numParticles;
-	if (persistMgr->getIsSaving()) {
-		numParticles = _particles.size();
-		persistMgr->transfer(TMEMBER(numParticles));
-		for (uint32 i = 0; i < _particles.size(); i++) {
-			_particles[i]->persist(persistMgr);
-		}
-	} else {
-		persistMgr->transfer(TMEMBER(numParticles));
-		for (uint32 i = 0; i < numParticles; i++) {
-			PartParticle *particle = new PartParticle(_gameRef);
-			particle->persist(persistMgr);
-			_particles.add(particle);
-		}
-	}
+	_particles.persist(_gameRef, persistMgr);
 
 	return STATUS_OK;
 }
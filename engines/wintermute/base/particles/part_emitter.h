@@ -32,10 +32,10 @@
 
 #include "engines/wintermute/base/base_object.h"
 #include "engines/wintermute/base/particles/part_force.h"
+#include "engines/wintermute/base/particles/part_particle_store.h"
 
 namespace Wintermute {
 class BaseRegion;
-class PartParticle;
 class PartEmitter : public BaseObject {
 public:
 	DECLARE_PERSISTENT(PartEmitter, BaseObject)
@@ -62,6 +62,14 @@ public:
 
 	BaseArray<PartForce *> _forces;
 
+	/**
+	 * Run a snow-like emitter of the given sprite without drawing it.
+	 * @param liveParticles	set to the average number of live particles
+	 * @param updatesPerMs	set to the particle updates per millisecond
+	 * @return false if the sprite couldn't be loaded
+	 */
+	static bool benchmark(BaseGame *game, const Common::String &spriteFilename, uint32 &liveParticles, uint32 &updatesPerMs);
+
 	// scripting interface
 	virtual ScValue *scGetProperty(const Common::String &name);
 	virtual bool scSetProperty(const char *name, ScValue *value);
@@ -127,11 +135,10 @@ private:
 	BaseScriptHolder *_owner;
 
 	PartForce *addForceByName(const Common::String &name);
-	bool static compareZ(const PartParticle *p1, const PartParticle *p2);
-	bool initParticle(PartParticle *particle, uint32 currentTime, uint32 timerDelta);
+	bool initParticle(uint32 currentTime, uint32 timerDelta);
 	bool updateInternal(uint32 currentTime, uint32 timerDelta);
 	uint32 _lastGenTime;
-	BaseArray<PartParticle *> _particles;
+	PartParticleStore _particles;
 	BaseArray<char *> _sprites;
 };
 
@@ -0,0 +1,443 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * This file is based on WME Lite.
+ * http://dead-code.org/redir.php?target=wmelite
+ * Copyright (c) 2011 Jan Nedoma
+ */
+
+#include "engines/wintermute/base/particles/part_particle_store.h"
+#include "engines/wintermute/base/particles/part_emitter.h"
+#include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/base/base_region.h"
+#include "engines/wintermute/math/vector2.h"
+#include "engines/wintermute/utils/utils.h"
+#include "engines/wintermute/platform_osystem.h"
+#include "common/algorithm.h"
+#include "common/str.h"
+#include <math.h>
+
+namespace Wintermute {
+
+//////////////////////////////////////////////////////////////////////////
+PartParticleStore::PartParticleStore() : _firstDead(0), _numDead(0) {
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+PartParticleStore::~PartParticleStore() {
+	clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint32 PartParticleStore::addSlot() {
+	Rect32 border;
+	BasePlatform::setRectEmpty(&border);
+
+	_posX.push_back(0.0f);
+	_posY.push_back(0.0f);
+	_posZ.push_back(0.0f);
+	_velX.push_back(0.0f);
+	_velY.push_back(0.0f);
+	_scale.push_back(100.0f);
+	_rotation.push_back(0.0f);
+	_angVelocity.push_back(0.0f);
+	_growthRate.push_back(0.0f);
+	_exponentialGrowth.push_back(false);
+	_alpha1.push_back(255);
+	_alpha2.push_back(255);
+	_border.push_back(border);
+	_creationTime.push_back(0);
+	_lifeTime.push_back(0);
+	_sprite.push_back(NULL);
+	_isDead.push_back(false);
+	_state.push_back(PARTICLE_NORMAL);
+	_fadeStart.push_back(0);
+	_fadeTime.push_back(0);
+	_currentAlpha.push_back(255);
+	_fadeStartAlpha.push_back(255);
+	_moving.push_back(false);
+	_step.push_back(0.0f);
+
+	uint32 slot = _order.size();
+	_order.push_back(slot);
+	_orderPos.push_back(slot);
+	return slot;
+}
+
+//////////////////////////////////////////////////////////////////////////
+uint32 PartParticleStore::allocate() {
+	if (_numDead == 0) {
+		return addSlot();
+	}
+
+	while (!_isDead[_order[_firstDead]]) {
+		_firstDead++;
+	}
+
+	uint32 slot = _order[_firstDead++];
+	_isDead[slot] = false;
+	_numDead--;
+	return slot;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::kill(uint32 slot) {
+	if (!_isDead[slot]) {
+		_isDead[slot] = true;
+		_numDead++;
+		_firstDead = MIN(_firstDead, _orderPos[slot]);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::killAll() {
+	for (uint32 i = 0; i < size(); i++) {
+		kill(i);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::clear() {
+	for (uint32 i = 0; i < _sprite.size(); i++) {
+		delete _sprite[i];
+	}
+
+	_posX.clear();
+	_posY.clear();
+	_posZ.clear();
+	_velX.clear();
+	_velY.clear();
+	_scale.clear();
+	_rotation.clear();
+	_angVelocity.clear();
+	_growthRate.clear();
+	_exponentialGrowth.clear();
+	_alpha1.clear();
+	_alpha2.clear();
+	_border.clear();
+	_creationTime.clear();
+	_lifeTime.clear();
+	_sprite.clear();
+	_isDead.clear();
+	_state.clear();
+	_fadeStart.clear();
+	_fadeTime.clear();
+	_currentAlpha.clear();
+	_fadeStartAlpha.clear();
+	_moving.clear();
+	_step.clear();
+	_order.clear();
+	_orderPos.clear();
+	_firstDead = 0;
+	_numDead = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool PartParticleStore::setSprite(BaseGame *gameRef, uint32 slot, const Common::String &filename) {
+	BaseSprite *&sprite = _sprite[slot];
+	if (sprite && sprite->getFilename() && scumm_stricmp(filename.c_str(), sprite->getFilename()) == 0) {
+		sprite->reset();
+		return STATUS_OK;
+	}
+
+	delete sprite;
+	sprite = NULL;
+
+	SystemClassRegistry::getInstance()->_disabled = true;
+	sprite = new BaseSprite(gameRef, (BaseObject*)gameRef);
+	if (sprite && DID_SUCCEED(sprite->loadFile(filename))) {
+		SystemClassRegistry::getInstance()->_disabled = false;
+		return STATUS_OK;
+	} else {
+		delete sprite;
+		sprite = NULL;
+		SystemClassRegistry::getInstance()->_disabled = false;
+		return STATUS_FAILED;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::update(PartEmitter *emitter, uint32 currentTime, uint32 timerDelta) {
+	const uint32 count = size();
+	const float elapsedTime = (float)timerDelta / 1000.f;
+
+	// Fading, dying and alpha first, this decides which particles move
+	for (uint32 i = 0; i < count; i++) {
+		_moving[i] = false;
+		_step[i] = 0.0f;
+		if (_isDead[i]) {
+			continue;
+		}
+
+		if (_state[i] == PARTICLE_FADEIN) {
+			if (currentTime - _fadeStart[i] >= (uint32)_fadeTime[i]) {
+				_state[i] = PARTICLE_NORMAL;
+				_currentAlpha[i] = _alpha1[i];
+			} else {
+				_currentAlpha[i] = (int)(((float)currentTime - (float)_fadeStart[i]) / (float)_fadeTime[i] * _alpha1[i]);
+			}
+			continue;
+		} else if (_state[i] == PARTICLE_FADEOUT) {
+			if (currentTime - _fadeStart[i] >= (uint32)_fadeTime[i]) {
+				kill(i);
+			} else {
+				_currentAlpha[i] = _fadeStartAlpha[i] - (int)(((float)currentTime - (float)_fadeStart[i]) / (float)_fadeTime[i] * _fadeStartAlpha[i]);
+			}
+			continue;
+		}
+
+		// time is up
+		if (_lifeTime[i] > 0) {
+			if (currentTime - _creationTime[i] >= (uint32)_lifeTime[i]) {
+				if (emitter->_fadeOutTime > 0) {
+					fadeOut(i, currentTime, emitter->_fadeOutTime);
+				} else {
+					kill(i);
+				}
+			}
+		}
+
+		// particle hit the border
+		if (!_isDead[i] && !BasePlatform::isRectEmpty(&_border[i])) {
+			Point32 p;
+			p.x = (int32)_posX[i];
+			p.y = (int32)_posY[i];
+			if (!BasePlatform::ptInRect(&_border[i], p)) {
+				fadeOut(i, currentTime, emitter->_fadeOutTime);
+			}
+		}
+		if (_isDead[i] || _state[i] != PARTICLE_NORMAL) {
+			continue;
+		}
+
+		// update alpha
+		if (_lifeTime[i] > 0) {
+			int age = (int)(currentTime - _creationTime[i]);
+			int alphaDelta = (int)(_alpha2[i] - _alpha1[i]);
+
+			_currentAlpha[i] = _alpha1[i] + (int)(((float)alphaDelta / (float)_lifeTime[i] * (float)age));
+		}
+
+		_moving[i] = true;
+		_step[i] = elapsedTime;
+	}
+
+	// update velocity, particles that don't move have a step of 0
+	float *posX = _posX.begin();
+	float *posY = _posY.begin();
+	float *velX = _velX.begin();
+	float *velY = _velY.begin();
+	const float *step = _step.begin();
+
+	for (uint32 f = 0; f < emitter->_forces.size(); f++) {
+		const PartForce *force = emitter->_forces[f];
+		const float dirX = force->_direction.x;
+		const float dirY = force->_direction.y;
+
+		switch (force->_type) {
+		case PartForce::FORCE_GLOBAL:
+			for (uint32 i = 0; i < count; i++) {
+				velX[i] += dirX * step[i];
+				velY[i] += dirY * step[i];
+			}
+			break;
+
+		case PartForce::FORCE_POINT:
+			for (uint32 i = 0; i < count; i++) {
+				if (!_moving[i]) {
+					continue;
+				}
+				float distX = force->_pos.x - posX[i];
+				float distY = force->_pos.y - posY[i];
+				float dist = 100.0f / sqrt(distX * distX + distY * distY);
+
+				velX[i] += dirX * dist * step[i];
+				velY[i] += dirY * dist * step[i];
+			}
+			break;
+		}
+	}
+
+	// update position
+	for (uint32 i = 0; i < count; i++) {
+		posX[i] += velX[i] * step[i];
+		posY[i] += velY[i] * step[i];
+	}
+
+	// update rotation and scale
+	for (uint32 i = 0; i < count; i++) {
+		if (!_moving[i]) {
+			continue;
+		}
+
+		_rotation[i] = BaseUtils::normalizeAngle(_rotation[i] + _angVelocity[i] * step[i]);
+
+		if (_exponentialGrowth[i]) {
+			_scale[i] += _scale[i] / 100.0f * _growthRate[i] * step[i];
+		} else {
+			_scale[i] += _growthRate[i] * step[i];
+		}
+
+		if (_scale[i] <= 0.0f) {
+			kill(i);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool PartParticleStore::display(PartEmitter *emitter, BaseRegion *region) {
+	for (uint32 i = 0; i < _order.size(); i++) {
+		uint32 slot = _order[i];
+		if (_isDead[slot] || !_sprite[slot]) {
+			continue;
+		}
+
+		int x = (int)_posX[slot];
+		int y = (int)_posY[slot];
+		if (region && !region->pointInRegion(x, y)) {
+			continue;
+		}
+
+		_sprite[slot]->getCurrentFrame();
+		_sprite[slot]->display(x, y,
+		                       NULL,
+		                       _scale[slot], _scale[slot],
+		                       BYTETORGBA(255, 255, 255, _currentAlpha[slot]),
+		                       _rotation[slot],
+		                       emitter->_blendMode);
+	}
+
+	return STATUS_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////
+struct PartParticleCompareZ {
+	const float *_posZ;
+
+	PartParticleCompareZ(const float *posZ) : _posZ(posZ) {}
+
+	bool operator()(uint32 slot1, uint32 slot2) const {
+		return _posZ[slot1] < _posZ[slot2];
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::sortByZ() {
+	Common::sort(_order.begin(), _order.end(), PartParticleCompareZ(_posZ.begin()));
+
+	for (uint32 i = 0; i < _order.size(); i++) {
+		_orderPos[_order[i]] = i;
+	}
+	_firstDead = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::fadeIn(uint32 slot, uint32 currentTime, int fadeTime) {
+	_currentAlpha[slot] = 0;
+	_fadeStart[slot] = currentTime;
+	_fadeTime[slot] = fadeTime;
+	_state[slot] = PARTICLE_FADEIN;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartParticleStore::fadeOut(uint32 slot, uint32 currentTime, int fadeTime) {
+	_fadeStartAlpha[slot] = _currentAlpha[slot];
+	_fadeStart[slot] = currentTime;
+	_fadeTime[slot] = fadeTime;
+	_state[slot] = PARTICLE_FADEOUT;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool PartParticleStore::persist(BaseGame *gameRef, BasePersistenceManager *persistMgr) {
+	// Same layout as when each particle was an object of its own,
+	// saved in drawing order
+	uint32 numParticles;
+	if (persistMgr->getIsSaving()) {
+		numParticles = _order.size();
+		persistMgr->transfer(TMEMBER(numParticles));
+		for (uint32 i = 0; i < _order.size(); i++) {
+			persistSlot(gameRef, persistMgr, _order[i]);
+		}
+	} else {
+		clear();
+		persistMgr->transfer(TMEMBER(numParticles));
+		for (uint32 i = 0; i < numParticles; i++) {
+			uint32 slot = addSlot();
+			persistSlot(gameRef, persistMgr, slot);
+			if (_isDead[slot]) {
+				_numDead++;
+			}
+		}
+	}
+
+	return STATUS_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool PartParticleStore::persistSlot(BaseGame *gameRef, BasePersistenceManager *persistMgr, uint32 slot) {
+	Vector2 pos(_posX[slot], _posY[slot]);
+	Vector2 velocity(_velX[slot], _velY[slot]);
+
+	persistMgr->transfer("_alpha1", &_alpha1[slot]);
+	persistMgr->transfer("_alpha2", &_alpha2[slot]);
+	persistMgr->transfer("_border", &_border[slot]);
+	persistMgr->transfer(TMEMBER(pos));
+	persistMgr->transfer("_posZ", &_posZ[slot]);
+	persistMgr->transfer(TMEMBER(velocity));
+	persistMgr->transfer("_scale", &_scale[slot]);
+	persistMgr->transfer("_creationTime", &_creationTime[slot]);
+	persistMgr->transfer("_lifeTime", &_lifeTime[slot]);
+	persistMgr->transfer("_isDead", &_isDead[slot]);
+	persistMgr->transfer("_state", &_state[slot]);
+	persistMgr->transfer("_fadeStart", &_fadeStart[slot]);
+	persistMgr->transfer("_fadeTime", &_fadeTime[slot]);
+	persistMgr->transfer("_currentAlpha", &_currentAlpha[slot]);
+	persistMgr->transfer("_angVelocity", &_angVelocity[slot]);
+	persistMgr->transfer("_rotation", &_rotation[slot]);
+	persistMgr->transfer("_growthRate", &_growthRate[slot]);
+	persistMgr->transfer("_exponentialGrowth", &_exponentialGrowth[slot]);
+	persistMgr->transfer("_fadeStartAlpha", &_fadeStartAlpha[slot]);
+
+	if (persistMgr->getIsSaving()) {
+		const char *filename = _sprite[slot] ? _sprite[slot]->getFilename() : NULL;
+		persistMgr->transfer(TMEMBER(filename));
+	} else {
+		_posX[slot] = pos.x;
+		_posY[slot] = pos.y;
+		_velX[slot] = velocity.x;
+		_velY[slot] = velocity.y;
+
+		char *filename;
+		persistMgr->transfer(TMEMBER(filename));
+		if (filename) {
+			setSprite(gameRef, slot, filename);
+		}
+		delete[] filename;
+		filename = NULL;
+	}
+
+	return STATUS_OK;
+}
+
+} // end of namespace Wintermute
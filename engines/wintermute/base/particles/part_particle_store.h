@@ -0,0 +1,125 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * This file is based on WME Lite.
+ * http://dead-code.org/redir.php?target=wmelite
+ * Copyright (c) 2011 Jan Nedoma
+ */
+
+#ifndef WINTERMUTE_PARTPARTICLESTORE_H
+#define WINTERMUTE_PARTPARTICLESTORE_H
+
+
+#include "engines/wintermute/base/base.h"
+#include "engines/wintermute/math/rect32.h"
+#include "common/array.h"
+
+namespace Wintermute {
+
+class BaseGame;
+class PartEmitter;
+class BaseSprite;
+class BaseRegion;
+class BasePersistenceManager;
+
+/**
+ * The particles of one emitter.
+ *
+ * Every particle property is kept in an array of its own, indexed by slot,
+ * so the per-frame update runs through plain float arrays which the compiler
+ * can vectorize. Slots of dead particles are handed out again by
+ * allocate(), together with their sprite.
+ */
+class PartParticleStore {
+public:
+	enum TParticleState {
+	    PARTICLE_NORMAL, PARTICLE_FADEIN, PARTICLE_FADEOUT
+	};
+
+	PartParticleStore();
+	~PartParticleStore();
+
+	uint32 size() const { return _isDead.size(); }
+	uint32 getNumLive() const { return _isDead.size() - _numDead; }
+
+	/**
+	 * Get a slot for a new particle. Like before the particles were kept in
+	 * arrays, the first dead particle in drawing order is reused if there
+	 * is one.
+	 */
+	uint32 allocate();
+	void kill(uint32 slot);
+	void killAll();
+	void clear();
+
+	void update(PartEmitter *emitter, uint32 currentTime, uint32 timerDelta);
+	bool display(PartEmitter *emitter, BaseRegion *region);
+	void sortByZ();
+
+	bool setSprite(BaseGame *gameRef, uint32 slot, const Common::String &filename);
+	void fadeIn(uint32 slot, uint32 currentTime, int fadeTime);
+	void fadeOut(uint32 slot, uint32 currentTime, int fadeTime);
+
+	bool persist(BaseGame *gameRef, BasePersistenceManager *persistMgr);
+
+	Common::Array<float> _posX;
+	Common::Array<float> _posY;
+	Common::Array<float> _posZ;
+	Common::Array<float> _velX;
+	Common::Array<float> _velY;
+	Common::Array<float> _scale;
+	Common::Array<float> _rotation;
+	Common::Array<float> _angVelocity;
+	Common::Array<float> _growthRate;
+	Common::Array<bool> _exponentialGrowth;
+	Common::Array<int> _alpha1;
+	Common::Array<int> _alpha2;
+	Common::Array<Rect32> _border;
+	Common::Array<uint32> _creationTime;
+	Common::Array<int> _lifeTime;
+private:
+	Common::Array<BaseSprite *> _sprite;
+	Common::Array<bool> _isDead;
+	Common::Array<int> _state;
+	Common::Array<uint32> _fadeStart;
+	Common::Array<int> _fadeTime;
+	Common::Array<int> _currentAlpha;
+	Common::Array<int> _fadeStartAlpha;
+
+	// Whether the particle moves in the current update, and for how long
+	Common::Array<bool> _moving;
+	Common::Array<float> _step;
+	// Slots in drawing order, and the position of each slot in it
+	Common::Array<uint32> _order;
+	Common::Array<uint32> _orderPos;
+	// No dead particle comes before this position in _order
+	uint32 _firstDead;
+	uint32 _numDead;
+
+	uint32 addSlot();
+	bool persistSlot(BaseGame *gameRef, BasePersistenceManager *persistMgr, uint32 slot);
+};
+
+} // end of namespace Wintermute
+
+#endif
@@ -93,12 +93,12 @@ bool SaveLoad::saveGame(int slot, const char *desc, bool quickSave, BaseGame *ga
 	bool ret;
 
 	BasePersistenceManager *pm = new BasePersistenceManager();
-	if (DID_SUCCEED(ret = pm->initSave(desc))) {
+	if (DID_SUCCEED(ret = pm->initSave(filename, desc))) {
 		gameRef->_renderer->initSaveLoad(true, quickSave); // TODO: The original code inited the indicator before the conditionals
 		if (DID_SUCCEED(ret = SystemClassRegistry::getInstance()->saveTable(gameRef,  pm, quickSave))) {
 			if (DID_SUCCEED(ret = SystemClassRegistry::getInstance()->saveInstances(gameRef,  pm, quickSave))) {
 				pm->putDWORD(BaseEngine::instance().getRandomSource()->getSeed());
-				if (DID_SUCCEED(ret = pm->saveFile(filename))) {
+				if (DID_SUCCEED(ret = pm->finishSave())) {
 					ConfMan.setInt("most_recent_saveslot", slot);
 				}
 			}
@@ -41,6 +41,7 @@ IMPLEMENT_PERSISTENT(ScScript, false)
 ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 	_buffer = NULL;
 	_bufferSize = _iP = 0;
+	_programIndex = 0;
 	_scriptStream = NULL;
 	_filename = NULL;
 	_currentLine = 0;
@@ -235,7 +236,7 @@ bool ScScript::initTables() {
 
 
 //////////////////////////////////////////////////////////////////////////
-bool ScScript::create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner) {
+bool ScScript::create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner, ScProgramPtr program) {
 	cleanup();
 
 	_thread = false;
@@ -263,6 +264,14 @@ bool ScScript::create(const char *filename, byte *buffer, uint32 size, BaseScrip
 		return res;
 	}
 
+	// scripts from the cache come with their code decoded already
+	if (!program) {
+		program = ScProgramPtr(new ScProgram(_buffer, _bufferSize));
+	}
+	if (program->isValid()) {
+		_program = program;
+	}
+
 	// establish global variables table
 	_globals = new ScValue(_gameRef);
 
@@ -306,6 +315,7 @@ bool ScScript::createThread(ScScript *original, uint32 initIP, const Common::Str
 
 	// copy globals
 	_globals = original->_globals;
+	_program = original->_program;
 
 	// skip to the beginning of the event
 	_iP = initIP;
@@ -363,6 +373,7 @@ bool ScScript::createMethodThread(ScScript *original, const Common::String &meth
 
 	// copy globals
 	_globals = original->_globals;
+	_program = original->_program;
 
 	// skip to the beginning of the event
 	_iP = ip;
@@ -385,6 +396,9 @@ void ScScript::cleanup() {
 	}
 	_buffer = NULL;
 
+	_program.reset();
+	_programIndex = 0;
+
 	if (_filename) {
 		delete[] _filename;
 	}
@@ -506,11 +520,37 @@ char *ScScript::getString() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+const ScProgram::Instruction *ScScript::fetchInstruction(ScProgram::Instruction &rawInstr) {
+	if (_program) {
+		// Anything but running on or jumping within the decoded code
+		// (returns, threads, loaded games) needs to look the position up
+		if (_programIndex >= _program->size() || (*_program)[_programIndex].offset != _iP) {
+			int32 index = _program->findInstruction(_iP);
+			_programIndex = index >= 0 ? index : _program->size();
+		}
+		if (_programIndex < _program->size()) {
+			return &(*_program)[_programIndex++];
+		}
+	}
+
+	// Not decoded, read it from the byte code
+	if (!ScProgram::decodeInstruction(_buffer, _bufferSize, _iP, rawInstr)) {
+		return NULL;
+	}
+	if (ScProgram::hasSymbolOperand(rawInstr.inst)) {
+		_rawSymbol = _symbols[rawInstr.dw];
+		rawInstr.str = _symbols[rawInstr.dw];
+		rawInstr.key = &_rawSymbol;
+	}
+	return &rawInstr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::executeInstruction() {
 	bool ret = STATUS_OK;
 
-	uint32 dw;
 	const char *str = NULL;
 
 	//ScValue* op = new ScValue(_gameRef);
@@ -519,28 +559,34 @@ bool ScScript::executeInstruction() {
 	ScValue *op1;
 	ScValue *op2;
 
-	uint32 inst = getDWORD();
+	ScProgram::Instruction rawInstr;
+	const ScProgram::Instruction *instr = fetchInstruction(rawInstr);
+	if (!instr) {
+		_gameRef->LOG(0, "Fatal: Truncated instruction ('%s', line %d, IP:0x%x)\n", _filename, _currentLine, _iP);
+		_state = SCRIPT_FINISHED;
+		return STATUS_FAILED;
+	}
+	_iP = instr->next;
+
+	uint32 inst = instr->inst;
 	switch (inst) {
 
 	case II_DEF_VAR:
 		_operand->setNULL();
-		dw = getDWORD();
 		if (_scopeStack->_sP < 0) {
-			_globals->setProp(_symbols[dw], _operand);
+			_globals->setProp(instr->str, _operand);
 		} else {
-			_scopeStack->getTop()->setProp(_symbols[dw], _operand);
+			_scopeStack->getTop()->setProp(instr->str, _operand);
 		}
 
 		break;
 
 	case II_DEF_GLOB_VAR:
 	case II_DEF_CONST_VAR: {
-		dw = getDWORD();
-		/*      char *temp = _symbols[dw]; // TODO delete */
 		// only create global var if it doesn't exist
-		if (!_engine->_globals->propExists(_symbols[dw])) {
+		if (!_engine->_globals->propExists(instr->str)) {
 			_operand->setNULL();
-			_engine->_globals->setProp(_symbols[dw], _operand, false, inst == II_DEF_CONST_VAR);
+			_engine->_globals->setProp(instr->str, _operand, false, inst == II_DEF_CONST_VAR);
 		}
 		break;
 	}
@@ -569,12 +615,11 @@ bool ScScript::executeInstruction() {
 
 
 	case II_CALL:
-		dw = getDWORD();
-
 		_operand->setInt(_iP);
 		_callStack->push(_operand);
 
-		_iP = dw;
+		_iP = instr->dw;
+		_programIndex = instr->target;
 
 		break;
 
@@ -659,13 +704,11 @@ bool ScScript::executeInstruction() {
 	break;
 
 	case II_EXTERNAL_CALL: {
-		uint32 symbolIndex = getDWORD();
-
-		TExternalFunction *f = getExternal(_symbols[symbolIndex]);
+		TExternalFunction *f = getExternal(_symbols[instr->dw]);
 		if (f) {
 			externalCall(_stack, _thisStack, f);
 		} else {
-			_gameRef->externalCall(this, _stack, _thisStack, _symbols[symbolIndex]);
+			_gameRef->externalCall(this, _stack, _thisStack, _symbols[instr->dw]);
 		}
 
 		break;
@@ -676,8 +719,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_CORRECT_STACK:
-		dw = getDWORD(); // params expected
-		_stack->correctParams(dw);
+		_stack->correctParams(instr->dw); // params expected
 		break;
 
 	case II_CREATE_OBJECT:
@@ -690,7 +732,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(*instr->key);
 		if (false && /*var->_type==VAL_OBJECT ||*/ var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
 			_stack->push(_operand);
@@ -701,15 +743,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(*instr->key);
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVar(*instr->key);
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -735,21 +776,21 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_INT:
-		_stack->pushInt((int)getDWORD());
+		_stack->pushInt((int)instr->dw);
 		break;
 
 	case II_PUSH_FLOAT:
-		_stack->pushFloat(getFloat());
+		_stack->pushFloat(instr->f);
 		break;
 
 
 	case II_PUSH_BOOL:
-		_stack->pushBool(getDWORD() != 0);
+		_stack->pushBool(instr->dw != 0);
 
 		break;
 
 	case II_PUSH_STRING:
-		_stack->pushString(getString());
+		_stack->pushString(instr->str);
 		break;
 
 	case II_PUSH_NULL:
@@ -762,7 +803,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVar(*instr->key));
 		_thisStack->push(_operand);
 		break;
 
@@ -806,18 +847,19 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_JMP:
-		_iP = getDWORD();
+		_iP = instr->dw;
+		_programIndex = instr->target;
 		break;
 
 	case II_JMP_FALSE: {
-		dw = getDWORD();
 		//if (!_stack->pop()->getBool()) _iP = dw;
 		ScValue *val = _stack->pop();
 		if (!val) {
 			runtimeError("Script corruption detected. Did you use '=' instead of '==' for comparison?");
 		} else {
 			if (!val->getBool()) {
-				_iP = dw;
+				_iP = instr->dw;
+				_programIndex = instr->target;
 			}
 		}
 		break;
@@ -1077,7 +1119,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_DBG_LINE: {
-		int newLine = getDWORD();
+		int newLine = instr->dw;
 		if (newLine != _currentLine) {
 			_currentLine = newLine;
 		}
@@ -1085,7 +1127,7 @@ bool ScScript::executeInstruction() {
 
 	}
 	default:
-		_gameRef->LOG(0, "Fatal: Invalid instruction %d ('%s', line %d, IP:0x%x)\n", inst, _filename, _currentLine, _iP - sizeof(uint32));
+		_gameRef->LOG(0, "Fatal: Invalid instruction %d ('%s', line %d, IP:0x%x)\n", inst, _filename, _currentLine, instr->offset);
 		_state = SCRIPT_FINISHED;
 		ret = STATUS_FAILED;
 	} // switch(instruction)
@@ -1119,41 +1161,35 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 
 
 //////////////////////////////////////////////////////////////////////////
-ScValue *ScScript::getVar(char *name) {
+ScValue *ScScript::getVar(const Common::String &name) {
 	ScValue *ret = NULL;
 
 	// scope locals
 	if (_scopeStack->_sP >= 0) {
-		if (_scopeStack->getTop()->propExists(name)) {
-			ret = _scopeStack->getTop()->getProp(name);
-		}
+		ret = _scopeStack->getTop()->findProp(name);
 	}
 
 	// script globals
 	if (ret == NULL) {
-		if (_globals->propExists(name)) {
-			ret = _globals->getProp(name);
-		}
+		ret = _globals->findProp(name);
 	}
 
 	// engine globals
 	if (ret == NULL) {
-		if (_engine->_globals->propExists(name)) {
-			ret = _engine->_globals->getProp(name);
-		}
+		ret = _engine->_globals->findProp(name);
 	}
 
 	if (ret == NULL) {
 		//RuntimeError("Variable '%s' is inaccessible in the current block. Consider changing the script.", name);
-		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", name, _filename, _currentLine);
+		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", name.c_str(), _filename, _currentLine);
 		ScValue *val = new ScValue(_gameRef);
 		ScValue *scope = _scopeStack->getTop();
 		if (scope) {
-			scope->setProp(name, val);
-			ret = _scopeStack->getTop()->getProp(name);
+			scope->setProp(name.c_str(), val);
+			ret = _scopeStack->getTop()->getProp(name.c_str());
 		} else {
-			_globals->setProp(name, val);
-			ret = _globals->getProp(name);
+			_globals->setProp(name.c_str(), val);
+			ret = _globals->getProp(name.c_str());
 		}
 		delete val;
 	}
@@ -1262,6 +1298,11 @@ bool ScScript::persist(BasePersistenceManager *persistMgr) {
 			persistMgr->getBytes(_buffer, _bufferSize);
 			_scriptStream = new Common::MemoryReadStream(_buffer, _bufferSize);
 			initTables();
+
+			ScProgramPtr program(new ScProgram(_buffer, _bufferSize));
+			if (program->isValid()) {
+				_program = program;
+			}
 		} else {
 			_buffer = NULL;
 			_scriptStream = NULL;
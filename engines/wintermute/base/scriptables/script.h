@@ -32,6 +32,7 @@
 
 #include "engines/wintermute/base/base.h"
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
+#include "engines/wintermute/base/scriptables/script_program.h"
 #include "engines/wintermute/coll_templ.h"
 
 namespace Wintermute {
@@ -76,7 +77,7 @@ public:
 	ScScript *_waitScript;
 	TScriptState _state;
 	TScriptState _origState;
-	ScValue *getVar(char *name);
+	ScValue *getVar(const Common::String &name);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -130,12 +131,16 @@ public:
 	uint32 getDWORD();
 	double getFloat();
 	void cleanup();
-	bool create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner);
+	bool create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner, ScProgramPtr program = ScProgramPtr());
 	uint32 _iP;
 private:
 	void readHeader();
+	const ScProgram::Instruction *fetchInstruction(ScProgram::Instruction &rawInstr);
 	uint32 _bufferSize;
 	byte *_buffer;
+	ScProgramPtr _program;
+	uint32 _programIndex;
+	Common::String _rawSymbol;
 public:
 	Common::SeekableReadStream *_scriptStream;
 	ScScript(BaseGame *inGame, ScEngine *engine);
@@ -34,6 +34,8 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
+#include "engines/wintermute/wintermute.h"
+#include "common/algorithm.h"
 
 namespace Wintermute {
 
@@ -136,16 +138,17 @@ void ScEngine::parseElement(void *data, int line, int type, void *elementData) {
 ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
 	byte *compBuffer;
 	uint32 compSize;
+	ScProgramPtr program;
 
 	// get script from cache
-	compBuffer = getCompiledScript(filename, &compSize);
+	compBuffer = getCompiledScript(filename, &compSize, false, &program);
 	if (!compBuffer) {
 		return NULL;
 	}
 
 	// add new script
 	ScScript *script = new ScScript(_gameRef, this);
-	bool ret = script->create(filename, compBuffer, compSize, owner);
+	bool ret = script->create(filename, compBuffer, compSize, owner, program);
 	if (DID_FAIL(ret)) {
 		_gameRef->LOG(ret, "Error running script '%s'...", filename);
 		delete script;
@@ -170,13 +173,16 @@ ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
 
 
 //////////////////////////////////////////////////////////////////////////
-byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache) {
+byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache, ScProgramPtr *outProgram) {
 	// is script in cache?
 	if (!ignoreCache) {
 		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
 			if (_cachedScripts[i] && scumm_stricmp(_cachedScripts[i]->_filename.c_str(), filename) == 0) {
 				_cachedScripts[i]->_timestamp = g_system->getMillis();
 				*outSize = _cachedScripts[i]->_size;
+				if (outProgram) {
+					*outProgram = _cachedScripts[i]->_program;
+				}
 				return _cachedScripts[i]->_buffer;
 			}
 		}
@@ -233,6 +239,13 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 
 		ret = cachedScript->_buffer;
 		*outSize = cachedScript->_size;
+		if (outProgram) {
+			*outProgram = cachedScript->_program;
+		}
+
+		if (!cachedScript->_program->isValid()) {
+			debugC(kWintermuteDebugGeneral, "Script '%s' couldn't be decoded, running its byte code", filename);
+		}
 	}
 
 
@@ -326,12 +339,14 @@ bool ScEngine::tick() {
 		// time sliced script
 		if (_scripts[i]->_timeSlice > 0) {
 			uint32 startTime = g_system->getMillis();
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING && g_system->getMillis() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (_isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 
@@ -343,12 +358,14 @@ bool ScEngine::tick() {
 				startTime = g_system->getMillis();
 			}
 
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 		_currentScript = NULL;
@@ -544,14 +561,16 @@ bool ScEngine::clearGlobals(bool includingNatives) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::addScriptTime(const char *filename, uint32 time) {
+void ScEngine::addScriptTime(const char *filename, uint32 time, uint32 instructions) {
 	if (!_isProfiling) {
 		return;
 	}
 
 	AnsiString fileName = filename;
 	fileName.toLowercase();
-	_scriptTimes[fileName] += time;
+	ScriptTime &scriptTime = _scriptTimes[fileName];
+	scriptTime.time += time;
+	scriptTime.instructions += instructions;
 }
 
 
@@ -581,28 +600,43 @@ void ScEngine::disableProfiling() {
 
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
-
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
-
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
-
-
-	    TimeVector::reverse_iterator tit;
+bool ScEngine::scriptTimeGreater(const ScriptTimeEntry &a, const ScriptTimeEntry &b) {
+	return a.time.time > b.time.time;
+}
 
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+static uint32 getInstructionsPerSecond(uint32 instructions, uint32 time) {
+	if (time == 0) {
+		return 0;
+	}
+	return (uint32)((double)instructions * 1000 / time);
+}
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::dumpStats() {
+	uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+
+	Common::Array<ScriptTimeEntry> times;
+	uint32 scriptTime = 0;
+	uint32 instructions = 0;
+	for (ScriptTimes::const_iterator it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
+		ScriptTimeEntry entry = { it->_key, it->_value };
+		times.push_back(entry);
+		scriptTime += it->_value.time;
+		instructions += it->_value.instructions;
+	}
+	Common::sort(times.begin(), times.end(), scriptTimeGreater);
+
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	_gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	_gameRef->LOG(0, "  %-40s %fs, %d instructions, %d instructions/s", "Total script time", (float)scriptTime / 1000,
+	              instructions, getInstructionsPerSecond(instructions, scriptTime));
+
+	for (uint i = 0; i < times.size(); i++) {
+		const ScriptTime &time = times[i].time;
+		_gameRef->LOG(0, "  %-40s %fs (%f%%), %d instructions, %d instructions/s", times[i].filename.c_str(),
+		              (float)time.time / 1000, (float)time.time / (float)MAX<uint32>(totalTime, 1) * 100,
+		              time.instructions, getInstructionsPerSecond(time.instructions, time.time));
+	}
 }
 
 } // end of namespace Wintermute
@@ -32,6 +32,7 @@
 #include "engines/wintermute/persistent.h"
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/base/base.h"
+#include "engines/wintermute/base/scriptables/script_program.h"
 
 namespace Wintermute {
 
@@ -52,6 +53,7 @@ public:
 			}
 			_size = size;
 			_filename = filename;
+			_program = ScProgramPtr(new ScProgram(buffer, size));
 		};
 
 		~CScCachedScript() {
@@ -64,6 +66,7 @@ public:
 		byte *_buffer;
 		uint32 _size;
 		Common::String _filename;
+		ScProgramPtr _program;
 	};
 
 	class CScBreakpoint {
@@ -93,7 +96,7 @@ public:
 	bool resetObject(BaseObject *Object);
 	bool resetScript(ScScript *script);
 	bool emptyScriptCache();
-	byte *getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache = false);
+	byte *getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache = false, ScProgramPtr *outProgram = NULL);
 	DECLARE_PERSISTENT(ScEngine, BaseClass)
 	bool cleanup();
 	int getNumScripts(int *running = NULL, int *waiting = NULL, int *persistent = NULL);
@@ -116,7 +119,7 @@ public:
 		return _isProfiling;
 	}
 
-	void addScriptTime(const char *filename, uint32 Time);
+	void addScriptTime(const char *filename, uint32 time, uint32 instructions);
 	void dumpStats();
 
 private:
@@ -125,9 +128,19 @@ private:
 	bool _isProfiling;
 	uint32 _profilingStartTime;
 
-	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
+	struct ScriptTime {
+		uint32 time;
+		uint32 instructions;
+	};
+	typedef Common::HashMap<Common::String, ScriptTime> ScriptTimes;
 	ScriptTimes _scriptTimes;
 
+	struct ScriptTimeEntry {
+		Common::String filename;
+		ScriptTime time;
+	};
+	static bool scriptTimeGreater(const ScriptTimeEntry &a, const ScriptTimeEntry &b);
+
 };
 
 } // end of namespace Wintermute
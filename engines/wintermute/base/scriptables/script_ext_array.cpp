@@ -31,6 +31,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/system/sys_instance.h"
 #include "engines/wintermute/base/scriptables/script_ext_array.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -98,10 +99,11 @@ const char *SXArray::scToString() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Push
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Push") == 0) {
+	case kScNamePush: {
 		int numParams = stack->pop()->getInt(0);
 		char paramName[20];
 
@@ -118,7 +120,7 @@ bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Pop
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Pop") == 0) {
+	case kScNamePop: {
 
 		stack->correctParams(0);
 
@@ -133,7 +135,9 @@ bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
@@ -143,10 +147,11 @@ bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *SXArray::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("array");
 		return _scValue;
 	}
@@ -154,15 +159,12 @@ ScValue *SXArray::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Length
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Length") {
+	case kScNameLength: {
 		_scValue->setInt(_length);
 		return _scValue;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// [number]
-	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
 		char paramName[20];
 		if (validNumber(name.c_str(), paramName)) { // TODO: Change to Common::String
 			return _values->getProp(paramName);
@@ -175,10 +177,11 @@ ScValue *SXArray::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXArray::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Length
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Length") == 0) {
+	case kScNameLength: {
 		int origLength = _length;
 		_length = MAX(value->getInt(0), 0);
 
@@ -192,10 +195,7 @@ bool SXArray::scSetProperty(const char *name, ScValue *value) {
 		return STATUS_OK;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// [number]
-	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
 		char paramName[20];
 		if (validNumber(name, paramName)) {
 			int index = atoi(paramName);
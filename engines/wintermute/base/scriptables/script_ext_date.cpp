@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_ext_date.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -74,10 +75,11 @@ const char *SXDate::scToString() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetYear
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetYear") == 0) {
+	case kScNameGetYear: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_year + 1900);
 		return STATUS_OK;
@@ -85,7 +87,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetMonth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMonth") == 0) {
+	case kScNameGetMonth: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_mon + 1);
 		return STATUS_OK;
@@ -93,7 +95,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetDate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDate") == 0) {
+	case kScNameGetDate: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_mday);
 		return STATUS_OK;
@@ -101,7 +103,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHours
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHours") == 0) {
+	case kScNameGetHours: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_hour);
 		return STATUS_OK;
@@ -109,7 +111,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetMinutes
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMinutes") == 0) {
+	case kScNameGetMinutes: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_min);
 		return STATUS_OK;
@@ -117,7 +119,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetSeconds
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSeconds") == 0) {
+	case kScNameGetSeconds: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_sec);
 		return STATUS_OK;
@@ -125,7 +127,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetWeekday
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWeekday") == 0) {
+	case kScNameGetWeekday: {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_wday);
 		return STATUS_OK;
@@ -135,7 +137,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetYear
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetYear") == 0) {
+	case kScNameSetYear: {
 		stack->correctParams(1);
 		_tm.tm_year = stack->pop()->getInt() - 1900;
 		stack->pushNULL();
@@ -144,7 +146,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetMonth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMonth") == 0) {
+	case kScNameSetMonth: {
 		stack->correctParams(1);
 		_tm.tm_mon = stack->pop()->getInt() - 1;
 		stack->pushNULL();
@@ -153,7 +155,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetDate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetDate") == 0) {
+	case kScNameSetDate: {
 		stack->correctParams(1);
 		_tm.tm_mday = stack->pop()->getInt();
 		stack->pushNULL();
@@ -162,7 +164,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetHours
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetHours") == 0) {
+	case kScNameSetHours: {
 		stack->correctParams(1);
 		_tm.tm_hour = stack->pop()->getInt();
 		stack->pushNULL();
@@ -171,7 +173,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetMinutes
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMinutes") == 0) {
+	case kScNameSetMinutes: {
 		stack->correctParams(1);
 		_tm.tm_min = stack->pop()->getInt();
 		stack->pushNULL();
@@ -180,7 +182,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetSeconds
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSeconds") == 0) {
+	case kScNameSetSeconds: {
 		stack->correctParams(1);
 		_tm.tm_sec = stack->pop()->getInt();
 		stack->pushNULL();
@@ -191,12 +193,14 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetCurrentTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCurrentTime") == 0) {
+	case kScNameSetCurrentTime: {
 		stack->correctParams(0);
 		g_system->getTimeAndDate(_tm);
 		stack->pushNULL();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
@@ -206,13 +210,16 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *SXDate::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("date");
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return _scValue;
 	}
 }
@@ -36,6 +36,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "engines/wintermute/base/scriptables/script_ext_file.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 // Note: This code is completely untested, as I have yet to find a game that uses SXFile.
 
@@ -105,10 +106,11 @@ const char *SXFile::scToString() {
 #define FILE_BUFFER_SIZE 32768
 //////////////////////////////////////////////////////////////////////////
 bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetFilename
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetFilename") == 0) {
+	case kScNameSetFilename: {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		cleanup();
@@ -120,7 +122,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// OpenAsText / OpenAsBinary
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OpenAsText") == 0 || strcmp(name, "OpenAsBinary") == 0) {
+	case kScNameOpenAsText:
+	case kScNameOpenAsBinary: {
 		stack->correctParams(1);
 		close();
 		_mode = stack->pop()->getInt(1);
@@ -171,7 +174,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Close
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Close") == 0) {
+	case kScNameClose: {
 		stack->correctParams(0);
 		close();
 		stack->pushNULL();
@@ -181,7 +184,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPosition") == 0) {
+	case kScNameSetPosition: {
 		stack->correctParams(1);
 		if (_mode == 0) {
 			script->runtimeError("File.%s: File is not open", name);
@@ -196,7 +199,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Delete
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Delete") == 0) {
+	case kScNameDelete: {
 		stack->correctParams(0);
 		close();
 		error("SXFile-Method: \"Delete\" not supported");
@@ -208,7 +211,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Copy
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Copy") == 0) {
+	case kScNameCopy: {
 		stack->correctParams(2);
 		/* const char *dest = */ stack->pop()->getString();
 		/* bool overwrite = */ stack->pop()->getBool(true);
@@ -223,7 +226,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadLine") == 0) {
+	case kScNameReadLine: {
 		stack->correctParams(0);
 		if (!_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open in text mode.", name);
@@ -278,7 +281,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadText") == 0) {
+	case kScNameReadText: {
 		stack->correctParams(1);
 		int textLen = stack->pop()->getInt();
 
@@ -331,7 +334,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteLine / WriteText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteLine") == 0 || strcmp(name, "WriteText") == 0) {
+	case kScNameWriteLine:
+	case kScNameWriteText: {
 		stack->correctParams(1);
 		const char *line = stack->pop()->getString();
 		if (!_textMode || !_writeFile) {
@@ -356,7 +360,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadBool") == 0) {
+	case kScNameReadBool: {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -376,7 +380,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadByte
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadByte") == 0) {
+	case kScNameReadByte: {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -396,7 +400,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadShort
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadShort") == 0) {
+	case kScNameReadShort: {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -415,7 +419,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadInt / ReadLong
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadInt") == 0 || strcmp(name, "ReadLong") == 0) {
+	case kScNameReadInt:
+	case kScNameReadLong: {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -435,7 +440,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadFloat") == 0) {
+	case kScNameReadFloat: {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -456,7 +461,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadDouble
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadDouble") == 0) { // TODO: Solve reading a 8 byte double.
+	case kScNameReadDouble: { // TODO: Solve reading a 8 byte double.
 		error("SXFile::ReadDouble - Not endian safe yet");
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
@@ -477,7 +482,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadString") == 0) {
+	case kScNameReadString: {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -506,7 +511,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteBool") == 0) {
+	case kScNameWriteBool: {
 		stack->correctParams(1);
 		bool val = stack->pop()->getBool();
 
@@ -524,7 +529,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteByte
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteByte") == 0) {
+	case kScNameWriteByte: {
 		stack->correctParams(1);
 		byte val = stack->pop()->getInt();
 
@@ -542,7 +547,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteShort
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteShort") == 0) {
+	case kScNameWriteShort: {
 		stack->correctParams(1);
 		int16 val = stack->pop()->getInt();
 
@@ -560,7 +565,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteInt / WriteLong
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteInt") == 0 || strcmp(name, "WriteLong") == 0) {
+	case kScNameWriteInt:
+	case kScNameWriteLong: {
 		stack->correctParams(1);
 		int32 val = stack->pop()->getInt();
 
@@ -578,7 +584,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteFloat") == 0) {
+	case kScNameWriteFloat: {
 		stack->correctParams(1);
 		float val = stack->pop()->getFloat();
 
@@ -597,7 +603,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteDouble
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteDouble") == 0) {
+	case kScNameWriteDouble: {
 		error("SXFile::WriteDouble - Not endian safe yet");
 		stack->correctParams(1);
 		/* double val = */ stack->pop()->getFloat();
@@ -616,7 +622,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteString") == 0) {
+	case kScNameWriteString: {
 		stack->correctParams(1);
 		const char *val = stack->pop()->getString();
 
@@ -633,7 +639,9 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		stack->pushBool(true);
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -643,10 +651,11 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *SXFile::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("file");
 		return _scValue;
 	}
@@ -654,7 +663,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Filename (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Filename") {
+	case kScNameFilename: {
 		_scValue->setString(_filename);
 		return _scValue;
 	}
@@ -662,7 +671,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Position (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Position") {
+	case kScNamePosition: {
 		_scValue->setInt(getPos());
 		return _scValue;
 	}
@@ -670,7 +679,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Length (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Length") {
+	case kScNameLength: {
 		_scValue->setInt(getLength());
 		return _scValue;
 	}
@@ -678,7 +687,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextMode") {
+	case kScNameTextMode: {
 		_scValue->setBool(_textMode);
 		return _scValue;
 	}
@@ -686,10 +695,12 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccessMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccessMode") {
+	case kScNameAccessMode: {
 		_scValue->setInt(_mode);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scGetProperty(name);
 	}
 }
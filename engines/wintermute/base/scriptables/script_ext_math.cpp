@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/scriptables/script_ext_math.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/persistent.h"
 #include "common/math.h"
 #include <math.h>
@@ -60,10 +61,11 @@ SXMath::~SXMath() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Abs
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Abs") == 0) {
+	case kScNameAbs: {
 		stack->correctParams(1);
 		stack->pushFloat(fabs(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -72,7 +74,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Acos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Acos") == 0) {
+	case kScNameAcos: {
 		stack->correctParams(1);
 		stack->pushFloat(acos(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -81,7 +83,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Asin
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Asin") == 0) {
+	case kScNameAsin: {
 		stack->correctParams(1);
 		stack->pushFloat(asin(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -90,7 +92,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Atan
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Atan") == 0) {
+	case kScNameAtan: {
 		stack->correctParams(1);
 		stack->pushFloat(atan(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -99,7 +101,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Atan2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Atan2") == 0) {
+	case kScNameAtan2: {
 		stack->correctParams(2);
 		double y = stack->pop()->getFloat();
 		double x = stack->pop()->getFloat();
@@ -110,7 +112,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Ceil
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Ceil") == 0) {
+	case kScNameCeil: {
 		stack->correctParams(1);
 		stack->pushFloat(ceil(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -119,7 +121,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Cos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Cos") == 0) {
+	case kScNameCos: {
 		stack->correctParams(1);
 		stack->pushFloat(cos(degreeToRadian(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -128,7 +130,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Cosh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Cosh") == 0) {
+	case kScNameCosh: {
 		stack->correctParams(1);
 		stack->pushFloat(cosh(degreeToRadian(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -137,7 +139,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Exp
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Exp") == 0) {
+	case kScNameExp: {
 		stack->correctParams(1);
 		stack->pushFloat(exp(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -146,7 +148,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Floor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Floor") == 0) {
+	case kScNameFloor: {
 		stack->correctParams(1);
 		stack->pushFloat(floor(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -155,7 +157,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Log
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Log") == 0) {
+	case kScNameLog: {
 		stack->correctParams(1);
 		stack->pushFloat(log(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -164,7 +166,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Log10
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Log10") == 0) {
+	case kScNameLog10: {
 		stack->correctParams(1);
 		stack->pushFloat(log10(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -173,7 +175,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Pow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pow") == 0) {
+	case kScNamePow: {
 		stack->correctParams(2);
 		double x = stack->pop()->getFloat();
 		double y = stack->pop()->getFloat();
@@ -185,7 +187,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Sin
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sin") == 0) {
+	case kScNameSin: {
 		stack->correctParams(1);
 		stack->pushFloat(sin(degreeToRadian(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -194,7 +196,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Sinh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sinh") == 0) {
+	case kScNameSinh: {
 		stack->correctParams(1);
 		stack->pushFloat(sinh(degreeToRadian(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -203,7 +205,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Tan
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Tan") == 0) {
+	case kScNameTan: {
 		stack->correctParams(1);
 		stack->pushFloat(tan(degreeToRadian(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -212,7 +214,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Tanh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Tanh") == 0) {
+	case kScNameTanh: {
 		stack->correctParams(1);
 		stack->pushFloat(tanh(degreeToRadian(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -221,7 +223,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Sqrt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sqrt") == 0) {
+	case kScNameSqrt: {
 		stack->correctParams(1);
 		stack->pushFloat(sqrt(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -230,7 +232,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DegToRad
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DegToRad") == 0) {
+	case kScNameDegToRad: {
 		stack->correctParams(1);
 		stack->pushFloat(degreeToRadian(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -239,11 +241,13 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// RadToDeg
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RadToDeg") == 0) {
+	case kScNameRadToDeg: {
 		stack->correctParams(1);
 		stack->pushFloat(radianToDegree(stack->pop()->getFloat()));
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
@@ -253,10 +257,11 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *SXMath::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("math");
 		return _scValue;
 	}
@@ -264,10 +269,12 @@ ScValue *SXMath::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PI
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PI") {
+	case kScNamePI: {
 		_scValue->setFloat(M_PI);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return _scValue;
 	}
 }
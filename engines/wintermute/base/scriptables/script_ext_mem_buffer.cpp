@@ -31,6 +31,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_ext_mem_buffer.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "common/file.h"
 
 namespace Wintermute {
@@ -133,10 +134,11 @@ const char *SXMemBuffer::scToString() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetSize
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetSize") == 0) {
+	case kScNameSetSize: {
 		stack->correctParams(1);
 		int newSize = stack->pop()->getInt();
 		newSize = MAX(0, newSize);
@@ -152,7 +154,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetBool") == 0) {
+	case kScNameGetBool: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(bool))) {
@@ -167,7 +169,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetByte
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetByte") == 0) {
+	case kScNameGetByte: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(byte))) {
@@ -182,7 +184,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetShort
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetShort") == 0) {
+	case kScNameGetShort: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(short))) {
@@ -197,7 +199,8 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetInt / GetLong
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInt") == 0 || strcmp(name, "GetLong") == 0) {
+	case kScNameGetInt:
+	case kScNameGetLong: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(int))) {
@@ -212,7 +215,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFloat") == 0) {
+	case kScNameGetFloat: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(float))) {
@@ -227,7 +230,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetDouble
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDouble") == 0) {
+	case kScNameGetDouble: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(double))) {
@@ -242,7 +245,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetString") == 0) {
+	case kScNameGetString: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		int length = stack->pop()->getInt();
@@ -271,7 +274,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetPointer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPointer") == 0) {
+	case kScNameGetPointer: {
 		stack->correctParams(1);
 		int start = stack->pop()->getInt();
 		if (!checkBounds(script, start, sizeof(void *))) {
@@ -287,7 +290,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetBool") == 0) {
+	case kScNameSetBool: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		bool val = stack->pop()->getBool();
@@ -304,7 +307,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetByte
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetByte") == 0) {
+	case kScNameSetByte: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		byte val = (byte)stack->pop()->getInt();
@@ -321,7 +324,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetShort
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetShort") == 0) {
+	case kScNameSetShort: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		short val = (short)stack->pop()->getInt();
@@ -338,7 +341,8 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetInt / SetLong
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetInt") == 0 || strcmp(name, "SetLong") == 0) {
+	case kScNameSetInt:
+	case kScNameSetLong: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		int val = stack->pop()->getInt();
@@ -355,7 +359,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFloat") == 0) {
+	case kScNameSetFloat: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		float val = (float)stack->pop()->getFloat();
@@ -372,7 +376,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetDouble
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetDouble") == 0) {
+	case kScNameSetDouble: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		double val = stack->pop()->getFloat();
@@ -389,7 +393,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetString") == 0) {
+	case kScNameSetString: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		const char *val = stack->pop()->getString();
@@ -406,7 +410,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetPointer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPointer") == 0) {
+	case kScNameSetPointer: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		/* ScValue *val = */ stack->pop();
@@ -429,7 +433,7 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// DEBUG_Dump
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DEBUG_Dump") == 0) {
+	case kScNameDEBUG_Dump: {
 		stack->correctParams(0);
 		if (_buffer && _size) {
 			warning("SXMemBuffer::ScCallMethod - DEBUG_Dump");
@@ -440,7 +444,9 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 		}
 		stack->pushNULL();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
@@ -450,10 +456,11 @@ bool SXMemBuffer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 ScValue *SXMemBuffer::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("membuffer");
 		return _scValue;
 	}
@@ -461,10 +468,12 @@ ScValue *SXMemBuffer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Size (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Size") {
+	case kScNameSize: {
 		_scValue->setInt(_size);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseScriptable::scGetProperty(name);
 	}
 }
@@ -32,6 +32,7 @@
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/base/scriptables/script_ext_string.h"
 #include "engines/wintermute/base/scriptables/script_ext_array.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/utils/string_util.h"
 #include "common/tokenizer.h"
 
@@ -107,10 +108,11 @@ void SXString::scSetString(const char *val) {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Substring
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Substring") == 0) {
+	case kScNameSubstring: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		int end   = stack->pop()->getInt();
@@ -145,7 +147,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Substr
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Substr") == 0) {
+	case kScNameSubstr: {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 
@@ -187,7 +189,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ToUpperCase
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToUpperCase") == 0) {
+	case kScNameToUpperCase: {
 		stack->correctParams(0);
 
 		WideString str;
@@ -211,7 +213,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ToLowerCase
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToLowerCase") == 0) {
+	case kScNameToLowerCase: {
 		stack->correctParams(0);
 
 		WideString str;
@@ -235,7 +237,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IndexOf
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IndexOf") == 0) {
+	case kScNameIndexOf: {
 		stack->correctParams(2);
 
 		const char *strToFind = stack->pop()->getString();
@@ -264,7 +266,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Split
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Split") == 0) {
+	case kScNameSplit: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		char separators[MAX_PATH_LENGTH] = ",";
@@ -336,7 +338,9 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 
 		stack->pushNative(array, false);
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
@@ -346,17 +350,18 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *SXString::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("string");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Length (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Length") {
+	case kScNameLength: {
 		if (_gameRef->_textEncoding == TEXT_UTF8) {
 			WideString wstr = StringUtil::utf8ToWide(_string);
 			_scValue->setInt(wstr.size());
@@ -369,10 +374,12 @@ ScValue *SXString::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Capacity
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Capacity") {
+	case kScNameCapacity: {
 		_scValue->setInt(_capacity);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return _scValue;
 	}
 }
@@ -380,10 +387,11 @@ ScValue *SXString::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXString::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Capacity
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Capacity") == 0) {
+	case kScNameCapacity: {
 		int32 newCap = (uint32)value->getInt();
 		if (newCap < (int32)(strlen(_string) + 1)) {
 			_gameRef->LOG(0, "Warning: cannot lower string capacity");
@@ -398,7 +406,9 @@ bool SXString::scSetProperty(const char *name, ScValue *value) {
 			}
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return STATUS_FAILED;
 	}
 }
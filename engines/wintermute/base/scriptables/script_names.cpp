@@ -0,0 +1,700 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/wintermute/base/scriptables/script_names.h"
+#include "common/hash-str.h"
+#include "common/util.h"
+#include "common/textconsole.h"
+
+namespace Wintermute {
+
+struct ScNameEntry {
+	ScNameId id;
+	const char *name;
+};
+
+static const ScNameEntry scNames[] = {
+	{ kScNameAbs, "Abs" },
+	{ kScNameAccCaption, "AccCaption" },
+	{ kScNameAccKeyboardCursorSkip, "AccKeyboardCursorSkip" },
+	{ kScNameAccKeyboardEnabled, "AccKeyboardEnabled" },
+	{ kScNameAccKeyboardPause, "AccKeyboardPause" },
+	{ kScNameAccOutputText, "AccOutputText" },
+	{ kScNameAccTTSCaptions, "AccTTSCaptions" },
+	{ kScNameAccTTSEnabled, "AccTTSEnabled" },
+	{ kScNameAccTTSKeypress, "AccTTSKeypress" },
+	{ kScNameAccTTSTalk, "AccTTSTalk" },
+	{ kScNameAccelerated, "Accelerated" },
+	{ kScNameAcceleratedMode, "AcceleratedMode" },
+	{ kScNameAccessMode, "AccessMode" },
+	{ kScNameAcos, "Acos" },
+	{ kScNameActive, "Active" },
+	{ kScNameActiveObject, "ActiveObject" },
+	{ kScNameAddAttachment, "AddAttachment" },
+	{ kScNameAddEntity, "AddEntity" },
+	{ kScNameAddEvent, "AddEvent" },
+	{ kScNameAddFrame, "AddFrame" },
+	{ kScNameAddGlobalForce, "AddGlobalForce" },
+	{ kScNameAddLayer, "AddLayer" },
+	{ kScNameAddPoint, "AddPoint" },
+	{ kScNameAddPointForce, "AddPointForce" },
+	{ kScNameAddRegion, "AddRegion" },
+	{ kScNameAddResponse, "AddResponse" },
+	{ kScNameAddResponseOnce, "AddResponseOnce" },
+	{ kScNameAddResponseOnceGame, "AddResponseOnceGame" },
+	{ kScNameAddSpeechDir, "AddSpeechDir" },
+	{ kScNameAddSprite, "AddSprite" },
+	{ kScNameAddSubframe, "AddSubframe" },
+	{ kScNameAddTalkSprite, "AddTalkSprite" },
+	{ kScNameAlpha1, "Alpha1" },
+	{ kScNameAlpha2, "Alpha2" },
+	{ kScNameAlphaColor, "AlphaColor" },
+	{ kScNameAlphaTimeBased, "AlphaTimeBased" },
+	{ kScNameAmount, "Amount" },
+	{ kScNameAmountAlign, "AmountAlign" },
+	{ kScNameAmountOffsetX, "AmountOffsetX" },
+	{ kScNameAmountOffsetY, "AmountOffsetY" },
+	{ kScNameAmountString, "AmountString" },
+	{ kScNameAngVelocity1, "AngVelocity1" },
+	{ kScNameAngVelocity2, "AngVelocity2" },
+	{ kScNameAngle1, "Angle1" },
+	{ kScNameAngle2, "Angle2" },
+	{ kScNameApplyEvent, "ApplyEvent" },
+	{ kScNameAsin, "Asin" },
+	{ kScNameAtan, "Atan" },
+	{ kScNameAtan2, "Atan2" },
+	{ kScNameAttachScript, "AttachScript" },
+	{ kScNameAutoSaveOnExit, "AutoSaveOnExit" },
+	{ kScNameAutoSaveSlot, "AutoSaveSlot" },
+	{ kScNameAutoScroll, "AutoScroll" },
+	{ kScNameAutorunDisabled, "AutorunDisabled" },
+	{ kScNameBlendMode, "BlendMode" },
+	{ kScNameBlocked, "Blocked" },
+	{ kScNameCanHandleEvent, "CanHandleEvent" },
+	{ kScNameCanHandleMethod, "CanHandleMethod" },
+	{ kScNameCapacity, "Capacity" },
+	{ kScNameCaption, "Caption" },
+	{ kScNameCeil, "Ceil" },
+	{ kScNameCenter, "Center" },
+	{ kScNameChangeScene, "ChangeScene" },
+	{ kScNameChangingScene, "ChangingScene" },
+	{ kScNameClearResponses, "ClearResponses" },
+	{ kScNameClearScriptCache, "ClearScriptCache" },
+	{ kScNameClipContents, "ClipContents" },
+	{ kScNameClose, "Close" },
+	{ kScNameCloseUp, "CloseUp" },
+	{ kScNameColorable, "Colorable" },
+	{ kScNameCopy, "Copy" },
+	{ kScNameCos, "Cos" },
+	{ kScNameCosh, "Cosh" },
+	{ kScNameCreateButton, "CreateButton" },
+	{ kScNameCreateEditor, "CreateEditor" },
+	{ kScNameCreateEntity, "CreateEntity" },
+	{ kScNameCreateItem, "CreateItem" },
+	{ kScNameCreateParticleEmitter, "CreateParticleEmitter" },
+	{ kScNameCreateRegion, "CreateRegion" },
+	{ kScNameCreateStatic, "CreateStatic" },
+	{ kScNameCreateWindow, "CreateWindow" },
+	{ kScNameCurrentFrame, "CurrentFrame" },
+	{ kScNameCurrentTime, "CurrentTime" },
+	{ kScNameCursorBlinkRate, "CursorBlinkRate" },
+	{ kScNameCursorChar, "CursorChar" },
+	{ kScNameCursorCombined, "CursorCombined" },
+	{ kScNameCursorHidden, "CursorHidden" },
+	{ kScNameDEBUG_CrashMe, "DEBUG_CrashMe" },
+	{ kScNameDEBUG_Dump, "DEBUG_Dump" },
+	{ kScNameDEBUG_DumpClassRegistry, "DEBUG_DumpClassRegistry" },
+	{ kScNameDebugMode, "DebugMode" },
+	{ kScNameDecoration, "Decoration" },
+	{ kScNameDegToRad, "DegToRad" },
+	{ kScNameDelay, "Delay" },
+	{ kScNameDelete, "Delete" },
+	{ kScNameDeleteButton, "DeleteButton" },
+	{ kScNameDeleteControl, "DeleteControl" },
+	{ kScNameDeleteEditor, "DeleteEditor" },
+	{ kScNameDeleteEntity, "DeleteEntity" },
+	{ kScNameDeleteEvent, "DeleteEvent" },
+	{ kScNameDeleteFrame, "DeleteFrame" },
+	{ kScNameDeleteItem, "DeleteItem" },
+	{ kScNameDeleteLayer, "DeleteLayer" },
+	{ kScNameDeleteNode, "DeleteNode" },
+	{ kScNameDeleteParticleEmitter, "DeleteParticleEmitter" },
+	{ kScNameDeleteRegion, "DeleteRegion" },
+	{ kScNameDeleteSaveThumbnail, "DeleteSaveThumbnail" },
+	{ kScNameDeleteStatic, "DeleteStatic" },
+	{ kScNameDeleteSubframe, "DeleteSubframe" },
+	{ kScNameDeleteWindow, "DeleteWindow" },
+	{ kScNameDetachScript, "DetachScript" },
+	{ kScNameDeviceType, "DeviceType" },
+	{ kScNameDirection, "Direction" },
+	{ kScNameDisableScriptProfiling, "DisableScriptProfiling" },
+	{ kScNameDisabled, "Disabled" },
+	{ kScNameDisplayAmount, "DisplayAmount" },
+	{ kScNameDisplayLoadingIcon, "DisplayLoadingIcon" },
+	{ kScNameDropItem, "DropItem" },
+	{ kScNameDumpTextureStats, "DumpTextureStats" },
+	{ kScNameEmitEvent, "EmitEvent" },
+	{ kScNameEmptySaveSlot, "EmptySaveSlot" },
+	{ kScNameEnableScriptProfiling, "EnableScriptProfiling" },
+	{ kScNameEndDlgBranch, "EndDlgBranch" },
+	{ kScNameExclusive, "Exclusive" },
+	{ kScNameExp, "Exp" },
+	{ kScNameExpandString, "ExpandString" },
+	{ kScNameExponentialGrowth, "ExponentialGrowth" },
+	{ kScNameFPS, "FPS" },
+	{ kScNameFadeColor, "FadeColor" },
+	{ kScNameFadeIn, "FadeIn" },
+	{ kScNameFadeInAsync, "FadeInAsync" },
+	{ kScNameFadeInTime, "FadeInTime" },
+	{ kScNameFadeOut, "FadeOut" },
+	{ kScNameFadeOutAsync, "FadeOutAsync" },
+	{ kScNameFadeOutTime, "FadeOutTime" },
+	{ kScNameFileExists, "FileExists" },
+	{ kScNameFilename, "Filename" },
+	{ kScNameFinished, "Finished" },
+	{ kScNameFloor, "Floor" },
+	{ kScNameFocus, "Focus" },
+	{ kScNameFocusable, "Focusable" },
+	{ kScNameForceTalkAnim, "ForceTalkAnim" },
+	{ kScNameFrameWidth, "FrameWidth" },
+	{ kScNameFreezable, "Freezable" },
+	{ kScNameFrozen, "Frozen" },
+	{ kScNameGenerationAmount, "GenerationAmount" },
+	{ kScNameGenerationInterval, "GenerationInterval" },
+	{ kScNameGetActiveCursor, "GetActiveCursor" },
+	{ kScNameGetActiveCursorObject, "GetActiveCursorObject" },
+	{ kScNameGetAttachment, "GetAttachment" },
+	{ kScNameGetBool, "GetBool" },
+	{ kScNameGetByte, "GetByte" },
+	{ kScNameGetControl, "GetControl" },
+	{ kScNameGetCurrentDlgBranch, "GetCurrentDlgBranch" },
+	{ kScNameGetCursor, "GetCursor" },
+	{ kScNameGetCursorObject, "GetCursorObject" },
+	{ kScNameGetDate, "GetDate" },
+	{ kScNameGetDisabledImage, "GetDisabledImage" },
+	{ kScNameGetDisabledImageObject, "GetDisabledImageObject" },
+	{ kScNameGetDouble, "GetDouble" },
+	{ kScNameGetEntity, "GetEntity" },
+	{ kScNameGetEvent, "GetEvent" },
+	{ kScNameGetFadeColor, "GetFadeColor" },
+	{ kScNameGetFileChecksum, "GetFileChecksum" },
+	{ kScNameGetFloat, "GetFloat" },
+	{ kScNameGetFocusedImage, "GetFocusedImage" },
+	{ kScNameGetFocusedImageObject, "GetFocusedImageObject" },
+	{ kScNameGetFont, "GetFont" },
+	{ kScNameGetFrame, "GetFrame" },
+	{ kScNameGetFreeNode, "GetFreeNode" },
+	{ kScNameGetGlobalMasterVolume, "GetGlobalMasterVolume" },
+	{ kScNameGetGlobalMusicVolume, "GetGlobalMusicVolume" },
+	{ kScNameGetGlobalSFXVolume, "GetGlobalSFXVolume" },
+	{ kScNameGetGlobalSpeechVolume, "GetGlobalSpeechVolume" },
+	{ kScNameGetHours, "GetHours" },
+	{ kScNameGetHoverCursor, "GetHoverCursor" },
+	{ kScNameGetHoverCursorObject, "GetHoverCursorObject" },
+	{ kScNameGetHoverImage, "GetHoverImage" },
+	{ kScNameGetHoverImageObject, "GetHoverImageObject" },
+	{ kScNameGetHoverSprite, "GetHoverSprite" },
+	{ kScNameGetHoverSpriteObject, "GetHoverSpriteObject" },
+	{ kScNameGetImage, "GetImage" },
+	{ kScNameGetImageObject, "GetImageObject" },
+	{ kScNameGetInactiveImage, "GetInactiveImage" },
+	{ kScNameGetInactiveImageObject, "GetInactiveImageObject" },
+	{ kScNameGetInt, "GetInt" },
+	{ kScNameGetInventoryWindow, "GetInventoryWindow" },
+	{ kScNameGetItem, "GetItem" },
+	{ kScNameGetLayer, "GetLayer" },
+	{ kScNameGetLong, "GetLong" },
+	{ kScNameGetMinutes, "GetMinutes" },
+	{ kScNameGetMonth, "GetMonth" },
+	{ kScNameGetMusic, "GetMusic" },
+	{ kScNameGetMusicChannel, "GetMusicChannel" },
+	{ kScNameGetMusicChannelPosition, "GetMusicChannelPosition" },
+	{ kScNameGetMusicChannelVolume, "GetMusicChannelVolume" },
+	{ kScNameGetMusicPosition, "GetMusicPosition" },
+	{ kScNameGetMusicVolume, "GetMusicVolume" },
+	{ kScNameGetNode, "GetNode" },
+	{ kScNameGetNormalCursor, "GetNormalCursor" },
+	{ kScNameGetNormalCursorObject, "GetNormalCursorObject" },
+	{ kScNameGetNumResponses, "GetNumResponses" },
+	{ kScNameGetPoint, "GetPoint" },
+	{ kScNameGetPointer, "GetPointer" },
+	{ kScNameGetPressedImage, "GetPressedImage" },
+	{ kScNameGetPressedImageObject, "GetPressedImageObject" },
+	{ kScNameGetRegionAt, "GetRegionAt" },
+	{ kScNameGetResponse, "GetResponse" },
+	{ kScNameGetResponseWindow, "GetResponseWindow" },
+	{ kScNameGetResponsesWindow, "GetResponsesWindow" },
+	{ kScNameGetRotationAt, "GetRotationAt" },
+	{ kScNameGetSaveSlotDescription, "GetSaveSlotDescription" },
+	{ kScNameGetScaleAt, "GetScaleAt" },
+	{ kScNameGetSeconds, "GetSeconds" },
+	{ kScNameGetShort, "GetShort" },
+	{ kScNameGetSound, "GetSound" },
+	{ kScNameGetSoundLength, "GetSoundLength" },
+	{ kScNameGetSoundPosition, "GetSoundPosition" },
+	{ kScNameGetSoundVolume, "GetSoundVolume" },
+	{ kScNameGetSprite, "GetSprite" },
+	{ kScNameGetSpriteObject, "GetSpriteObject" },
+	{ kScNameGetString, "GetString" },
+	{ kScNameGetSubframe, "GetSubframe" },
+	{ kScNameGetWaitCursor, "GetWaitCursor" },
+	{ kScNameGetWaitCursorObject, "GetWaitCursorObject" },
+	{ kScNameGetWaypointGroup, "GetWaypointGroup" },
+	{ kScNameGetWeekday, "GetWeekday" },
+	{ kScNameGetWidget, "GetWidget" },
+	{ kScNameGetYear, "GetYear" },
+	{ kScNameGoExclusive, "GoExclusive" },
+	{ kScNameGoSystemExclusive, "GoSystemExclusive" },
+	{ kScNameGoTo, "GoTo" },
+	{ kScNameGoToAsync, "GoToAsync" },
+	{ kScNameGoToObject, "GoToObject" },
+	{ kScNameGoToObjectAsync, "GoToObjectAsync" },
+	{ kScNameGrowthRate1, "GrowthRate1" },
+	{ kScNameGrowthRate2, "GrowthRate2" },
+	{ kScNameHasActiveCursor, "HasActiveCursor" },
+	{ kScNameHasAnim, "HasAnim" },
+	{ kScNameHasCursor, "HasCursor" },
+	{ kScNameHasItem, "HasItem" },
+	{ kScNameHeight, "Height" },
+	{ kScNameHeightToFit, "HeightToFit" },
+	{ kScNameHideLoadingIcon, "HideLoadingIcon" },
+	{ kScNameHideStatusLine, "HideStatusLine" },
+	{ kScNameHotspotX, "HotspotX" },
+	{ kScNameHotspotY, "HotspotY" },
+	{ kScNameHwnd, "Hwnd" },
+	{ kScNameIdleAnimName, "IdleAnimName" },
+	{ kScNameIgnoreItems, "IgnoreItems" },
+	{ kScNameInGame, "InGame" },
+	{ kScNameIndexOf, "IndexOf" },
+	{ kScNameInsertEntity, "InsertEntity" },
+	{ kScNameInsertFrame, "InsertFrame" },
+	{ kScNameInsertLayer, "InsertLayer" },
+	{ kScNameInsertPoint, "InsertPoint" },
+	{ kScNameInsertRegion, "InsertRegion" },
+	{ kScNameInsertSubframe, "InsertSubframe" },
+	{ kScNameInteractive, "Interactive" },
+	{ kScNameInventoryObject, "InventoryObject" },
+	{ kScNameInventoryScrollOffset, "InventoryScrollOffset" },
+	{ kScNameInventoryVisible, "InventoryVisible" },
+	{ kScNameIs2DOnly, "Is2DOnly" },
+	{ kScNameIs3DOnly, "Is3DOnly" },
+	{ kScNameIsAlt, "IsAlt" },
+	{ kScNameIsBlockedAt, "IsBlockedAt" },
+	{ kScNameIsControl, "IsControl" },
+	{ kScNameIsItemTaken, "IsItemTaken" },
+	{ kScNameIsKeyDown, "IsKeyDown" },
+	{ kScNameIsMusicChannelPlaying, "IsMusicChannelPlaying" },
+	{ kScNameIsMusicPlaying, "IsMusicPlaying" },
+	{ kScNameIsPointInViewport, "IsPointInViewport" },
+	{ kScNameIsSaveSlotUsed, "IsSaveSlotUsed" },
+	{ kScNameIsScriptRunning, "IsScriptRunning" },
+	{ kScNameIsScrolling, "IsScrolling" },
+	{ kScNameIsShift, "IsShift" },
+	{ kScNameIsSoundPlaying, "IsSoundPlaying" },
+	{ kScNameIsTalking, "IsTalking" },
+	{ kScNameIsTheoraPaused, "IsTheoraPaused" },
+	{ kScNameIsTheoraPlaying, "IsTheoraPlaying" },
+	{ kScNameIsWalkableAt, "IsWalkableAt" },
+	{ kScNameIsWalking, "IsWalking" },
+	{ kScNameItem, "Item" },
+	{ kScNameKey, "Key" },
+	{ kScNameKeyCode, "KeyCode" },
+	{ kScNameKeyboard, "Keyboard" },
+	{ kScNameKeyframe, "Keyframe" },
+	{ kScNameKillSounds, "KillSounds" },
+	{ kScNameLOG, "LOG" },
+	{ kScNameLastResponse, "LastResponse" },
+	{ kScNameLastResponseOrig, "LastResponseOrig" },
+	{ kScNameLength, "Length" },
+	{ kScNameLifeTime1, "LifeTime1" },
+	{ kScNameLifeTime2, "LifeTime2" },
+	{ kScNameLifeTimeZBased, "LifeTimeZBased" },
+	{ kScNameLoadActor, "LoadActor" },
+	{ kScNameLoadEntity, "LoadEntity" },
+	{ kScNameLoadFromFile, "LoadFromFile" },
+	{ kScNameLoadGame, "LoadGame" },
+	{ kScNameLoadInventoryBox, "LoadInventoryBox" },
+	{ kScNameLoadItems, "LoadItems" },
+	{ kScNameLoadResponseBox, "LoadResponseBox" },
+	{ kScNameLoadSound, "LoadSound" },
+	{ kScNameLoadStringTable, "LoadStringTable" },
+	{ kScNameLoadWindow, "LoadWindow" },
+	{ kScNameLockMouseRect, "LockMouseRect" },
+	{ kScNameLog, "Log" },
+	{ kScNameLog10, "Log10" },
+	{ kScNameLooping, "Looping" },
+	{ kScNameMain, "Main" },
+	{ kScNameMainLayer, "MainLayer" },
+	{ kScNameMainObject, "MainObject" },
+	{ kScNameMasterVolume, "MasterVolume" },
+	{ kScNameMaxBatches, "MaxBatches" },
+	{ kScNameMaxLength, "MaxLength" },
+	{ kScNameMaxParticles, "MaxParticles" },
+	{ kScNameMenu, "Menu" },
+	{ kScNameMergeAnims, "MergeAnims" },
+	{ kScNameMirrorX, "MirrorX" },
+	{ kScNameMirrorY, "MirrorY" },
+	{ kScNameMostRecentSaveSlot, "MostRecentSaveSlot" },
+	{ kScNameMouseX, "MouseX" },
+	{ kScNameMouseY, "MouseY" },
+	{ kScNameMovable, "Movable" },
+	{ kScNameMoveAfter, "MoveAfter" },
+	{ kScNameMoveBefore, "MoveBefore" },
+	{ kScNameMoveToBottom, "MoveToBottom" },
+	{ kScNameMoveToTop, "MoveToTop" },
+	{ kScNameMoveX, "MoveX" },
+	{ kScNameMoveY, "MoveY" },
+	{ kScNameMsg, "Msg" },
+	{ kScNameMusicCrossfade, "MusicCrossfade" },
+	{ kScNameMusicVolume, "MusicVolume" },
+	{ kScNameName, "Name" },
+	{ kScNameNextSibling, "NextSibling" },
+	{ kScNameNonIntMouseEvents, "NonIntMouseEvents" },
+	{ kScNameNumAttachments, "NumAttachments" },
+	{ kScNameNumControls, "NumControls" },
+	{ kScNameNumEvents, "NumEvents" },
+	{ kScNameNumFrames, "NumFrames" },
+	{ kScNameNumFreeNodes, "NumFreeNodes" },
+	{ kScNameNumItems, "NumItems" },
+	{ kScNameNumLayers, "NumLayers" },
+	{ kScNameNumLiveParticles, "NumLiveParticles" },
+	{ kScNameNumNodes, "NumNodes" },
+	{ kScNameNumPoints, "NumPoints" },
+	{ kScNameNumSubframes, "NumSubframes" },
+	{ kScNameNumWaypointGroups, "NumWaypointGroups" },
+	{ kScNameNumWidgets, "NumWidgets" },
+	{ kScNameOffsetX, "OffsetX" },
+	{ kScNameOffsetY, "OffsetY" },
+	{ kScNameOpenAsBinary, "OpenAsBinary" },
+	{ kScNameOpenAsText, "OpenAsText" },
+	{ kScNameOpenDocument, "OpenDocument" },
+	{ kScNameOwner, "Owner" },
+	{ kScNamePI, "PI" },
+	{ kScNameParent, "Parent" },
+	{ kScNameParentNotify, "ParentNotify" },
+	{ kScNameParticleEmitter, "ParticleEmitter" },
+	{ kScNamePause, "Pause" },
+	{ kScNamePauseMusic, "PauseMusic" },
+	{ kScNamePauseMusicChannel, "PauseMusicChannel" },
+	{ kScNamePauseSound, "PauseSound" },
+	{ kScNamePauseTheora, "PauseTheora" },
+	{ kScNamePaused, "Paused" },
+	{ kScNamePersistentState, "PersistentState" },
+	{ kScNamePersistentStateSprites, "PersistentStateSprites" },
+	{ kScNamePixelPerfect, "PixelPerfect" },
+	{ kScNamePlatform, "Platform" },
+	{ kScNamePlay, "Play" },
+	{ kScNamePlayAnim, "PlayAnim" },
+	{ kScNamePlayAnimAsync, "PlayAnimAsync" },
+	{ kScNamePlayMusic, "PlayMusic" },
+	{ kScNamePlayMusicChannel, "PlayMusicChannel" },
+	{ kScNamePlaySound, "PlaySound" },
+	{ kScNamePlaySoundEvent, "PlaySoundEvent" },
+	{ kScNamePlayTheora, "PlayTheora" },
+	{ kScNamePlayVideo, "PlayVideo" },
+	{ kScNamePop, "Pop" },
+	{ kScNamePosition, "Position" },
+	{ kScNamePow, "Pow" },
+	{ kScNamePress, "Press" },
+	{ kScNamePressed, "Pressed" },
+	{ kScNamePrevScene, "PrevScene" },
+	{ kScNamePrevSceneFilename, "PrevSceneFilename" },
+	{ kScNamePrevSibling, "PrevSibling" },
+	{ kScNamePreviousScene, "PreviousScene" },
+	{ kScNamePreviousSceneFilename, "PreviousSceneFilename" },
+	{ kScNamePrintable, "Printable" },
+	{ kScNamePush, "Push" },
+	{ kScNameQueryItem, "QueryItem" },
+	{ kScNameQuitGame, "QuitGame" },
+	{ kScNameRadToDeg, "RadToDeg" },
+	{ kScNameReadBool, "ReadBool" },
+	{ kScNameReadByte, "ReadByte" },
+	{ kScNameReadDouble, "ReadDouble" },
+	{ kScNameReadFloat, "ReadFloat" },
+	{ kScNameReadInt, "ReadInt" },
+	{ kScNameReadLine, "ReadLine" },
+	{ kScNameReadLong, "ReadLong" },
+	{ kScNameReadShort, "ReadShort" },
+	{ kScNameReadString, "ReadString" },
+	{ kScNameReadText, "ReadText" },
+	{ kScNameReady, "Ready" },
+	{ kScNameRegReadNumber, "RegReadNumber" },
+	{ kScNameRegReadString, "RegReadString" },
+	{ kScNameRegWriteNumber, "RegWriteNumber" },
+	{ kScNameRegWriteString, "RegWriteString" },
+	{ kScNameRegion, "Region" },
+	{ kScNameRegistrable, "Registrable" },
+	{ kScNameRelativeRotate, "RelativeRotate" },
+	{ kScNameRelativeScale, "RelativeScale" },
+	{ kScNameRemoveActiveCursor, "RemoveActiveCursor" },
+	{ kScNameRemoveAttachment, "RemoveAttachment" },
+	{ kScNameRemoveCursor, "RemoveCursor" },
+	{ kScNameRemoveForce, "RemoveForce" },
+	{ kScNameRemovePoint, "RemovePoint" },
+	{ kScNameRemoveSpeechDir, "RemoveSpeechDir" },
+	{ kScNameRemoveSprite, "RemoveSprite" },
+	{ kScNameRemoveTalkSprite, "RemoveTalkSprite" },
+	{ kScNameRemoveWaitCursor, "RemoveWaitCursor" },
+	{ kScNameReset, "Reset" },
+	{ kScNameResetResponse, "ResetResponse" },
+	{ kScNameResponsesVisible, "ResponsesVisible" },
+	{ kScNameResume, "Resume" },
+	{ kScNameResumeMusic, "ResumeMusic" },
+	{ kScNameResumeMusicChannel, "ResumeMusicChannel" },
+	{ kScNameResumeSound, "ResumeSound" },
+	{ kScNameResumeTheora, "ResumeTheora" },
+	{ kScNameRotatable, "Rotatable" },
+	{ kScNameRotate, "Rotate" },
+	{ kScNameRotation1, "Rotation1" },
+	{ kScNameRotation2, "Rotation2" },
+	{ kScNameRunScript, "RunScript" },
+	{ kScNameSFXVolume, "SFXVolume" },
+	{ kScNameSaveDirectory, "SaveDirectory" },
+	{ kScNameSaveGame, "SaveGame" },
+	{ kScNameSaveState, "SaveState" },
+	{ kScNameScalable, "Scalable" },
+	{ kScNameScale, "Scale" },
+	{ kScNameScale1, "Scale1" },
+	{ kScNameScale2, "Scale2" },
+	{ kScNameScaleX, "ScaleX" },
+	{ kScNameScaleY, "ScaleY" },
+	{ kScNameScaleZBased, "ScaleZBased" },
+	{ kScNameScene, "Scene" },
+	{ kScNameSceneIndependent, "SceneIndependent" },
+	{ kScNameScreenHeight, "ScreenHeight" },
+	{ kScNameScreenWidth, "ScreenWidth" },
+	{ kScNameScreenshot, "Screenshot" },
+	{ kScNameScreenshotEx, "ScreenshotEx" },
+	{ kScNameScrollPixelsX, "ScrollPixelsX" },
+	{ kScNameScrollPixelsY, "ScrollPixelsY" },
+	{ kScNameScrollSpeedX, "ScrollSpeedX" },
+	{ kScNameScrollSpeedY, "ScrollSpeedY" },
+	{ kScNameScrollTo, "ScrollTo" },
+	{ kScNameScrollToAsync, "ScrollToAsync" },
+	{ kScNameSelEnd, "SelEnd" },
+	{ kScNameSelStart, "SelStart" },
+	{ kScNameSelectedItem, "SelectedItem" },
+	{ kScNameSetActiveCursor, "SetActiveCursor" },
+	{ kScNameSetBool, "SetBool" },
+	{ kScNameSetBorder, "SetBorder" },
+	{ kScNameSetBorderThickness, "SetBorderThickness" },
+	{ kScNameSetByte, "SetByte" },
+	{ kScNameSetCaption, "SetCaption" },
+	{ kScNameSetCurrentTime, "SetCurrentTime" },
+	{ kScNameSetCursor, "SetCursor" },
+	{ kScNameSetDate, "SetDate" },
+	{ kScNameSetDisabledFont, "SetDisabledFont" },
+	{ kScNameSetDisabledImage, "SetDisabledImage" },
+	{ kScNameSetDouble, "SetDouble" },
+	{ kScNameSetEntity, "SetEntity" },
+	{ kScNameSetFilename, "SetFilename" },
+	{ kScNameSetFloat, "SetFloat" },
+	{ kScNameSetFocusedFont, "SetFocusedFont" },
+	{ kScNameSetFocusedImage, "SetFocusedImage" },
+	{ kScNameSetFont, "SetFont" },
+	{ kScNameSetGlobalMasterVolume, "SetGlobalMasterVolume" },
+	{ kScNameSetGlobalMusicVolume, "SetGlobalMusicVolume" },
+	{ kScNameSetGlobalSFXVolume, "SetGlobalSFXVolume" },
+	{ kScNameSetGlobalSpeechVolume, "SetGlobalSpeechVolume" },
+	{ kScNameSetHours, "SetHours" },
+	{ kScNameSetHoverCursor, "SetHoverCursor" },
+	{ kScNameSetHoverFont, "SetHoverFont" },
+	{ kScNameSetHoverImage, "SetHoverImage" },
+	{ kScNameSetHoverSprite, "SetHoverSprite" },
+	{ kScNameSetImage, "SetImage" },
+	{ kScNameSetInactiveFont, "SetInactiveFont" },
+	{ kScNameSetInactiveImage, "SetInactiveImage" },
+	{ kScNameSetInt, "SetInt" },
+	{ kScNameSetLoadingScreen, "SetLoadingScreen" },
+	{ kScNameSetLong, "SetLong" },
+	{ kScNameSetMinutes, "SetMinutes" },
+	{ kScNameSetMonth, "SetMonth" },
+	{ kScNameSetMousePos, "SetMousePos" },
+	{ kScNameSetMusicChannelPosition, "SetMusicChannelPosition" },
+	{ kScNameSetMusicChannelVolume, "SetMusicChannelVolume" },
+	{ kScNameSetMusicPosition, "SetMusicPosition" },
+	{ kScNameSetMusicPositionChannel, "SetMusicPositionChannel" },
+	{ kScNameSetMusicVolume, "SetMusicVolume" },
+	{ kScNameSetNormalCursor, "SetNormalCursor" },
+	{ kScNameSetPoint, "SetPoint" },
+	{ kScNameSetPointer, "SetPointer" },
+	{ kScNameSetPosition, "SetPosition" },
+	{ kScNameSetPressedFont, "SetPressedFont" },
+	{ kScNameSetPressedImage, "SetPressedImage" },
+	{ kScNameSetSavingScreen, "SetSavingScreen" },
+	{ kScNameSetSceneViewport, "SetSceneViewport" },
+	{ kScNameSetSeconds, "SetSeconds" },
+	{ kScNameSetSelectedFont, "SetSelectedFont" },
+	{ kScNameSetShort, "SetShort" },
+	{ kScNameSetSize, "SetSize" },
+	{ kScNameSetSound, "SetSound" },
+	{ kScNameSetSoundPosition, "SetSoundPosition" },
+	{ kScNameSetSoundVolume, "SetSoundVolume" },
+	{ kScNameSetSprite, "SetSprite" },
+	{ kScNameSetString, "SetString" },
+	{ kScNameSetTalkSprite, "SetTalkSprite" },
+	{ kScNameSetViewport, "SetViewport" },
+	{ kScNameSetWaitCursor, "SetWaitCursor" },
+	{ kScNameSetYear, "SetYear" },
+	{ kScNameShowStatusLine, "ShowStatusLine" },
+	{ kScNameSin, "Sin" },
+	{ kScNameSinh, "Sinh" },
+	{ kScNameSize, "Size" },
+	{ kScNameSizeToFit, "SizeToFit" },
+	{ kScNameSkipTo, "SkipTo" },
+	{ kScNameSmartItemCursor, "SmartItemCursor" },
+	{ kScNameSoundAvailable, "SoundAvailable" },
+	{ kScNameSoundBufferSize, "SoundBufferSize" },
+	{ kScNameSoundFXEcho, "SoundFXEcho" },
+	{ kScNameSoundFXNone, "SoundFXNone" },
+	{ kScNameSoundFXReverb, "SoundFXReverb" },
+	{ kScNameSoundPanning, "SoundPanning" },
+	{ kScNameSpeechVolume, "SpeechVolume" },
+	{ kScNameSplit, "Split" },
+	{ kScNameSqrt, "Sqrt" },
+	{ kScNameStart, "Start" },
+	{ kScNameStartDlgBranch, "StartDlgBranch" },
+	{ kScNameStartupScene, "StartupScene" },
+	{ kScNameStickToRegion, "StickToRegion" },
+	{ kScNameStop, "Stop" },
+	{ kScNameStopMusic, "StopMusic" },
+	{ kScNameStopMusicChannel, "StopMusicChannel" },
+	{ kScNameStopSound, "StopSound" },
+	{ kScNameStopTalk, "StopTalk" },
+	{ kScNameStopTalking, "StopTalking" },
+	{ kScNameStopTheora, "StopTheora" },
+	{ kScNameStore, "Store" },
+	{ kScNameStoreSaveThumbnail, "StoreSaveThumbnail" },
+	{ kScNameSubstr, "Substr" },
+	{ kScNameSubstring, "Substring" },
+	{ kScNameSubtitles, "Subtitles" },
+	{ kScNameSubtitlesPosRelative, "SubtitlesPosRelative" },
+	{ kScNameSubtitlesPosX, "SubtitlesPosX" },
+	{ kScNameSubtitlesPosXCenter, "SubtitlesPosXCenter" },
+	{ kScNameSubtitlesPosY, "SubtitlesPosY" },
+	{ kScNameSubtitlesSpeed, "SubtitlesSpeed" },
+	{ kScNameSubtitlesWidth, "SubtitlesWidth" },
+	{ kScNameSubtype, "Subtype" },
+	{ kScNameSuppressScriptErrors, "SuppressScriptErrors" },
+	{ kScNameSuspendedRendering, "SuspendedRendering" },
+	{ kScNameSystemExclusive, "SystemExclusive" },
+	{ kScNameSystemFadeIn, "SystemFadeIn" },
+	{ kScNameSystemFadeInAsync, "SystemFadeInAsync" },
+	{ kScNameSystemFadeOut, "SystemFadeOut" },
+	{ kScNameSystemFadeOutAsync, "SystemFadeOutAsync" },
+	{ kScNameTakeItem, "TakeItem" },
+	{ kScNameTalk, "Talk" },
+	{ kScNameTalkAnimName, "TalkAnimName" },
+	{ kScNameTalkAsync, "TalkAsync" },
+	{ kScNameTalkSkipButton, "TalkSkipButton" },
+	{ kScNameTan, "Tan" },
+	{ kScNameTanh, "Tanh" },
+	{ kScNameText, "Text" },
+	{ kScNameTextAlign, "TextAlign" },
+	{ kScNameTextEncoding, "TextEncoding" },
+	{ kScNameTextMode, "TextMode" },
+	{ kScNameTextRTL, "TextRTL" },
+	{ kScNameToLowerCase, "ToLowerCase" },
+	{ kScNameToUpperCase, "ToUpperCase" },
+	{ kScNameTotalNumItems, "TotalNumItems" },
+	{ kScNameTransparent, "Transparent" },
+	{ kScNameTransparentColor, "TransparentColor" },
+	{ kScNameTurnLeftAnimName, "TurnLeftAnimName" },
+	{ kScNameTurnRightAnimName, "TurnRightAnimName" },
+	{ kScNameTurnTo, "TurnTo" },
+	{ kScNameTurnToAsync, "TurnToAsync" },
+	{ kScNameType, "Type" },
+	{ kScNameUnloadActor, "UnloadActor" },
+	{ kScNameUnloadActor3D, "UnloadActor3D" },
+	{ kScNameUnloadAnim, "UnloadAnim" },
+	{ kScNameUnloadEntity, "UnloadEntity" },
+	{ kScNameUnloadObject, "UnloadObject" },
+	{ kScNameUseRegion, "UseRegion" },
+	{ kScNameValidObject, "ValidObject" },
+	{ kScNameVelocity1, "Velocity1" },
+	{ kScNameVelocity2, "Velocity2" },
+	{ kScNameVelocityZBased, "VelocityZBased" },
+	{ kScNameVerticalAlign, "VerticalAlign" },
+	{ kScNameVideoSubtitles, "VideoSubtitles" },
+	{ kScNameVisible, "Visible" },
+	{ kScNameWalkAnimName, "WalkAnimName" },
+	{ kScNameWalkToDirection, "WalkToDirection" },
+	{ kScNameWalkToX, "WalkToX" },
+	{ kScNameWalkToY, "WalkToY" },
+	{ kScNameWidth, "Width" },
+	{ kScNameWindowedMode, "WindowedMode" },
+	{ kScNameWindowsTime, "WindowsTime" },
+	{ kScNameWriteBool, "WriteBool" },
+	{ kScNameWriteByte, "WriteByte" },
+	{ kScNameWriteDouble, "WriteDouble" },
+	{ kScNameWriteFloat, "WriteFloat" },
+	{ kScNameWriteInt, "WriteInt" },
+	{ kScNameWriteLine, "WriteLine" },
+	{ kScNameWriteLong, "WriteLong" },
+	{ kScNameWriteShort, "WriteShort" },
+	{ kScNameWriteString, "WriteString" },
+	{ kScNameWriteText, "WriteText" },
+	{ kScNameX, "X" },
+	{ kScNameY, "Y" },
+	{ kScNameZoomable, "Zoomable" },
+};
+
+// Open addressing hash table of indices into scNames, 0 marks a free slot.
+// It's filled on the first lookup, a lookup hashes the name and then usually
+// compares it with only one entry.
+enum {
+	kScNameHashSize = 2048
+};
+
+static uint16 scNameHash[kScNameHashSize];
+static bool scNameHashBuilt = false;
+
+static void buildNameHash() {
+	assert(ARRAYSIZE(scNames) == kScNameCount - 1 && ARRAYSIZE(scNames) < kScNameHashSize / 2);
+
+	for (uint i = 0; i < ARRAYSIZE(scNames); i++) {
+		uint slot = Common::hashit(scNames[i].name) & (kScNameHashSize - 1);
+		while (scNameHash[slot]) {
+			slot = (slot + 1) & (kScNameHashSize - 1);
+		}
+		scNameHash[slot] = i + 1;
+	}
+	scNameHashBuilt = true;
+}
+
+ScNameId scGetNameId(const char *name) {
+	if (!scNameHashBuilt) {
+		buildNameHash();
+	}
+
+	uint slot = Common::hashit(name) & (kScNameHashSize - 1);
+	while (scNameHash[slot]) {
+		const ScNameEntry &entry = scNames[scNameHash[slot] - 1];
+		if (strcmp(entry.name, name) == 0) {
+			return entry.id;
+		}
+		slot = (slot + 1) & (kScNameHashSize - 1);
+	}
+	return kScNameUnknown;
+}
+
+} // end of namespace Wintermute
@@ -0,0 +1,673 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WINTERMUTE_SCRIPT_NAMES_H
+#define WINTERMUTE_SCRIPT_NAMES_H
+
+#include "common/str.h"
+
+namespace Wintermute {
+
+// Names of the methods and properties of the scriptable objects. Every
+// scCallMethod(), scGetProperty() and scSetProperty() looks up the name once
+// and switches on its id, instead of comparing it with every name it knows
+// about. Add new names in alphabetical order, also to the table in
+// script_names.cpp.
+enum ScNameId {
+	kScNameUnknown = 0,
+	kScNameAbs,
+	kScNameAccCaption,
+	kScNameAccKeyboardCursorSkip,
+	kScNameAccKeyboardEnabled,
+	kScNameAccKeyboardPause,
+	kScNameAccOutputText,
+	kScNameAccTTSCaptions,
+	kScNameAccTTSEnabled,
+	kScNameAccTTSKeypress,
+	kScNameAccTTSTalk,
+	kScNameAccelerated,
+	kScNameAcceleratedMode,
+	kScNameAccessMode,
+	kScNameAcos,
+	kScNameActive,
+	kScNameActiveObject,
+	kScNameAddAttachment,
+	kScNameAddEntity,
+	kScNameAddEvent,
+	kScNameAddFrame,
+	kScNameAddGlobalForce,
+	kScNameAddLayer,
+	kScNameAddPoint,
+	kScNameAddPointForce,
+	kScNameAddRegion,
+	kScNameAddResponse,
+	kScNameAddResponseOnce,
+	kScNameAddResponseOnceGame,
+	kScNameAddSpeechDir,
+	kScNameAddSprite,
+	kScNameAddSubframe,
+	kScNameAddTalkSprite,
+	kScNameAlpha1,
+	kScNameAlpha2,
+	kScNameAlphaColor,
+	kScNameAlphaTimeBased,
+	kScNameAmount,
+	kScNameAmountAlign,
+	kScNameAmountOffsetX,
+	kScNameAmountOffsetY,
+	kScNameAmountString,
+	kScNameAngVelocity1,
+	kScNameAngVelocity2,
+	kScNameAngle1,
+	kScNameAngle2,
+	kScNameApplyEvent,
+	kScNameAsin,
+	kScNameAtan,
+	kScNameAtan2,
+	kScNameAttachScript,
+	kScNameAutoSaveOnExit,
+	kScNameAutoSaveSlot,
+	kScNameAutoScroll,
+	kScNameAutorunDisabled,
+	kScNameBlendMode,
+	kScNameBlocked,
+	kScNameCanHandleEvent,
+	kScNameCanHandleMethod,
+	kScNameCapacity,
+	kScNameCaption,
+	kScNameCeil,
+	kScNameCenter,
+	kScNameChangeScene,
+	kScNameChangingScene,
+	kScNameClearResponses,
+	kScNameClearScriptCache,
+	kScNameClipContents,
+	kScNameClose,
+	kScNameCloseUp,
+	kScNameColorable,
+	kScNameCopy,
+	kScNameCos,
+	kScNameCosh,
+	kScNameCreateButton,
+	kScNameCreateEditor,
+	kScNameCreateEntity,
+	kScNameCreateItem,
+	kScNameCreateParticleEmitter,
+	kScNameCreateRegion,
+	kScNameCreateStatic,
+	kScNameCreateWindow,
+	kScNameCurrentFrame,
+	kScNameCurrentTime,
+	kScNameCursorBlinkRate,
+	kScNameCursorChar,
+	kScNameCursorCombined,
+	kScNameCursorHidden,
+	kScNameDEBUG_CrashMe,
+	kScNameDEBUG_Dump,
+	kScNameDEBUG_DumpClassRegistry,
+	kScNameDebugMode,
+	kScNameDecoration,
+	kScNameDegToRad,
+	kScNameDelay,
+	kScNameDelete,
+	kScNameDeleteButton,
+	kScNameDeleteControl,
+	kScNameDeleteEditor,
+	kScNameDeleteEntity,
+	kScNameDeleteEvent,
+	kScNameDeleteFrame,
+	kScNameDeleteItem,
+	kScNameDeleteLayer,
+	kScNameDeleteNode,
+	kScNameDeleteParticleEmitter,
+	kScNameDeleteRegion,
+	kScNameDeleteSaveThumbnail,
+	kScNameDeleteStatic,
+	kScNameDeleteSubframe,
+	kScNameDeleteWindow,
+	kScNameDetachScript,
+	kScNameDeviceType,
+	kScNameDirection,
+	kScNameDisableScriptProfiling,
+	kScNameDisabled,
+	kScNameDisplayAmount,
+	kScNameDisplayLoadingIcon,
+	kScNameDropItem,
+	kScNameDumpTextureStats,
+	kScNameEmitEvent,
+	kScNameEmptySaveSlot,
+	kScNameEnableScriptProfiling,
+	kScNameEndDlgBranch,
+	kScNameExclusive,
+	kScNameExp,
+	kScNameExpandString,
+	kScNameExponentialGrowth,
+	kScNameFPS,
+	kScNameFadeColor,
+	kScNameFadeIn,
+	kScNameFadeInAsync,
+	kScNameFadeInTime,
+	kScNameFadeOut,
+	kScNameFadeOutAsync,
+	kScNameFadeOutTime,
+	kScNameFileExists,
+	kScNameFilename,
+	kScNameFinished,
+	kScNameFloor,
+	kScNameFocus,
+	kScNameFocusable,
+	kScNameForceTalkAnim,
+	kScNameFrameWidth,
+	kScNameFreezable,
+	kScNameFrozen,
+	kScNameGenerationAmount,
+	kScNameGenerationInterval,
+	kScNameGetActiveCursor,
+	kScNameGetActiveCursorObject,
+	kScNameGetAttachment,
+	kScNameGetBool,
+	kScNameGetByte,
+	kScNameGetControl,
+	kScNameGetCurrentDlgBranch,
+	kScNameGetCursor,
+	kScNameGetCursorObject,
+	kScNameGetDate,
+	kScNameGetDisabledImage,
+	kScNameGetDisabledImageObject,
+	kScNameGetDouble,
+	kScNameGetEntity,
+	kScNameGetEvent,
+	kScNameGetFadeColor,
+	kScNameGetFileChecksum,
+	kScNameGetFloat,
+	kScNameGetFocusedImage,
+	kScNameGetFocusedImageObject,
+	kScNameGetFont,
+	kScNameGetFrame,
+	kScNameGetFreeNode,
+	kScNameGetGlobalMasterVolume,
+	kScNameGetGlobalMusicVolume,
+	kScNameGetGlobalSFXVolume,
+	kScNameGetGlobalSpeechVolume,
+	kScNameGetHours,
+	kScNameGetHoverCursor,
+	kScNameGetHoverCursorObject,
+	kScNameGetHoverImage,
+	kScNameGetHoverImageObject,
+	kScNameGetHoverSprite,
+	kScNameGetHoverSpriteObject,
+	kScNameGetImage,
+	kScNameGetImageObject,
+	kScNameGetInactiveImage,
+	kScNameGetInactiveImageObject,
+	kScNameGetInt,
+	kScNameGetInventoryWindow,
+	kScNameGetItem,
+	kScNameGetLayer,
+	kScNameGetLong,
+	kScNameGetMinutes,
+	kScNameGetMonth,
+	kScNameGetMusic,
+	kScNameGetMusicChannel,
+	kScNameGetMusicChannelPosition,
+	kScNameGetMusicChannelVolume,
+	kScNameGetMusicPosition,
+	kScNameGetMusicVolume,
+	kScNameGetNode,
+	kScNameGetNormalCursor,
+	kScNameGetNormalCursorObject,
+	kScNameGetNumResponses,
+	kScNameGetPoint,
+	kScNameGetPointer,
+	kScNameGetPressedImage,
+	kScNameGetPressedImageObject,
+	kScNameGetRegionAt,
+	kScNameGetResponse,
+	kScNameGetResponseWindow,
+	kScNameGetResponsesWindow,
+	kScNameGetRotationAt,
+	kScNameGetSaveSlotDescription,
+	kScNameGetScaleAt,
+	kScNameGetSeconds,
+	kScNameGetShort,
+	kScNameGetSound,
+	kScNameGetSoundLength,
+	kScNameGetSoundPosition,
+	kScNameGetSoundVolume,
+	kScNameGetSprite,
+	kScNameGetSpriteObject,
+	kScNameGetString,
+	kScNameGetSubframe,
+	kScNameGetWaitCursor,
+	kScNameGetWaitCursorObject,
+	kScNameGetWaypointGroup,
+	kScNameGetWeekday,
+	kScNameGetWidget,
+	kScNameGetYear,
+	kScNameGoExclusive,
+	kScNameGoSystemExclusive,
+	kScNameGoTo,
+	kScNameGoToAsync,
+	kScNameGoToObject,
+	kScNameGoToObjectAsync,
+	kScNameGrowthRate1,
+	kScNameGrowthRate2,
+	kScNameHasActiveCursor,
+	kScNameHasAnim,
+	kScNameHasCursor,
+	kScNameHasItem,
+	kScNameHeight,
+	kScNameHeightToFit,
+	kScNameHideLoadingIcon,
+	kScNameHideStatusLine,
+	kScNameHotspotX,
+	kScNameHotspotY,
+	kScNameHwnd,
+	kScNameIdleAnimName,
+	kScNameIgnoreItems,
+	kScNameInGame,
+	kScNameIndexOf,
+	kScNameInsertEntity,
+	kScNameInsertFrame,
+	kScNameInsertLayer,
+	kScNameInsertPoint,
+	kScNameInsertRegion,
+	kScNameInsertSubframe,
+	kScNameInteractive,
+	kScNameInventoryObject,
+	kScNameInventoryScrollOffset,
+	kScNameInventoryVisible,
+	kScNameIs2DOnly,
+	kScNameIs3DOnly,
+	kScNameIsAlt,
+	kScNameIsBlockedAt,
+	kScNameIsControl,
+	kScNameIsItemTaken,
+	kScNameIsKeyDown,
+	kScNameIsMusicChannelPlaying,
+	kScNameIsMusicPlaying,
+	kScNameIsPointInViewport,
+	kScNameIsSaveSlotUsed,
+	kScNameIsScriptRunning,
+	kScNameIsScrolling,
+	kScNameIsShift,
+	kScNameIsSoundPlaying,
+	kScNameIsTalking,
+	kScNameIsTheoraPaused,
+	kScNameIsTheoraPlaying,
+	kScNameIsWalkableAt,
+	kScNameIsWalking,
+	kScNameItem,
+	kScNameKey,
+	kScNameKeyCode,
+	kScNameKeyboard,
+	kScNameKeyframe,
+	kScNameKillSounds,
+	kScNameLOG,
+	kScNameLastResponse,
+	kScNameLastResponseOrig,
+	kScNameLength,
+	kScNameLifeTime1,
+	kScNameLifeTime2,
+	kScNameLifeTimeZBased,
+	kScNameLoadActor,
+	kScNameLoadEntity,
+	kScNameLoadFromFile,
+	kScNameLoadGame,
+	kScNameLoadInventoryBox,
+	kScNameLoadItems,
+	kScNameLoadResponseBox,
+	kScNameLoadSound,
+	kScNameLoadStringTable,
+	kScNameLoadWindow,
+	kScNameLockMouseRect,
+	kScNameLog,
+	kScNameLog10,
+	kScNameLooping,
+	kScNameMain,
+	kScNameMainLayer,
+	kScNameMainObject,
+	kScNameMasterVolume,
+	kScNameMaxBatches,
+	kScNameMaxLength,
+	kScNameMaxParticles,
+	kScNameMenu,
+	kScNameMergeAnims,
+	kScNameMirrorX,
+	kScNameMirrorY,
+	kScNameMostRecentSaveSlot,
+	kScNameMouseX,
+	kScNameMouseY,
+	kScNameMovable,
+	kScNameMoveAfter,
+	kScNameMoveBefore,
+	kScNameMoveToBottom,
+	kScNameMoveToTop,
+	kScNameMoveX,
+	kScNameMoveY,
+	kScNameMsg,
+	kScNameMusicCrossfade,
+	kScNameMusicVolume,
+	kScNameName,
+	kScNameNextSibling,
+	kScNameNonIntMouseEvents,
+	kScNameNumAttachments,
+	kScNameNumControls,
+	kScNameNumEvents,
+	kScNameNumFrames,
+	kScNameNumFreeNodes,
+	kScNameNumItems,
+	kScNameNumLayers,
+	kScNameNumLiveParticles,
+	kScNameNumNodes,
+	kScNameNumPoints,
+	kScNameNumSubframes,
+	kScNameNumWaypointGroups,
+	kScNameNumWidgets,
+	kScNameOffsetX,
+	kScNameOffsetY,
+	kScNameOpenAsBinary,
+	kScNameOpenAsText,
+	kScNameOpenDocument,
+	kScNameOwner,
+	kScNamePI,
+	kScNameParent,
+	kScNameParentNotify,
+	kScNameParticleEmitter,
+	kScNamePause,
+	kScNamePauseMusic,
+	kScNamePauseMusicChannel,
+	kScNamePauseSound,
+	kScNamePauseTheora,
+	kScNamePaused,
+	kScNamePersistentState,
+	kScNamePersistentStateSprites,
+	kScNamePixelPerfect,
+	kScNamePlatform,
+	kScNamePlay,
+	kScNamePlayAnim,
+	kScNamePlayAnimAsync,
+	kScNamePlayMusic,
+	kScNamePlayMusicChannel,
+	kScNamePlaySound,
+	kScNamePlaySoundEvent,
+	kScNamePlayTheora,
+	kScNamePlayVideo,
+	kScNamePop,
+	kScNamePosition,
+	kScNamePow,
+	kScNamePress,
+	kScNamePressed,
+	kScNamePrevScene,
+	kScNamePrevSceneFilename,
+	kScNamePrevSibling,
+	kScNamePreviousScene,
+	kScNamePreviousSceneFilename,
+	kScNamePrintable,
+	kScNamePush,
+	kScNameQueryItem,
+	kScNameQuitGame,
+	kScNameRadToDeg,
+	kScNameReadBool,
+	kScNameReadByte,
+	kScNameReadDouble,
+	kScNameReadFloat,
+	kScNameReadInt,
+	kScNameReadLine,
+	kScNameReadLong,
+	kScNameReadShort,
+	kScNameReadString,
+	kScNameReadText,
+	kScNameReady,
+	kScNameRegReadNumber,
+	kScNameRegReadString,
+	kScNameRegWriteNumber,
+	kScNameRegWriteString,
+	kScNameRegion,
+	kScNameRegistrable,
+	kScNameRelativeRotate,
+	kScNameRelativeScale,
+	kScNameRemoveActiveCursor,
+	kScNameRemoveAttachment,
+	kScNameRemoveCursor,
+	kScNameRemoveForce,
+	kScNameRemovePoint,
+	kScNameRemoveSpeechDir,
+	kScNameRemoveSprite,
+	kScNameRemoveTalkSprite,
+	kScNameRemoveWaitCursor,
+	kScNameReset,
+	kScNameResetResponse,
+	kScNameResponsesVisible,
+	kScNameResume,
+	kScNameResumeMusic,
+	kScNameResumeMusicChannel,
+	kScNameResumeSound,
+	kScNameResumeTheora,
+	kScNameRotatable,
+	kScNameRotate,
+	kScNameRotation1,
+	kScNameRotation2,
+	kScNameRunScript,
+	kScNameSFXVolume,
+	kScNameSaveDirectory,
+	kScNameSaveGame,
+	kScNameSaveState,
+	kScNameScalable,
+	kScNameScale,
+	kScNameScale1,
+	kScNameScale2,
+	kScNameScaleX,
+	kScNameScaleY,
+	kScNameScaleZBased,
+	kScNameScene,
+	kScNameSceneIndependent,
+	kScNameScreenHeight,
+	kScNameScreenWidth,
+	kScNameScreenshot,
+	kScNameScreenshotEx,
+	kScNameScrollPixelsX,
+	kScNameScrollPixelsY,
+	kScNameScrollSpeedX,
+	kScNameScrollSpeedY,
+	kScNameScrollTo,
+	kScNameScrollToAsync,
+	kScNameSelEnd,
+	kScNameSelStart,
+	kScNameSelectedItem,
+	kScNameSetActiveCursor,
+	kScNameSetBool,
+	kScNameSetBorder,
+	kScNameSetBorderThickness,
+	kScNameSetByte,
+	kScNameSetCaption,
+	kScNameSetCurrentTime,
+	kScNameSetCursor,
+	kScNameSetDate,
+	kScNameSetDisabledFont,
+	kScNameSetDisabledImage,
+	kScNameSetDouble,
+	kScNameSetEntity,
+	kScNameSetFilename,
+	kScNameSetFloat,
+	kScNameSetFocusedFont,
+	kScNameSetFocusedImage,
+	kScNameSetFont,
+	kScNameSetGlobalMasterVolume,
+	kScNameSetGlobalMusicVolume,
+	kScNameSetGlobalSFXVolume,
+	kScNameSetGlobalSpeechVolume,
+	kScNameSetHours,
+	kScNameSetHoverCursor,
+	kScNameSetHoverFont,
+	kScNameSetHoverImage,
+	kScNameSetHoverSprite,
+	kScNameSetImage,
+	kScNameSetInactiveFont,
+	kScNameSetInactiveImage,
+	kScNameSetInt,
+	kScNameSetLoadingScreen,
+	kScNameSetLong,
+	kScNameSetMinutes,
+	kScNameSetMonth,
+	kScNameSetMousePos,
+	kScNameSetMusicChannelPosition,
+	kScNameSetMusicChannelVolume,
+	kScNameSetMusicPosition,
+	kScNameSetMusicPositionChannel,
+	kScNameSetMusicVolume,
+	kScNameSetNormalCursor,
+	kScNameSetPoint,
+	kScNameSetPointer,
+	kScNameSetPosition,
+	kScNameSetPressedFont,
+	kScNameSetPressedImage,
+	kScNameSetSavingScreen,
+	kScNameSetSceneViewport,
+	kScNameSetSeconds,
+	kScNameSetSelectedFont,
+	kScNameSetShort,
+	kScNameSetSize,
+	kScNameSetSound,
+	kScNameSetSoundPosition,
+	kScNameSetSoundVolume,
+	kScNameSetSprite,
+	kScNameSetString,
+	kScNameSetTalkSprite,
+	kScNameSetViewport,
+	kScNameSetWaitCursor,
+	kScNameSetYear,
+	kScNameShowStatusLine,
+	kScNameSin,
+	kScNameSinh,
+	kScNameSize,
+	kScNameSizeToFit,
+	kScNameSkipTo,
+	kScNameSmartItemCursor,
+	kScNameSoundAvailable,
+	kScNameSoundBufferSize,
+	kScNameSoundFXEcho,
+	kScNameSoundFXNone,
+	kScNameSoundFXReverb,
+	kScNameSoundPanning,
+	kScNameSpeechVolume,
+	kScNameSplit,
+	kScNameSqrt,
+	kScNameStart,
+	kScNameStartDlgBranch,
+	kScNameStartupScene,
+	kScNameStickToRegion,
+	kScNameStop,
+	kScNameStopMusic,
+	kScNameStopMusicChannel,
+	kScNameStopSound,
+	kScNameStopTalk,
+	kScNameStopTalking,
+	kScNameStopTheora,
+	kScNameStore,
+	kScNameStoreSaveThumbnail,
+	kScNameSubstr,
+	kScNameSubstring,
+	kScNameSubtitles,
+	kScNameSubtitlesPosRelative,
+	kScNameSubtitlesPosX,
+	kScNameSubtitlesPosXCenter,
+	kScNameSubtitlesPosY,
+	kScNameSubtitlesSpeed,
+	kScNameSubtitlesWidth,
+	kScNameSubtype,
+	kScNameSuppressScriptErrors,
+	kScNameSuspendedRendering,
+	kScNameSystemExclusive,
+	kScNameSystemFadeIn,
+	kScNameSystemFadeInAsync,
+	kScNameSystemFadeOut,
+	kScNameSystemFadeOutAsync,
+	kScNameTakeItem,
+	kScNameTalk,
+	kScNameTalkAnimName,
+	kScNameTalkAsync,
+	kScNameTalkSkipButton,
+	kScNameTan,
+	kScNameTanh,
+	kScNameText,
+	kScNameTextAlign,
+	kScNameTextEncoding,
+	kScNameTextMode,
+	kScNameTextRTL,
+	kScNameToLowerCase,
+	kScNameToUpperCase,
+	kScNameTotalNumItems,
+	kScNameTransparent,
+	kScNameTransparentColor,
+	kScNameTurnLeftAnimName,
+	kScNameTurnRightAnimName,
+	kScNameTurnTo,
+	kScNameTurnToAsync,
+	kScNameType,
+	kScNameUnloadActor,
+	kScNameUnloadActor3D,
+	kScNameUnloadAnim,
+	kScNameUnloadEntity,
+	kScNameUnloadObject,
+	kScNameUseRegion,
+	kScNameValidObject,
+	kScNameVelocity1,
+	kScNameVelocity2,
+	kScNameVelocityZBased,
+	kScNameVerticalAlign,
+	kScNameVideoSubtitles,
+	kScNameVisible,
+	kScNameWalkAnimName,
+	kScNameWalkToDirection,
+	kScNameWalkToX,
+	kScNameWalkToY,
+	kScNameWidth,
+	kScNameWindowedMode,
+	kScNameWindowsTime,
+	kScNameWriteBool,
+	kScNameWriteByte,
+	kScNameWriteDouble,
+	kScNameWriteFloat,
+	kScNameWriteInt,
+	kScNameWriteLine,
+	kScNameWriteLong,
+	kScNameWriteShort,
+	kScNameWriteString,
+	kScNameWriteText,
+	kScNameX,
+	kScNameY,
+	kScNameZoomable,
+
+	kScNameCount
+};
+
+// Returns kScNameUnknown for names no scriptable object knows about
+ScNameId scGetNameId(const char *name);
+
+inline ScNameId scGetNameId(const Common::String &name) {
+	return scGetNameId(name.c_str());
+}
+
+} // end of namespace Wintermute
+
+#endif
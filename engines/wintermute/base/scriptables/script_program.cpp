@@ -0,0 +1,232 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/wintermute/base/scriptables/script_program.h"
+#include "engines/wintermute/base/scriptables/dcscript.h"
+#include "common/endian.h"
+#include "common/util.h"
+
+namespace Wintermute {
+
+//////////////////////////////////////////////////////////////////////////
+ScProgram::ScProgram(const byte *buffer, uint32 size) {
+	_buffer = new byte[size];
+	memcpy(_buffer, buffer, size);
+	_size = size;
+
+	if (!decode()) {
+		_code.clear();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+ScProgram::~ScProgram() {
+	delete[] _buffer;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool ScProgram::hasSymbolOperand(uint32 inst) {
+	switch (inst) {
+	case II_DEF_VAR:
+	case II_DEF_GLOB_VAR:
+	case II_DEF_CONST_VAR:
+	case II_EXTERNAL_CALL:
+	case II_PUSH_VAR:
+	case II_PUSH_VAR_REF:
+	case II_POP_VAR:
+	case II_PUSH_THIS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool ScProgram::decodeInstruction(const byte *buffer, uint32 size, uint32 offset, Instruction &instr) {
+	if (offset + 4 > size) {
+		return false;
+	}
+
+	instr.offset = offset;
+	instr.inst = READ_LE_UINT32(buffer + offset);
+	instr.dw = 0;
+	instr.target = -1;
+	instr.f = 0.0;
+	instr.str = NULL;
+	instr.key = NULL;
+	offset += 4;
+
+	switch (instr.inst) {
+	case II_PUSH_FLOAT: {
+		if (offset + 8 > size) {
+			return false;
+		}
+
+		byte value[8];
+		memcpy(value, buffer + offset, 8);
+#ifdef SCUMM_BIG_ENDIAN
+		SWAP(value[0], value[7]);
+		SWAP(value[1], value[6]);
+		SWAP(value[2], value[5]);
+		SWAP(value[3], value[4]);
+#endif
+		memcpy(&instr.f, value, 8);
+		offset += 8;
+		break;
+	}
+
+	case II_PUSH_STRING: {
+		instr.str = (const char *)buffer + offset;
+		while (offset < size && buffer[offset] != '\0') {
+			offset++;
+		}
+		if (offset == size) {
+			return false;
+		}
+		offset++;
+		break;
+	}
+
+	case II_CALL:
+	case II_CORRECT_STACK:
+	case II_PUSH_INT:
+	case II_PUSH_BOOL:
+	case II_JMP:
+	case II_JMP_FALSE:
+	case II_DBG_LINE:
+		if (offset + 4 > size) {
+			return false;
+		}
+		instr.dw = READ_LE_UINT32(buffer + offset);
+		offset += 4;
+		break;
+
+	default:
+		if (hasSymbolOperand(instr.inst)) {
+			if (offset + 4 > size) {
+				return false;
+			}
+			instr.dw = READ_LE_UINT32(buffer + offset);
+			offset += 4;
+		}
+		break;
+	}
+
+	instr.next = offset;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool ScProgram::decode() {
+	if (_size < 32 || READ_LE_UINT32(_buffer) != SCRIPT_MAGIC) {
+		return false;
+	}
+
+	// The code is followed by the tables
+	const uint32 codeStart = READ_LE_UINT32(_buffer + 8);
+	const uint32 symbolTable = READ_LE_UINT32(_buffer + 16);
+	uint32 codeEnd = _size;
+	for (int i = 3; i < 8; i++) {
+		uint32 table = READ_LE_UINT32(_buffer + i * 4);
+		if (table > codeStart && table < codeEnd) {
+			codeEnd = table;
+		}
+	}
+
+	if (symbolTable + 4 > _size) {
+		return false;
+	}
+
+	// Symbol names get built only once, before anything points to them
+	uint32 numSymbols = READ_LE_UINT32(_buffer + symbolTable);
+	uint32 offset = symbolTable + 4;
+	if (numSymbols > _size) {
+		return false;
+	}
+	_symbols.resize(numSymbols);
+	for (uint32 i = 0; i < numSymbols; i++) {
+		if (offset + 4 > _size) {
+			return false;
+		}
+		uint32 index = READ_LE_UINT32(_buffer + offset);
+		offset += 4;
+
+		const char *name = (const char *)_buffer + offset;
+		while (offset < _size && _buffer[offset] != '\0') {
+			offset++;
+		}
+		if (offset == _size || index >= numSymbols) {
+			return false;
+		}
+		offset++;
+
+		_symbols[index] = name;
+	}
+
+	offset = codeStart;
+	while (offset < codeEnd) {
+		Instruction instr;
+		if (!decodeInstruction(_buffer, codeEnd, offset, instr) || instr.inst > II_DEF_CONST_VAR) {
+			return false;
+		}
+
+		if (hasSymbolOperand(instr.inst)) {
+			if (instr.dw >= numSymbols) {
+				return false;
+			}
+			instr.str = _symbols[instr.dw].c_str();
+			instr.key = &_symbols[instr.dw];
+		}
+
+		_code.push_back(instr);
+		offset = instr.next;
+	}
+
+	for (uint32 i = 0; i < _code.size(); i++) {
+		if (_code[i].inst == II_JMP || _code[i].inst == II_JMP_FALSE || _code[i].inst == II_CALL) {
+			_code[i].target = findInstruction(_code[i].dw);
+		}
+	}
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+int32 ScProgram::findInstruction(uint32 offset) const {
+	uint32 low = 0;
+	uint32 high = _code.size();
+	while (low < high) {
+		uint32 middle = (low + high) / 2;
+		if (_code[middle].offset < offset) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	if (low < _code.size() && _code[low].offset == offset) {
+		return low;
+	}
+	return -1;
+}
+
+} // end of namespace Wintermute
@@ -0,0 +1,88 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WINTERMUTE_SCPROGRAM_H
+#define WINTERMUTE_SCPROGRAM_H
+
+#include "common/array.h"
+#include "common/noncopyable.h"
+#include "common/ptr.h"
+#include "common/str.h"
+
+namespace Wintermute {
+
+// The code of a compiled script, decoded once when the script is loaded, so
+// running it doesn't have to read the operands from the byte code again.
+// Decoded instructions keep their byte code offsets, everything that stores
+// instruction pointers (saved games, call stacks, event tables) still uses
+// those.
+class ScProgram : Common::NonCopyable {
+public:
+	struct Instruction {
+		uint32 offset;	// of the instruction in the byte code
+		uint32 next;	// offset of the instruction following it
+		uint32 inst;
+		uint32 dw;		// integer operand, symbol index or jump target
+		int32 target;	// index of the jump target, -1 if not decoded
+		double f;
+		const char *str;	// string operand or symbol name
+		const Common::String *key;	// symbol name, to look variables up with
+	};
+
+	ScProgram(const byte *buffer, uint32 size);
+	~ScProgram();
+
+	bool isValid() const {
+		return !_code.empty();
+	}
+
+	// Returns the index of the instruction at the given offset, -1 if
+	// there is none
+	int32 findInstruction(uint32 offset) const;
+
+	const Instruction &operator[](uint32 index) const {
+		return _code[index];
+	}
+
+	uint32 size() const {
+		return _code.size();
+	}
+
+	// Decodes a single instruction, without resolving symbols. Used for
+	// running code which couldn't be decoded up front.
+	static bool decodeInstruction(const byte *buffer, uint32 size, uint32 offset, Instruction &instr);
+	static bool hasSymbolOperand(uint32 inst);
+
+private:
+	bool decode();
+
+	byte *_buffer;
+	uint32 _size;
+	Common::Array<Instruction> _code;
+	Common::Array<Common::String> _symbols;
+};
+
+typedef Common::SharedPtr<ScProgram> ScProgramPtr;
+
+} // end of namespace Wintermute
+
+#endif
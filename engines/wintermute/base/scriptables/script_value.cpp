@@ -270,6 +270,25 @@ bool ScValue::propExists(const char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const Common::String &name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+
+	_valIter = _valObject.find(name);
+	if (_valIter == _valObject.end()) {
+		return NULL;
+	}
+
+	// natives and strings may provide the property themselves
+	if (_type == VAL_NATIVE || _type == VAL_STRING) {
+		return getProp(name.c_str());
+	}
+	return _valIter->_value;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
 	_valIter = _valObject.begin();
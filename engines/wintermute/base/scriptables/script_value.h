@@ -53,6 +53,8 @@ public:
 	void setValue(ScValue *val);
 	bool _persistent;
 	bool propExists(const char *name);
+	// Same as getProp() if propExists(), NULL otherwise
+	ScValue *findProp(const Common::String &name);
 	void copy(ScValue *orig, bool copyWhole = false);
 	void setStringVal(const char *val);
 	TValType getType();
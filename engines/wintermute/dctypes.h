@@ -120,6 +120,14 @@ enum TUIObjectType {
 };
 
 
+enum TSurfacePriority {
+	SURFACE_PRIORITY_LOW = 0,
+	SURFACE_PRIORITY_NORMAL,
+	SURFACE_PRIORITY_VISIBLE,
+	NUM_SURFACE_PRIORITIES
+};
+
+
 enum TRendererState {
 	RSTATE_3D,
 	RSTATE_2D,
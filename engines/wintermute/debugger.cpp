@@ -0,0 +1,140 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "engines/wintermute/debugger.h"
+#include "engines/wintermute/wintermute.h"
+#include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/particles/part_emitter.h"
+
+namespace Wintermute {
+
+Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
+	DCmd_Register("script_bench",   WRAP_METHOD(Console, Cmd_ScriptBench));
+	DCmd_Register("seek_bench",     WRAP_METHOD(Console, Cmd_SeekBench));
+	DCmd_Register("particle_bench", WRAP_METHOD(Console, Cmd_ParticleBench));
+}
+
+Console::~Console() {
+}
+
+bool Console::Cmd_ScriptBench(int argc, const char **argv) {
+	if (argc != 1) {
+		DebugPrintf("Reads properties of the game object and shows how many calls per second the script dispatch manages\n");
+		DebugPrintf("Usage: %s\n", argv[0]);
+		return true;
+	}
+
+	BaseGame *game = _engineRef->_game;
+	if (!game) {
+		DebugPrintf("No game loaded\n");
+		return true;
+	}
+
+	// Handled by the different classes of the game object, the last one by
+	// none of them
+	static const char *const names[] = {
+		"Scene", "TotalNumItems", "MouseX", "Interactive", "X", "Caption", "NoSuchProperty"
+	};
+	const uint32 numCalls = 100000;
+
+	uint32 totalTime = 0;
+	for (uint i = 0; i < ARRAYSIZE(names); i++) {
+		const Common::String name(names[i]);
+		uint32 startTime = g_system->getMillis();
+		for (uint32 j = 0; j < numCalls; j++) {
+			game->scGetProperty(name);
+		}
+		uint32 time = MAX<uint32>(g_system->getMillis() - startTime, 1);
+		totalTime += time;
+
+		DebugPrintf("%-16s %u calls/s\n", names[i], numCalls * 1000 / time);
+	}
+	DebugPrintf("Overall          %u calls/s\n", ARRAYSIZE(names) * numCalls * 1000 / totalTime);
+	return true;
+}
+
+bool Console::Cmd_SeekBench(int argc, const char **argv) {
+	if (argc != 2) {
+		DebugPrintf("Reads a game file front to back, then seeks to random places in it, and shows the time taken\n");
+		DebugPrintf("Usage: %s <filename>\n", argv[0]);
+		return true;
+	}
+
+	BaseFileManager *fileManager = BaseFileManager::getEngineInstance();
+	Common::SeekableReadStream *file = fileManager ? fileManager->openFile(argv[1], true, false) : NULL;
+	if (!file) {
+		DebugPrintf("Can't open %s\n", argv[1]);
+		return true;
+	}
+
+	const uint32 numSeeks = 1000;
+	const uint32 readSize = 4096;
+	byte buffer[readSize];
+
+	// The first pass over the file is what a game would see, too
+	uint32 startTime = g_system->getMillis();
+	while (file->read(buffer, readSize) == readSize) {
+	}
+	uint32 readTime = g_system->getMillis() - startTime;
+
+	const uint32 range = MAX<int32>(file->size() - readSize, 1);
+	uint32 seed = 1;
+	startTime = g_system->getMillis();
+	for (uint32 i = 0; i < numSeeks; i++) {
+		seed = seed * 1103515245 + 12345;
+		file->seek((seed >> 8) % range, SEEK_SET);
+		file->read(buffer, readSize);
+	}
+	uint32 seekTime = g_system->getMillis() - startTime;
+
+	DebugPrintf("%d bytes read in %u ms\n", file->size(), readTime);
+	DebugPrintf("%u us per seek and read of %u bytes\n", seekTime * 1000 / numSeeks, readSize);
+	delete file;
+	return true;
+}
+
+bool Console::Cmd_ParticleBench(int argc, const char **argv) {
+	if (argc != 2) {
+		DebugPrintf("Runs a 5000 particle emitter of the given sprite for 2000 frames without drawing it\n");
+		DebugPrintf("Usage: %s <sprite filename>\n", argv[0]);
+		return true;
+	}
+
+	BaseGame *game = _engineRef->_game;
+	if (!game) {
+		DebugPrintf("No game loaded\n");
+		return true;
+	}
+
+	uint32 liveParticles, updatesPerMs;
+	if (!PartEmitter::benchmark(game, argv[1], liveParticles, updatesPerMs)) {
+		DebugPrintf("Can't load %s\n", argv[1]);
+		return true;
+	}
+
+	DebugPrintf("%u live particles on average, %u particle updates/ms\n", liveParticles, updatesPerMs);
+	return true;
+}
+
+} // End of namespace Wintermute
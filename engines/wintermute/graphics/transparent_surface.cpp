@@ -29,16 +29,59 @@
 
 namespace Wintermute {
 
-byte *TransparentSurface::_lookup = NULL;
+void AlphaSpans::build(const Graphics::Surface &surface) {
+	_spans.clear();
+	_rows.clear();
+	_width = surface.w;
+
+	if (surface.format.bytesPerPixel != 4) {
+		warning("AlphaSpans can only be built for 32 bpp images");
+		return;
+	}
+
+	_rows.reserve(surface.h + 1);
+	for (int y = 0; y < surface.h; y++) {
+		_rows.push_back(_spans.size());
+
+		const uint32 *in = (const uint32 *)surface.getBasePtr(0, y);
+		int x = 0;
+		while (x < surface.w) {
+			const uint32 a = in[x] >> 24;
+			if (a == 0) {
+				x++;
+				continue;
+			}
 
-void TransparentSurface::destroyLookup() {
-	delete _lookup;
-	_lookup = NULL;
+			Span span;
+			span.start = x;
+			span.opaque = (a == 255);
+			for (x++; x < surface.w; x++) {
+				const uint32 nextA = in[x] >> 24;
+				if (nextA == 0 || (nextA == 255) != span.opaque)
+					break;
+			}
+			span.length = x - span.start;
+			_spans.push_back(span);
+		}
+	}
+	_rows.push_back(_spans.size());
+}
+
+bool AlphaSpans::hasTransparency() const {
+	// An opaque surface has a single opaque span covering every row
+	if (_spans.size() != _rows.size() - 1)
+		return true;
+
+	for (uint i = 0; i < _spans.size(); i++) {
+		if (!_spans[i].opaque || _spans[i].length != _width)
+			return true;
+	}
+	return false;
 }
 
-TransparentSurface::TransparentSurface() : Surface(), _enableAlphaBlit(true) {}
+TransparentSurface::TransparentSurface() : Surface(), _enableAlphaBlit(true), _alphaSpans(NULL) {}
 
-TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Surface(), _enableAlphaBlit(true) {
+TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Surface(), _enableAlphaBlit(true), _alphaSpans(NULL) {
 	if (copyData) {
 		copyFrom(surf);
 	} else {
@@ -51,116 +94,70 @@ TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Sur
 }
 
 void doBlitOpaque(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
-	byte *in, *out;
-
-#ifdef SCUMM_LITTLE_ENDIAN
-	const int aIndex = 3;
-#else
-	const int aIndex = 0;
-#endif
-
 	for (uint32 i = 0; i < height; i++) {
-		out = outo;
-		in = ino;
-		memcpy(out, in, width * 4);
-		for (uint32 j = 0; j < width; j++) {
-			out[aIndex] = 0xFF;
-			out += 4;
-		}
+		uint32 *out = (uint32 *)outo;
+		memcpy(out, ino, width * 4);
+		for (uint32 j = 0; j < width; j++)
+			out[j] |= 0xFF000000;
 		outo += pitch;
 		ino += inoStep;
 	}
 }
 
-void TransparentSurface::generateLookup() {
-	_lookup = new byte[256 * 256];
-	for (int i = 0; i < 256; i++) {
-		for (int j = 0; j < 256; j++) {
-			_lookup[(i << 8) + j] = (i * j) >> 8;
-		}
-	}
-}
-
 void TransparentSurface::doBlitAlpha(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
-	byte *in, *out;
-
-	if (!_lookup) {
-		generateLookup();
-	}
-
-#ifdef SCUMM_LITTLE_ENDIAN
-	const int aIndex = 3;
-	const int bIndex = 0;
-	const int gIndex = 1;
-	const int rIndex = 2;
-#else
-	const int aIndex = 0;
-	const int bIndex = 3;
-	const int gIndex = 2;
-	const int rIndex = 1;
-#endif
-
-	const int bShift = 0;//img->format.bShift;
-	const int gShift = 8;//img->format.gShift;
-	const int rShift = 16;//img->format.rShift;
-	const int aShift = 24;//img->format.aShift;
-
-	const int bShiftTarget = 0;//target.format.bShift;
-	const int gShiftTarget = 8;//target.format.gShift;
-	const int rShiftTarget = 16;//target.format.rShift;
-
 	for (uint32 i = 0; i < height; i++) {
-		out = outo;
-		in = ino;
+		uint32 *out = (uint32 *)outo;
+		const byte *in = ino;
+
 		for (uint32 j = 0; j < width; j++) {
-			uint32 pix = *(uint32 *)in;
-			uint32 oPix = *(uint32 *) out;
-			int b = (pix >> bShift) & 0xff;
-			int g = (pix >> gShift) & 0xff;
-			int r = (pix >> rShift) & 0xff;
-			int a = (pix >> aShift) & 0xff;
-			int outb, outg, outr, outa;
+			const uint32 pix = *(const uint32 *)in;
+			const uint32 a = pix >> 24;
 			in += inStep;
 
-			switch (a) {
-				case 0: // Full transparency
-					out += 4;
-					break;
-				case 255: // Full opacity
-					outb = b;
-					outg = g;
-					outr = r;
-					outa = a;
-
-					out[aIndex] = outa;
-					out[bIndex] = outb;
-					out[gIndex] = outg;
-					out[rIndex] = outr;
-					out += 4;
-					break;
-
-				default: // alpha blending
-					outa = 255;
-
-					outb = _lookup[(((oPix >> bShiftTarget) & 0xff)) + ((255 - a) << 8)];
-					outg = _lookup[(((oPix >> gShiftTarget) & 0xff)) + ((255 - a) << 8)];
-					outr = _lookup[(((oPix >> rShiftTarget) & 0xff)) + ((255 - a) << 8)];
-					outb += _lookup[b + (a << 8)];
-					outg += _lookup[g + (a << 8)];
-					outr += _lookup[r + (a << 8)];
-
-					out[aIndex] = outa;
-					out[bIndex] = outb;
-					out[gIndex] = outg;
-					out[rIndex] = outr;
-					out += 4;
-			}
+			// Most pixels of sprites, glyphs and UI elements are either fully
+			// transparent or fully opaque, check for those first
+			if (a == 255)
+				*out = pix;
+			else if (a != 0)
+				*out = blendPixel(pix, *out);
+			out++;
 		}
 		outo += pitch;
 		ino += inoStep;
 	}
 }
 
+void TransparentSurface::doBlitSpans(byte *outo, uint32 dstPitch, int srcX, int srcY, int width, int height, int rowStep) const {
+	const int spanLeft = srcX + _alphaSpansOrigin.x;
+	const int spanRight = spanLeft + width;
+
+	for (int i = 0; i < height; i++) {
+		const int y = srcY + i * rowStep;
+		const int spanY = y + _alphaSpansOrigin.y;
+		const uint32 *in = (const uint32 *)getBasePtr(srcX, y);
+		uint32 *out = (uint32 *)outo;
+
+		// Transparent pixels lie between the spans and are never looked at
+		for (uint32 k = _alphaSpans->_rows[spanY]; k < _alphaSpans->_rows[spanY + 1]; k++) {
+			const AlphaSpans::Span &span = _alphaSpans->_spans[k];
+			if (span.start >= spanRight)
+				break;
+
+			const int start = MAX<int>(span.start, spanLeft) - spanLeft;
+			const int end = MIN<int>(span.start + span.length, spanRight) - spanLeft;
+			if (start >= end)
+				continue;
+
+			if (span.opaque) {
+				memcpy(out + start, in + start, (end - start) * 4);
+			} else {
+				for (int x = start; x < end; x++)
+					out[x] = blendPixel(in[x], out[x]);
+			}
+		}
+		outo += dstPitch;
+	}
+}
 
 Common::Rect TransparentSurface::blit(Graphics::Surface &target, int posX, int posY, int flipping, Common::Rect *pPartRect, uint color, int width, int height) {
 	int ca = (color >> 24) & 0xff;
@@ -229,6 +226,10 @@ Common::Rect TransparentSurface::blit(Graphics::Surface &target, int posX, int p
 		img = &srcImage;
 	}
 
+	// Where the visible part starts in this surface, for blitting by alpha spans
+	int srcX = (pPartRect ? pPartRect->left : 0) + (posX < 0 ? -posX : 0);
+	int srcY = (pPartRect ? pPartRect->top : 0) + (posY < 0 ? -posY : 0);
+
 	// Handle off-screen clipping
 	if (posY < 0) {
 		img->h = MAX(0, (int)img->h - -posY);
@@ -285,7 +286,14 @@ Common::Rect TransparentSurface::blit(Graphics::Surface &target, int posX, int p
 		const int rShiftTarget = 16;//target.format.rShift;
 
 		if (ca == 255 && cb == 255 && cg == 255 && cr == 255) {
-			if (_enableAlphaBlit) {
+			if (_enableAlphaBlit && _alphaSpans && !imgScaled && !(flipping & TransparentSurface::FLIP_V) &&
+			        _alphaSpansOrigin.y + srcY + img->h < (int)_alphaSpans->_rows.size()) {
+				if (flipping & TransparentSurface::FLIP_H) {
+					doBlitSpans(outo, target.pitch, srcX, srcY + img->h - 1, img->w, img->h, -1);
+				} else {
+					doBlitSpans(outo, target.pitch, srcX, srcY, img->w, img->h, 1);
+				}
+			} else if (_enableAlphaBlit) {
 				doBlitAlpha(ino, outo, img->w, img->h, target.pitch, inStep, inoStep);
 			} else {
 				doBlitOpaque(ino, outo, img->w, img->h, target.pitch, inStep, inoStep);
@@ -22,6 +22,8 @@
 #ifndef GRAPHICS_TRANSPARENTSURFACE_H
 #define GRAPHICS_TRANSPARENTSURFACE_H
 
+#include "common/array.h"
+#include "common/rect.h"
 #include "graphics/surface.h"
 
 /*
@@ -39,6 +41,31 @@
 
 namespace Wintermute {
 
+/**
+ * The runs of pixels in every row of a 32 bpp surface which aren't fully
+ * transparent, split into fully opaque runs and runs which need blending.
+ * Building this once when a surface is loaded spares checking the alpha of
+ * every pixel on every blit.
+ */
+struct AlphaSpans {
+	struct Span {
+		uint16 start;
+		uint16 length;
+		bool opaque;
+	};
+
+	/** The spans of all rows, left to right and top to bottom. */
+	Common::Array<Span> _spans;
+	/** Index of the first span of each row in _spans, plus the end of the last row. */
+	Common::Array<uint32> _rows;
+	uint16 _width;
+
+	void build(const Graphics::Surface &surface);
+
+	/** Whether the surface has any pixels which aren't fully opaque. */
+	bool hasTransparency() const;
+};
+
 /**
  * A transparent graphics surface, which implements alpha blitting.
  */
@@ -68,6 +95,14 @@ struct TransparentSurface : public Graphics::Surface {
 
 	bool _enableAlphaBlit;
 
+	/**
+	 * Optional alpha spans to blit by, for a surface which (0, 0) is at
+	 * _alphaSpansOrigin of. They are only used when neither scaling,
+	 * mirroring nor color modulation is involved.
+	 */
+	const AlphaSpans *_alphaSpans;
+	Common::Point _alphaSpansOrigin;
+
 	/**
 	 @brief renders the surface to another surface
 	 @param pDest a pointer to the target image. In most cases this is the framebuffer.
@@ -105,11 +140,25 @@ struct TransparentSurface : public Graphics::Surface {
 	// The following scale-code supports arbitrary scaling (i.e. no repeats of column 0 at the end of lines)
 	TransparentSurface *scale(uint16 newWidth, uint16 newHeight) const;
 	TransparentSurface *scale(const Common::Rect &srcRect, const Common::Rect &dstRect) const;
-	static byte *_lookup;
-	static void destroyLookup();
+
+	/**
+	 * Blends a pixel with an alpha of 1 to 254 onto an opaque one, both given
+	 * as native 32 bit values. The result is fully opaque.
+	 *
+	 * Red and blue are blended together, as no product of a channel and an
+	 * alpha value needs more than 16 bits. Every channel ends up as
+	 * (src * a >> 8) + (dst * (255 - a) >> 8).
+	 */
+	static inline uint32 blendPixel(uint32 src, uint32 dst) {
+		const uint32 a = src >> 24;
+		const uint32 rb = (((src & 0x00FF00FF) * a >> 8) & 0x00FF00FF) + (((dst & 0x00FF00FF) * (255 - a) >> 8) & 0x00FF00FF);
+		const uint32 g = (((src & 0x0000FF00) * a >> 8) & 0x0000FF00) + (((dst & 0x0000FF00) * (255 - a) >> 8) & 0x0000FF00);
+		return 0xFF000000 | rb | g;
+	}
+
 private:
 	static void doBlitAlpha(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep);
-	static void generateLookup();
+	void doBlitSpans(byte *outo, uint32 dstPitch, int srcX, int srcY, int width, int height, int rowStep) const;
 };
 
 /**
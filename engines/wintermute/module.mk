@@ -29,6 +29,8 @@ MODULE_OBJS := \
 	ad/ad_waypoint_group.o \
 	base/scriptables/script.o \
 	base/scriptables/script_engine.o \
+	base/scriptables/script_names.o \
+	base/scriptables/script_program.o \
 	base/scriptables/script_stack.o \
 	base/scriptables/script_value.o \
 	base/scriptables/script_ext_array.o \
@@ -54,7 +56,7 @@ MODULE_OBJS := \
 	base/gfx/osystem/base_surface_osystem.o \
 	base/gfx/osystem/base_render_osystem.o \
 	base/gfx/osystem/render_ticket.o \
-	base/particles/part_particle.o \
+	base/particles/part_particle_store.o \
 	base/particles/part_emitter.o \
 	base/particles/part_force.o \
 	base/sound/base_sound.o \
@@ -87,6 +89,7 @@ MODULE_OBJS := \
 	base/base_transition_manager.o \
 	base/base_viewport.o \
 	base/saveload.o \
+	debugger.o \
 	detection.o \
 	graphics/transparent_surface.o \
 	math/math_util.o \
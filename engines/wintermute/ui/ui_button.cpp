@@ -41,6 +41,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -789,10 +790,11 @@ void UIButton::press() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetDisabledFont
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetDisabledFont") == 0) {
+	case kScNameSetDisabledFont: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -812,7 +814,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetHoverFont") == 0) {
+	case kScNameSetHoverFont: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -832,7 +834,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetPressedFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPressedFont") == 0) {
+	case kScNameSetPressedFont: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -852,7 +854,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetFocusedFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFocusedFont") == 0) {
+	case kScNameSetFocusedFont: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -872,7 +874,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetDisabledImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetDisabledImage") == 0) {
+	case kScNameSetDisabledImage: {
 		stack->correctParams(1);
 
 		delete _imageDisable;
@@ -892,7 +894,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetDisabledImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDisabledImage") == 0) {
+	case kScNameGetDisabledImage: {
 		stack->correctParams(0);
 		if (!_imageDisable || !_imageDisable->getFilename()) {
 			stack->pushNULL();
@@ -906,7 +908,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetDisabledImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDisabledImageObject") == 0) {
+	case kScNameGetDisabledImageObject: {
 		stack->correctParams(0);
 		if (!_imageDisable) {
 			stack->pushNULL();
@@ -921,7 +923,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetHoverImage") == 0) {
+	case kScNameSetHoverImage: {
 		stack->correctParams(1);
 
 		delete _imageHover;
@@ -941,7 +943,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverImage") == 0) {
+	case kScNameGetHoverImage: {
 		stack->correctParams(0);
 		if (!_imageHover || !_imageHover->getFilename()) {
 			stack->pushNULL();
@@ -955,7 +957,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverImageObject") == 0) {
+	case kScNameGetHoverImageObject: {
 		stack->correctParams(0);
 		if (!_imageHover) {
 			stack->pushNULL();
@@ -969,7 +971,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetPressedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPressedImage") == 0) {
+	case kScNameSetPressedImage: {
 		stack->correctParams(1);
 
 		delete _imagePress;
@@ -989,7 +991,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetPressedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPressedImage") == 0) {
+	case kScNameGetPressedImage: {
 		stack->correctParams(0);
 		if (!_imagePress || !_imagePress->getFilename()) {
 			stack->pushNULL();
@@ -1003,7 +1005,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetPressedImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPressedImageObject") == 0) {
+	case kScNameGetPressedImageObject: {
 		stack->correctParams(0);
 		if (!_imagePress) {
 			stack->pushNULL();
@@ -1017,7 +1019,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetFocusedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFocusedImage") == 0) {
+	case kScNameSetFocusedImage: {
 		stack->correctParams(1);
 
 		delete _imageFocus;
@@ -1037,7 +1039,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFocusedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFocusedImage") == 0) {
+	case kScNameGetFocusedImage: {
 		stack->correctParams(0);
 		if (!_imageFocus || !_imageFocus->getFilename()) {
 			stack->pushNULL();
@@ -1051,7 +1053,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFocusedImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFocusedImageObject") == 0) {
+	case kScNameGetFocusedImageObject: {
 		stack->correctParams(0);
 		if (!_imageFocus) {
 			stack->pushNULL();
@@ -1065,7 +1067,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Press
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Press") == 0) {
+	case kScNamePress: {
 		stack->correctParams(0);
 
 		if (_visible && !_disable) {
@@ -1075,7 +1077,9 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		stack->pushNULL();
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -1085,10 +1089,11 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIButton::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("button");
 		return _scValue;
 	}
@@ -1096,7 +1101,7 @@ ScValue *UIButton::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextAlign") {
+	case kScNameTextAlign: {
 		_scValue->setInt(_align);
 		return _scValue;
 	}
@@ -1104,24 +1109,26 @@ ScValue *UIButton::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Focusable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Focusable") {
+	case kScNameFocusable: {
 		_scValue->setBool(_canFocus);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Pressed
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Pressed") {
+	case kScNamePressed: {
 		_scValue->setBool(_stayPressed);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PixelPerfect") {
+	case kScNamePixelPerfect: {
 		_scValue->setBool(_pixelPerfect);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return UIObject::scGetProperty(name);
 	}
 }
@@ -1129,10 +1136,11 @@ ScValue *UIButton::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool UIButton::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "TextAlign") == 0) {
+	case kScNameTextAlign: {
 		int i = value->getInt();
 		if (i < 0 || i >= NUM_TEXT_ALIGN) {
 			i = 0;
@@ -1144,24 +1152,26 @@ bool UIButton::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Focusable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Focusable") == 0) {
+	case kScNameFocusable: {
 		_canFocus = value->getBool();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Pressed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pressed") == 0) {
+	case kScNamePressed: {
 		_stayPressed = value->getBool();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PixelPerfect") == 0) {
+	case kScNamePixelPerfect: {
 		_pixelPerfect = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scSetProperty(name, value);
 	}
 }
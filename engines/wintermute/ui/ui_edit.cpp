@@ -44,6 +44,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/utils/utils.h"
 #include "common/util.h"
 #include "common/keyboard.h"
@@ -378,10 +379,11 @@ bool UIEdit::saveAsText(BaseDynamicBuffer *buffer, int indent) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIEdit::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetSelectedFont
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetSelectedFont") == 0) {
+	case kScNameSetSelectedFont: {
 		stack->correctParams(1);
 
 		if (_fontSelected) {
@@ -391,7 +393,9 @@ bool UIEdit::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		stack->pushBool(_fontSelected != NULL);
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -401,10 +405,11 @@ bool UIEdit::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("editor");
 		return _scValue;
 	}
@@ -412,7 +417,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelStart
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SelStart") {
+	case kScNameSelStart: {
 		_scValue->setInt(_selStart);
 		return _scValue;
 	}
@@ -420,7 +425,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelEnd
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SelEnd") {
+	case kScNameSelEnd: {
 		_scValue->setInt(_selEnd);
 		return _scValue;
 	}
@@ -428,7 +433,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorBlinkRate
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorBlinkRate") {
+	case kScNameCursorBlinkRate: {
 		_scValue->setInt(_cursorBlinkRate);
 		return _scValue;
 	}
@@ -436,7 +441,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorChar
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorChar") {
+	case kScNameCursorChar: {
 		_scValue->setString(_cursorChar);
 		return _scValue;
 	}
@@ -444,7 +449,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FrameWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FrameWidth") {
+	case kScNameFrameWidth: {
 		_scValue->setInt(_frameWidth);
 		return _scValue;
 	}
@@ -452,7 +457,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxLength
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxLength") {
+	case kScNameMaxLength: {
 		_scValue->setInt(_maxLength);
 		return _scValue;
 	}
@@ -460,7 +465,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Text") {
+	case kScNameText: {
 		if (_gameRef->_textEncoding == TEXT_UTF8) {
 			WideString wstr = StringUtil::ansiToWide(_text);
 			_scValue->setString(StringUtil::wideToUtf8(wstr).c_str());
@@ -468,7 +473,9 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 			_scValue->setString(_text);
 		}
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return UIObject::scGetProperty(name);
 	}
 }
@@ -476,10 +483,11 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool UIEdit::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelStart
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SelStart") == 0) {
+	case kScNameSelStart: {
 		_selStart = value->getInt();
 		_selStart = MAX(_selStart, 0);
 		_selStart = (int)MIN((size_t)_selStart, strlen(_text));
@@ -489,7 +497,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelEnd
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SelEnd") == 0) {
+	case kScNameSelEnd: {
 		_selEnd = value->getInt();
 		_selEnd = MAX(_selEnd, 0);
 		_selEnd = (int)MIN((size_t)_selEnd, strlen(_text));
@@ -499,7 +507,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorBlinkRate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorBlinkRate") == 0) {
+	case kScNameCursorBlinkRate: {
 		_cursorBlinkRate = (uint32)value->getInt();
 		return STATUS_OK;
 	}
@@ -507,7 +515,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorChar
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorChar") == 0) {
+	case kScNameCursorChar: {
 		setCursorChar(value->getString());
 		return STATUS_OK;
 	}
@@ -515,7 +523,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// FrameWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FrameWidth") == 0) {
+	case kScNameFrameWidth: {
 		_frameWidth = value->getInt();
 		return STATUS_OK;
 	}
@@ -523,7 +531,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxLength
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxLength") == 0) {
+	case kScNameMaxLength: {
 		_maxLength = value->getInt();
 		return STATUS_OK;
 	}
@@ -531,7 +539,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Text") == 0) {
+	case kScNameText: {
 		if (_gameRef->_textEncoding == TEXT_UTF8) {
 			WideString wstr = StringUtil::utf8ToWide(value->getString());
 			setText(StringUtil::wideToAnsi(wstr).c_str());
@@ -539,7 +547,9 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 			setText(value->getString());
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scSetProperty(name, value);
 	}
 }
@@ -35,6 +35,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 
 namespace Wintermute {
 
@@ -268,10 +269,11 @@ bool UIEntity::display(int offsetX, int offsetY) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetEntity
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetEntity") == 0) {
+	case kScNameGetEntity: {
 		stack->correctParams(0);
 
 		if (_entity) {
@@ -286,7 +288,7 @@ bool UIEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetEntity") == 0) {
+	case kScNameSetEntity: {
 		stack->correctParams(1);
 
 		const char *filename = stack->pop()->getString();
@@ -298,7 +300,9 @@ bool UIEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -308,10 +312,11 @@ bool UIEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIEntity::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("entity container");
 		return _scValue;
 	}
@@ -319,14 +324,16 @@ ScValue *UIEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Freezable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Freezable") {
+	case kScNameFreezable: {
 		if (_entity) {
 			_scValue->setBool(_entity->_freezable);
 		} else {
 			_scValue->setBool(false);
 		}
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return UIObject::scGetProperty(name);
 	}
 }
@@ -334,15 +341,18 @@ ScValue *UIEntity::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool UIEntity::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Freezable
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Freezable") == 0) {
+	case kScNameFreezable: {
 		if (_entity) {
 			_entity->makeFreezable(value->getBool());
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scSetProperty(name, value);
 	}
 }
@@ -35,6 +35,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/font/base_font_storage.h"
 
 namespace Wintermute {
@@ -157,10 +158,11 @@ void UIObject::correctSize() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetFont
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetFont") == 0) {
+	case kScNameSetFont: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -180,7 +182,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetImage") == 0) {
+	case kScNameSetImage: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -208,7 +210,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetImage") == 0) {
+	case kScNameGetImage: {
 		stack->correctParams(0);
 		if (!_image || !_image->getFilename()) {
 			stack->pushNULL();
@@ -222,7 +224,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetImageObject") == 0) {
+	case kScNameGetImageObject: {
 		stack->correctParams(0);
 		if (!_image) {
 			stack->pushNULL();
@@ -236,7 +238,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Focus
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Focus") == 0) {
+	case kScNameFocus: {
 		stack->correctParams(0);
 		focus();
 		stack->pushNULL();
@@ -246,7 +248,8 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// MoveAfter / MoveBefore
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveAfter") == 0 || strcmp(name, "MoveBefore") == 0) {
+	case kScNameMoveAfter:
+	case kScNameMoveBefore: {
 		stack->correctParams(1);
 
 		if (_parent && _parent->_type == UI_WINDOW) {
@@ -312,7 +315,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// MoveToBottom
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveToBottom") == 0) {
+	case kScNameMoveToBottom: {
 		stack->correctParams(0);
 
 		if (_parent && _parent->_type == UI_WINDOW) {
@@ -335,7 +338,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// MoveToTop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveToTop") == 0) {
+	case kScNameMoveToTop: {
 		stack->correctParams(0);
 
 		if (_parent && _parent->_type == UI_WINDOW) {
@@ -353,7 +356,9 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -363,10 +368,11 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIObject::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("ui_object");
 		return _scValue;
 	}
@@ -374,7 +380,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	case kScNameName: {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -382,7 +388,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Parent (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Parent") {
+	case kScNameParent: {
 		_scValue->setNative(_parent, true);
 		return _scValue;
 	}
@@ -390,7 +396,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ParentNotify
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ParentNotify") {
+	case kScNameParentNotify: {
 		_scValue->setBool(_parentNotify);
 		return _scValue;
 	}
@@ -398,7 +404,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	case kScNameWidth: {
 		_scValue->setInt(_width);
 		return _scValue;
 	}
@@ -406,7 +412,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	case kScNameHeight: {
 		_scValue->setInt(_height);
 		return _scValue;
 	}
@@ -414,7 +420,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Visible
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Visible") {
+	case kScNameVisible: {
 		_scValue->setBool(_visible);
 		return _scValue;
 	}
@@ -422,7 +428,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Disabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Disabled") {
+	case kScNameDisabled: {
 		_scValue->setBool(_disable);
 		return _scValue;
 	}
@@ -430,7 +436,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Text") {
+	case kScNameText: {
 		_scValue->setString(_text);
 		return _scValue;
 	}
@@ -438,7 +444,8 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NextSibling (RO) / PrevSibling (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NextSibling" || name == "PrevSibling") {
+	case kScNameNextSibling:
+	case kScNamePrevSibling: {
 		_scValue->setNULL();
 		if (_parent && _parent->_type == UI_WINDOW) {
 			UIWindow *win = (UIWindow *)_parent;
@@ -458,7 +465,9 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 			}
 		}
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -466,10 +475,11 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool UIObject::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -477,7 +487,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ParentNotify
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ParentNotify") == 0) {
+	case kScNameParentNotify: {
 		_parentNotify = value->getBool();
 		return STATUS_OK;
 	}
@@ -485,7 +495,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Width") == 0) {
+	case kScNameWidth: {
 		_width = value->getInt();
 		return STATUS_OK;
 	}
@@ -493,7 +503,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Height") == 0) {
+	case kScNameHeight: {
 		_height = value->getInt();
 		return STATUS_OK;
 	}
@@ -501,7 +511,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Visible
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Visible") == 0) {
+	case kScNameVisible: {
 		_visible = value->getBool();
 		return STATUS_OK;
 	}
@@ -509,7 +519,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Disabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Disabled") == 0) {
+	case kScNameDisabled: {
 		_disable = value->getBool();
 		return STATUS_OK;
 	}
@@ -517,10 +527,12 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Text") == 0) {
+	case kScNameText: {
 		setText(value->getString());
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -37,6 +37,7 @@
 #include "engines/wintermute/base/base_string_table.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
@@ -404,10 +405,11 @@ bool UIText::saveAsText(BaseDynamicBuffer *buffer, int indent) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIText::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SizeToFit
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SizeToFit") == 0) {
+	case kScNameSizeToFit: {
 		stack->correctParams(0);
 		sizeToFit();
 		stack->pushNULL();
@@ -417,14 +419,16 @@ bool UIText::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// HeightToFit
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HeightToFit") == 0) {
+	case kScNameHeightToFit: {
 		stack->correctParams(0);
 		if (_font && _text) {
 			_height = _font->getTextHeight((byte *)_text, _width);
 		}
 		stack->pushNULL();
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -434,10 +438,11 @@ bool UIText::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *UIText::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("static");
 		return _scValue;
 	}
@@ -445,7 +450,7 @@ ScValue *UIText::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextAlign") {
+	case kScNameTextAlign: {
 		_scValue->setInt(_textAlign);
 		return _scValue;
 	}
@@ -453,10 +458,12 @@ ScValue *UIText::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// VerticalAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VerticalAlign") {
+	case kScNameVerticalAlign: {
 		_scValue->setInt(_verticalAlign);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return UIObject::scGetProperty(name);
 	}
 }
@@ -464,10 +471,11 @@ ScValue *UIText::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool UIText::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "TextAlign") == 0) {
+	case kScNameTextAlign: {
 		int i = value->getInt();
 		if (i < 0 || i >= NUM_TEXT_ALIGN) {
 			i = 0;
@@ -479,14 +487,16 @@ bool UIText::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// VerticalAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "VerticalAlign") == 0) {
+	case kScNameVerticalAlign: {
 		int i = value->getInt();
 		if (i < 0 || i >= NUM_VERTICAL_ALIGN) {
 			i = 0;
 		}
 		_verticalAlign = (TVerticalAlign)i;
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scSetProperty(name, value);
 	}
 }
@@ -44,6 +44,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_names.h"
 #include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
@@ -759,10 +760,12 @@ bool UIWindow::showWidget(const char *name, bool visible) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetWidget / GetControl
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetWidget") == 0 || strcmp(name, "GetControl") == 0) {
+	case kScNameGetWidget:
+	case kScNameGetControl: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->getType() == VAL_INT) {
@@ -788,7 +791,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetInactiveFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetInactiveFont") == 0) {
+	case kScNameSetInactiveFont: {
 		stack->correctParams(1);
 
 		if (_fontInactive) {
@@ -803,7 +806,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetInactiveImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetInactiveImage") == 0) {
+	case kScNameSetInactiveImage: {
 		stack->correctParams(1);
 
 		delete _imageInactive;
@@ -823,7 +826,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetInactiveImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInactiveImage") == 0) {
+	case kScNameGetInactiveImage: {
 		stack->correctParams(0);
 		if (!_imageInactive || !_imageInactive->getFilename()) {
 			stack->pushNULL();
@@ -837,7 +840,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetInactiveImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInactiveImageObject") == 0) {
+	case kScNameGetInactiveImageObject: {
 		stack->correctParams(0);
 		if (!_imageInactive) {
 			stack->pushNULL();
@@ -852,7 +855,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Close
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Close") == 0) {
+	case kScNameClose: {
 		stack->correctParams(0);
 		stack->pushBool(DID_SUCCEED(close()));
 		return STATUS_OK;
@@ -861,7 +864,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GoExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoExclusive") == 0) {
+	case kScNameGoExclusive: {
 		stack->correctParams(0);
 		goExclusive();
 		script->waitFor(this);
@@ -872,7 +875,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GoSystemExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoSystemExclusive") == 0) {
+	case kScNameGoSystemExclusive: {
 		stack->correctParams(0);
 		goSystemExclusive();
 		script->waitFor(this);
@@ -883,7 +886,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Center
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Center") == 0) {
+	case kScNameCenter: {
 		stack->correctParams(0);
 		_posX = (_gameRef->_renderer->_width - _width) / 2;
 		_posY = (_gameRef->_renderer->_height - _height) / 2;
@@ -894,7 +897,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadFromFile
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadFromFile") == 0) {
+	case kScNameLoadFromFile: {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -911,7 +914,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateButton") == 0) {
+	case kScNameCreateButton: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -930,7 +933,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateStatic
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateStatic") == 0) {
+	case kScNameCreateStatic: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -949,7 +952,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEditor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEditor") == 0) {
+	case kScNameCreateEditor: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -968,7 +971,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateWindow") == 0) {
+	case kScNameCreateWindow: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -987,7 +990,11 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteControl / DeleteButton / DeleteStatic / DeleteEditor / DeleteWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteControl") == 0 || strcmp(name, "DeleteButton") == 0 || strcmp(name, "DeleteStatic") == 0 || strcmp(name, "DeleteEditor") == 0 || strcmp(name, "DeleteWindow") == 0) {
+	case kScNameDeleteControl:
+	case kScNameDeleteButton:
+	case kScNameDeleteStatic:
+	case kScNameDeleteEditor:
+	case kScNameDeleteWindow: {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		UIObject *obj = (UIObject *)val->getNative();
@@ -1003,11 +1010,12 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 		stack->pushNULL();
 		return STATUS_OK;
-	} else if DID_SUCCEED(_gameRef->windowScriptMethodHook(this, script, stack, name)) {
-		return STATUS_OK;
 	}
 
-	else {
+	default:
+		if DID_SUCCEED(_gameRef->windowScriptMethodHook(this, script, stack, name)) {
+			return STATUS_OK;
+		}
 		return UIObject::scCallMethod(script, stack, thisStack, name);
 	}
 }
@@ -1017,10 +1025,11 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	case kScNameType: {
 		_scValue->setString("window");
 		return _scValue;
 	}
@@ -1028,7 +1037,8 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumWidgets / NumControls (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumWidgets" || name == "NumControls") {
+	case kScNameNumWidgets:
+	case kScNameNumControls: {
 		_scValue->setInt(_widgets.size());
 		return _scValue;
 	}
@@ -1036,7 +1046,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Exclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Exclusive") {
+	case kScNameExclusive: {
 		_scValue->setBool(_mode == WINDOW_EXCLUSIVE);
 		return _scValue;
 	}
@@ -1044,7 +1054,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SystemExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SystemExclusive") {
+	case kScNameSystemExclusive: {
 		_scValue->setBool(_mode == WINDOW_SYSTEM_EXCLUSIVE);
 		return _scValue;
 	}
@@ -1052,7 +1062,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Menu
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Menu") {
+	case kScNameMenu: {
 		_scValue->setBool(_isMenu);
 		return _scValue;
 	}
@@ -1060,7 +1070,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InGame") {
+	case kScNameInGame: {
 		_scValue->setBool(_inGame);
 		return _scValue;
 	}
@@ -1068,7 +1078,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PauseMusic
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PauseMusic") {
+	case kScNamePauseMusic: {
 		_scValue->setBool(_pauseMusic);
 		return _scValue;
 	}
@@ -1076,7 +1086,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ClipContents
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ClipContents") {
+	case kScNameClipContents: {
 		_scValue->setBool(_clipContents);
 		return _scValue;
 	}
@@ -1084,7 +1094,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Transparent
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Transparent") {
+	case kScNameTransparent: {
 		_scValue->setBool(_transparent);
 		return _scValue;
 	}
@@ -1092,10 +1102,12 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FadeColor") {
+	case kScNameFadeColor: {
 		_scValue->setInt((int)_fadeColor);
 		return _scValue;
-	} else {
+	}
+
+	default:
 		return UIObject::scGetProperty(name);
 	}
 }
@@ -1103,10 +1115,11 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool UIWindow::scSetProperty(const char *name, ScValue *value) {
+	switch (scGetNameId(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	case kScNameName: {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -1114,7 +1127,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Menu
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Menu") == 0) {
+	case kScNameMenu: {
 		_isMenu = value->getBool();
 		return STATUS_OK;
 	}
@@ -1122,7 +1135,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InGame") == 0) {
+	case kScNameInGame: {
 		_inGame = value->getBool();
 		return STATUS_OK;
 	}
@@ -1130,7 +1143,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PauseMusic
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseMusic") == 0) {
+	case kScNamePauseMusic: {
 		_pauseMusic = value->getBool();
 		return STATUS_OK;
 	}
@@ -1138,7 +1151,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ClipContents
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClipContents") == 0) {
+	case kScNameClipContents: {
 		_clipContents = value->getBool();
 		return STATUS_OK;
 	}
@@ -1146,7 +1159,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Transparent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Transparent") == 0) {
+	case kScNameTransparent: {
 		_transparent = value->getBool();
 		return STATUS_OK;
 	}
@@ -1154,7 +1167,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeColor") == 0) {
+	case kScNameFadeColor: {
 		_fadeColor = (uint32)value->getInt();
 		_fadeBackground = (_fadeColor != 0);
 		return STATUS_OK;
@@ -1163,7 +1176,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Exclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Exclusive") == 0) {
+	case kScNameExclusive: {
 		if (value->getBool()) {
 			goExclusive();
 		} else {
@@ -1176,7 +1189,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SystemExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SystemExclusive") == 0) {
+	case kScNameSystemExclusive: {
 		if (value->getBool()) {
 			goSystemExclusive();
 		} else {
@@ -1184,7 +1197,9 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 			_visible = true;
 		}
 		return STATUS_OK;
-	} else {
+	}
+
+	default:
 		return UIObject::scSetProperty(name, value);
 	}
 }
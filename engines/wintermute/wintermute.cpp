@@ -34,11 +34,13 @@
 #include "engines/util.h"
 #include "engines/wintermute/ad/ad_game.h"
 #include "engines/wintermute/wintermute.h"
+#include "engines/wintermute/debugger.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "engines/wintermute/base/base_engine.h"
 
 #include "engines/wintermute/base/sound/base_sound_manager.h"
 #include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_engine.h"
 
@@ -48,6 +50,7 @@ namespace Wintermute {
 // This might not be the prettiest solution
 WintermuteEngine::WintermuteEngine() : Engine(g_system) {
 	_game = new AdGame("");
+	_console = NULL;
 }
 
 WintermuteEngine::WintermuteEngine(OSystem *syst, const ADGameDescription *desc)
@@ -71,6 +74,7 @@ WintermuteEngine::WintermuteEngine(OSystem *syst, const ADGameDescription *desc)
 	DebugMan.addDebugChannel(kWintermuteDebugGeneral, "general", "various issues not covered by any of the above");
 
 	_game = NULL;
+	_console = NULL;
 }
 
 WintermuteEngine::~WintermuteEngine() {
@@ -97,6 +101,10 @@ bool WintermuteEngine::hasFeature(EngineFeature f) const {
 	return false;
 }
 
+GUI::Debugger *WintermuteEngine::getDebugger() {
+	return _console;
+}
+
 Common::Error WintermuteEngine::run() {
 	// Initialize graphics using following:
 	Graphics::PixelFormat format(4, 8, 8, 8, 8, 16, 8, 0, 24);
@@ -234,8 +242,13 @@ int WintermuteEngine::messageLoop() {
 	while (!done) {
 		Common::Event event;
 		while (_system->getEventManager()->pollEvent(event)) {
+			if (event.type == Common::EVENT_KEYDOWN && event.kbd.hasFlags(Common::KBD_CTRL) && event.kbd.keycode == Common::KEYCODE_d) {
+				_console->attach();
+				continue;
+			}
 			BasePlatform::handleEvent(&event);
 		}
+		_console->onFrame();
 
 		if (_game && _game->_renderer->_active && _game->_renderer->_ready) {
 			_game->displayContent();
@@ -246,7 +259,12 @@ int WintermuteEngine::messageLoop() {
 			time = _system->getMillis();
 			diff = time - prevTime;
 			if (frameTime > diff) { // Avoid overflows
-				_system->delayMillis(frameTime - diff);
+				// Load the images the scene is going to need while waiting
+				_game->_surfaceStorage->preloadSurfaces(frameTime - diff);
+				diff = _system->getMillis() - prevTime;
+				if (frameTime > diff) {
+					_system->delayMillis(frameTime - diff);
+				}
 			}
 
 			// ***** flip
@@ -25,7 +25,6 @@
 
 #include "engines/engine.h"
 #include "engines/advancedDetector.h"
-#include "gui/debugger.h"
 
 namespace Wintermute {
 
@@ -50,6 +49,7 @@ public:
 
 	virtual Common::Error run();
 	virtual bool hasFeature(EngineFeature f) const;
+	virtual GUI::Debugger *getDebugger();
 	Common::SaveFileManager *getSaveFileMan() { return _saveFileMan; }
 	virtual Common::Error loadGameState(int slot);
 	virtual bool canLoadGameStateCurrently();
@@ -58,6 +58,8 @@ public:
 	// For detection-purposes:
 	static bool getGameInfo(const Common::FSList &fslist, Common::String &name, Common::String &caption);
 private:
+	friend class Console;
+
 	int init();
 	void deinit();
 	int messageLoop();
@@ -66,13 +68,6 @@ private:
 	const ADGameDescription *_gameDescription;
 };
 
-// Example console class
-class Console : public GUI::Debugger {
-public:
-	Console(WintermuteEngine *vm) {}
-	virtual ~Console(void) {}
-};
-
 } // End of namespace Wintermute
 
 #endif
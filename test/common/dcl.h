@@ -0,0 +1,57 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/dcl.h"
+#include "common/memstream.h"
+
+class DCLTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_binary_mode() {
+		// Literals "abc", then copies of length 3, 2, 20 (which needs extra
+		// length bits) and 4, the last ones overlapping what they write
+		const byte packed[] = {
+			0x00, 0x04, 0xc2, 0x88, 0x19, 0xfb, 0xb2, 0x13, 0x71, 0x98, 0x5e
+		};
+		const char *unpacked = "abcabcccccccccccccccccccccccabca";
+
+		Common::MemoryReadStream ms(packed, sizeof(packed));
+		byte dest[32];
+
+		TS_ASSERT(Common::decompressDCL(&ms, dest, sizeof(packed), sizeof(dest)));
+		TS_ASSERT_EQUALS(memcmp(dest, unpacked, sizeof(dest)), 0);
+	}
+
+	void test_ascii_mode() {
+		// Literals with codes of 4 up to 13 bits, then two copies
+		const byte packed[] = {
+			0x01, 0x06, 0x42, 0x11, 0xdf, 0x83, 0x24, 0x00, 0x00, 0x00, 0x7a,
+			0x90, 0x82, 0x34, 0xe6, 0xe4, 0x13
+		};
+		const byte unpacked[] = {
+			'D', 'C', 'L', ' ', 0x00, 0xff, 0xfe, ' ', 'z', 'z',
+			'D', 'C', 'L', ' ', 0x00, 0xff, 0xfe, ' ', 'z', 'z',
+			'D', 'C', ' ', 'z', 'z'
+		};
+
+		Common::MemoryReadStream ms(packed, sizeof(packed));
+		Common::SeekableReadStream *stream = Common::decompressDCL(&ms, sizeof(packed), sizeof(unpacked));
+
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), (int32)sizeof(unpacked));
+
+		byte dest[sizeof(unpacked)];
+		stream->read(dest, sizeof(dest));
+		TS_ASSERT_EQUALS(memcmp(dest, unpacked, sizeof(dest)), 0);
+
+		delete stream;
+	}
+
+	void test_copy_before_start() {
+		// A copy with a distance of 1 as the very first thing
+		const byte packed[] = { 0x00, 0x04, 0x1f, 0x00 };
+
+		Common::MemoryReadStream ms(packed, sizeof(packed));
+		byte dest[4];
+
+		TS_ASSERT(!Common::decompressDCL(&ms, dest, sizeof(packed), sizeof(dest)));
+	}
+};
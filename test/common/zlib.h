@@ -0,0 +1,104 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/zlib.h"
+#include "common/memstream.h"
+
+class ZlibTestSuite : public CxxTest::TestSuite {
+	// More than a few seek checkpoints worth of data
+	enum {
+		kDataSize = 3 * 1024 * 1024 + 123
+	};
+
+	byte *_data;
+	byte *_packed;
+	uint32 _packedSize;
+
+	public:
+	void setUp() {
+		// Compressible, but not so much that deflate blocks get huge
+		_data = new byte[kDataSize];
+		uint32 seed = 1;
+		for (uint32 i = 0; i < kDataSize; i++) {
+			seed = seed * 1103515245 + 12345;
+			_data[i] = (seed >> 16) % 16 + (i >> 12);
+		}
+
+		Common::MemoryWriteStreamDynamic *packed = new Common::MemoryWriteStreamDynamic();
+		Common::WriteStream *stream = Common::wrapCompressedWriteStream(packed);
+		stream->write(_data, kDataSize);
+		stream->finalize();
+		_packedSize = packed->size();
+		_packed = packed->getData();
+		delete stream;
+	}
+
+	void tearDown() {
+		delete[] _data;
+		free(_packed);
+	}
+
+	void test_sequential_read() {
+		Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(new Common::MemoryReadStream(_packed, _packedSize));
+		TS_ASSERT_EQUALS(stream->size(), (int32)kDataSize);
+
+		byte *buffer = new byte[kDataSize];
+		TS_ASSERT_EQUALS(stream->read(buffer, kDataSize), (uint32)kDataSize);
+		TS_ASSERT_EQUALS(memcmp(buffer, _data, kDataSize), 0);
+		TS_ASSERT(!stream->eos());
+
+		TS_ASSERT_EQUALS(stream->read(buffer, 1), 0u);
+		TS_ASSERT(stream->eos());
+		TS_ASSERT(!stream->err());
+
+		delete[] buffer;
+		delete stream;
+	}
+
+	void test_random_seek() {
+		Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(new Common::MemoryReadStream(_packed, _packedSize));
+
+		// Back and forth, both within the recently read data and further
+		uint32 seed = 7;
+		for (int i = 0; i < 200; i++) {
+			seed = seed * 1103515245 + 12345;
+			int32 offset = (seed >> 8) % kDataSize;
+			if (i % 3 == 1)
+				offset = MAX<int32>(0, stream->pos() - (int32)(seed % 40000));
+
+			byte buffer[1000];
+			uint32 size = MIN<uint32>(sizeof(buffer), kDataSize - offset);
+			TS_ASSERT(stream->seek(offset, SEEK_SET));
+			TS_ASSERT_EQUALS(stream->pos(), offset);
+			TS_ASSERT_EQUALS(stream->read(buffer, size), size);
+			TS_ASSERT_EQUALS(memcmp(buffer, _data + offset, size), 0);
+		}
+
+		TS_ASSERT(stream->seek(-10, SEEK_END));
+		TS_ASSERT_EQUALS(stream->readByte(), _data[kDataSize - 10]);
+		TS_ASSERT(!stream->err());
+
+		delete stream;
+	}
+
+	void test_seek_after_sequential_read() {
+		Common::SeekableReadStream *stream = Common::wrapCompressedReadStream(new Common::MemoryReadStream(_packed, _packedSize));
+
+		// Read a good part front to back first, then seek around in it
+		byte *buffer = new byte[kDataSize];
+		const uint32 size = 2 * 1024 * 1024;
+		TS_ASSERT_EQUALS(stream->read(buffer, size), size);
+		TS_ASSERT_EQUALS(memcmp(buffer, _data, size), 0);
+
+		static const int32 offsets[] = { size - 100, 12345, size + 50000, 700000, kDataSize - 1000, 0 };
+		for (int i = 0; i < ARRAYSIZE(offsets); i++) {
+			const uint32 count = MIN<uint32>(1000, kDataSize - offsets[i]);
+			TS_ASSERT(stream->seek(offsets[i], SEEK_SET));
+			TS_ASSERT_EQUALS(stream->read(buffer, count), count);
+			TS_ASSERT_EQUALS(memcmp(buffer, _data + offsets[i], count), 0);
+		}
+		TS_ASSERT(!stream->err());
+
+		delete[] buffer;
+		delete stream;
+	}
+};
@@ -0,0 +1,41 @@
+#include <cxxtest/TestSuite.h>
+
+#include "engines/wintermute/graphics/transparent_surface.h"
+
+class TransparentSurfaceTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_blend_pixel() {
+		// Compare against blending every channel through a multiplication
+		// table, like the blitter used to
+		byte *lookup = new byte[256 * 256];
+		for (int i = 0; i < 256; i++) {
+			for (int j = 0; j < 256; j++)
+				lookup[(i << 8) + j] = (i * j) >> 8;
+		}
+
+		uint32 mismatches = 0;
+		for (uint32 a = 1; a < 255; a++) {
+			for (uint32 src = 0; src < 256; src++) {
+				for (uint32 dst = 0; dst < 256; dst++) {
+					// Use a different value in every channel, so that
+					// carries between them show up
+					const uint32 srcPix = (a << 24) | (src << 16) | ((255 - src) << 8) | (src ^ 0x5A);
+					const uint32 dstPix = 0xFF000000 | ((dst ^ 0xA5) << 16) | (dst << 8) | (255 - dst);
+
+					uint32 expected = 0xFF000000;
+					for (int shift = 0; shift < 24; shift += 8) {
+						const uint32 s = (srcPix >> shift) & 0xFF;
+						const uint32 d = (dstPix >> shift) & 0xFF;
+						expected |= (lookup[(a << 8) + s] + lookup[((255 - a) << 8) + d]) << shift;
+					}
+
+					if (Wintermute::TransparentSurface::blendPixel(srcPix, dstPix) != expected)
+						mismatches++;
+				}
+			}
+		}
+
+		delete[] lookup;
+		TS_ASSERT_EQUALS(mismatches, 0u);
+	}
+};
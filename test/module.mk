@@ -8,6 +8,17 @@
 TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h
 TEST_LIBS    := audio/libaudio.a common/libcommon.a
 
+ifdef ENABLE_WINTERMUTE
+# The runner does not link the engines, only the code their tests cover
+TESTS        += $(srcdir)/test/engines/wintermute/*.h
+TEST_LIBS    := engines/wintermute/graphics/transparent_surface.o graphics/libgraphics.a $(TEST_LIBS)
+endif
+
+ifndef USE_ZLIB
+# Without zlib, compressed streams are passed through as they are
+TESTS        := $(filter-out $(srcdir)/test/common/zlib.h,$(wildcard $(TESTS)))
+endif
+
 #
 TEST_FLAGS   := --runner=StdioPrinter --no-std --no-eh --include=$(srcdir)/test/cxxtest_mingw.h
 TEST_CFLAGS  := -I$(srcdir)/test/cxxtest